@@ -8,6 +8,8 @@ class Harq
 
     def initialize(host="localhost", port=DEFAULT_PORT)
       @sock = TCPSocket.new host, port
+      @unread = []
+      @confirmed = []
     end
 
     def to_io
@@ -33,6 +35,10 @@ class Harq
       configure :confirm => true
     end
 
+    def coalesce_confirms!
+      configure :confirm => true, :coalesce_confirms => true
+    end
+
     def request_ack!
       configure :ack => true
     end
@@ -41,6 +47,12 @@ class Harq
       configure :inflight => val.to_i
     end
 
+    # Have deliveries sent in frames of up to count messages or bytes
+    # bytes.
+    def batch!(count, bytes=0)
+      configure :batch_messages => count, :batch_bytes => bytes
+    end
+
     def subscribe!(dest)
       send_action :type => 1, :payload => dest
     end
@@ -61,6 +73,10 @@ class Harq
       send_action :type => 9, :payload => dest
     end
 
+    def request_stats
+      send_action :type => 16
+    end
+
     def make_broadcast(dest)
       send_action :type => 10, :payload => dest
     end
@@ -86,16 +102,91 @@ class Harq
       send_action :type => 14, :payload => str
     end
 
-    def broadcast(dest, payload)
+    def sync_replicas(queue, count)
+      qr = Wire::QueueReplication.new :queue => queue, :sync_replicas => count
+
+      str = ""
+      qr.encode str
+
+      send_action :type => 17, :payload => str
+    end
+
+    # ttl is in milliseconds.
+    def queue_ttl(queue, ttl)
+      queue_options :queue => queue, :ttl => ttl
+    end
+
+    # How many milliseconds a consumer has to ack a message.
+    def queue_ack_timeout(queue, timeout)
+      queue_options :queue => queue, :ack_timeout => timeout
+    end
+
+    # The queue's share of an ack'ing consumer's refills.
+    def queue_weight(queue, weight)
+      queue_options :queue => queue, :weight => weight
+    end
+
+    def queue_options(fields)
+      qo = Wire::QueueOptions.new fields
+
+      str = ""
+      qo.encode str
+
+      send_action :type => 18, :payload => str
+    end
+
+    def broadcast(dest, payload, ttl=nil)
       msg = Wire::Message.new \
               :destination => dest,
               :payload => payload
 
+      msg.ttl = ttl if ttl
+
       send_message msg
     end
 
     alias_method :queue, :broadcast
 
+    # With request_confirm! on, read_confirm returns id once the server
+    # has the message.
+    def publish_confirmed(dest, payload, id)
+      msg = Wire::Message.new \
+              :destination => dest,
+              :payload => payload,
+              :confirm_id => id
+
+      send_message msg
+    end
+
+    # Publishes each [payload, id] pair with one write, so the server
+    # handles them in a single read.
+    def publish_all_confirmed(dest, pairs)
+      str = ""
+
+      pairs.each do |payload, id|
+        msg = Wire::Message.new \
+                :destination => dest,
+                :payload => payload,
+                :confirm_id => id
+
+        frame = ""
+        msg.encode frame
+        str << [frame.size].pack("N") << frame
+      end
+
+      @sock << str
+    end
+
+    # Held by the server until the Time at.
+    def schedule(dest, payload, at)
+      msg = Wire::Message.new \
+              :destination => dest,
+              :payload => payload,
+              :not_before => at.to_f
+
+      send_message msg
+    end
+
     def read
       read_message.payload
     end
@@ -108,19 +199,29 @@ class Harq
     end
 
     def read_message
-      while true
-        sz = @sock.read(4).unpack("N").first
-        msg = Wire::Message.decode @sock.read(sz)
-
-        if msg.destination == "+"
-          Wire::Action.handle msg
-        else
-          return msg
-        end
-      end
+      read_frame while @unread.empty?
+      @unread.shift
+    end
+
+    # The next confirmed id. Messages that come in first are kept for
+    # read_message.
+    def read_confirm
+      read_frame while @confirmed.empty?
+
+      ids = @confirmed.first
+      @confirmed.shift if ids.size == 1
+      ids.shift
+    end
+
+    # Every id in the next confirm, which with coalesce_confirms! is
+    # all of those published in one read.
+    def read_confirms
+      read_frame while @confirmed.empty?
+      @confirmed.shift
     end
 
     def ready?(timeout=0)
+      return true unless @unread.empty?
       !!IO.select([@sock], nil, nil, timeout)
     end
 
@@ -133,5 +234,22 @@ class Harq
       broadcast "+", str
     end
 
+    private
+
+    def read_frame
+      sz = @sock.read(4).unpack("N").first
+      msg = Wire::Message.decode @sock.read(sz)
+
+      case msg.destination
+      when "+"
+        @confirmed << Wire::Action.handle(msg)
+      when "+batch"
+        batch = Wire::MessageBatch.decode msg.payload
+        @unread.concat batch.messages.map { |m| Wire::Message.decode m }
+      else
+        @unread << msg
+      end
+    end
+
   end
 end
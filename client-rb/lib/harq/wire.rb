@@ -15,6 +15,11 @@ class Harq
 
       optional :confirm_id, :uint64, 5
 
+      optional :ttl, :uint32, 6
+      optional :expires, :double, 7
+      optional :not_before, :double, 8
+      optional :redeliveries, :uint32, 9
+
       def stat?
         destination == "+stat"
       end
@@ -26,6 +31,18 @@ class Harq
 
         nil
       end
+
+      def stats?
+        destination == "+stats"
+      end
+
+      def as_stats
+        if stats?
+          return StatDump.decode(payload)
+        end
+
+        nil
+      end
     end
 
     class QueueError
@@ -42,6 +59,34 @@ class Harq
       optional :ack, :bool, 2
       optional :confirm, :bool, 3
       optional :inflight, :uint32, 4
+      optional :write_high_water, :uint32, 5
+      optional :write_low_water, :uint32, 6
+      optional :batch_messages, :uint32, 7
+      optional :batch_bytes, :uint32, 8
+      optional :coalesce_confirms, :bool, 9
+    end
+
+    class MessageBatch
+      include Beefcake::Message
+
+      repeated :messages, :bytes, 1
+    end
+
+    class ConfirmRange
+      include Beefcake::Message
+
+      required :first, :uint64, 1
+      required :count, :uint64, 2
+    end
+
+    class Confirms
+      include Beefcake::Message
+
+      repeated :ranges, ConfirmRange, 1
+
+      def ids
+        ranges.map { |r| (r.first...(r.first + r.count)).to_a }.flatten
+      end
     end
 
     class Action
@@ -51,10 +96,17 @@ class Harq
       optional :payload, :string, 2
       optional :id, :uint64, 3
 
+      # Returns the ids in a confirm, raises for an error.
       def self.handle(msg)
         act = Action.decode msg.payload
 
         case act.type
+        when 8
+          if act.payload
+            Confirms.decode(act.payload).ids
+          else
+            [act.id]
+          end
         when 13
           error = QueueError.decode act.payload
 
@@ -73,16 +125,73 @@ class Harq
       optional :transient_size, :uint32, 3
       optional :durable_size, :uint32, 4
 
+      optional :enqueued, :uint64, 5
+      optional :dequeued, :uint64, 6
+      optional :acked, :uint64, 7
+      optional :redelivered, :uint64, 8
+      optional :bytes_in, :uint64, 9
+      optional :bytes_out, :uint64, 10
+
+      optional :enqueue_rate, :double, 11
+      optional :dequeue_rate, :double, 12
+      optional :ack_rate, :double, 13
+      optional :redelivery_rate, :double, 14
+
+      optional :subscribers, :uint32, 15
+      optional :inflight, :uint32, 16
+      optional :oldest_age, :double, 17
+      optional :write_backlog, :uint64, 18
+      optional :memory_bytes, :uint64, 19
+      optional :spilled_size, :uint32, 20
+      optional :expired, :uint64, 21
+      optional :scheduled_size, :uint32, 22
+
       def size
         transient_size.to_i + durable_size.to_i
       end
     end
 
+    class ConnectionStat
+      include Beefcake::Message
+
+      required :fd, :int32, 1
+      optional :subscriptions, :uint32, 2
+      optional :inflight, :uint32, 3
+      optional :inflight_max, :uint32, 4
+      optional :write_backlog, :uint64, 5
+      optional :ack, :bool, 6
+      optional :tap, :bool, 7
+      optional :replica, :bool, 8
+    end
+
+    class StatDump
+      include Beefcake::Message
+
+      repeated :queues, Stat, 1
+      repeated :connections, ConnectionStat, 2
+    end
+
     class BondRequest
       include Beefcake::Message
 
       required :queue, :string, 1
       required :destination, :string, 2
     end
+
+    class QueueReplication
+      include Beefcake::Message
+
+      required :queue, :string, 1
+      required :sync_replicas, :uint32, 2
+    end
+
+    class QueueOptions
+      include Beefcake::Message
+
+      required :queue, :string, 1
+      optional :ttl, :uint32, 2
+      optional :ack_timeout, :uint32, 3
+      optional :weight, :uint32, 4
+    end
   end
 end
@@ -1,27 +1,128 @@
 require 'test/unit'
 require 'harq/client'
 require 'fileutils'
+require 'tmpdir'
+require 'timeout'
+require 'net/http'
 
 class TestServer < Test::Unit::TestCase
   Q = "&rubytest"
   P = "payload"
 
+  # Replication tests run their own servers from this binary.
+  HARQ = ENV["HARQ"] || File.expand_path("../../../harq", __FILE__)
+  MASTER_PORT = 7631
+  REPLICA_PORT = 7632
+  LINK_PORT = 7633
+  METRICS_PORT = 7634
+
+  # Forwards connections from port to to_port, so a test can cut a
+  # replica off from its master.
+  class Link
+    def initialize(port, to_port)
+      @to_port = to_port
+      @listener = TCPServer.new "127.0.0.1", port
+      @socks = []
+      @thread = Thread.new { loop { forward @listener.accept } }
+    end
+
+    def forward(a)
+      b = TCPSocket.new "127.0.0.1", @to_port
+      @socks << a << b
+
+      [[a, b], [b, a]].each do |from, to|
+        Thread.new do
+          begin
+            loop { to.write from.readpartial(65536) }
+          rescue IOError, SystemCallError
+            from.close rescue nil
+            to.close rescue nil
+          end
+        end
+      end
+    end
+
+    def cut
+      @socks.each { |s| s.close rescue nil }
+      @socks.clear
+    end
+
+    def close
+      @thread.kill
+      @listener.close
+      cut
+    end
+  end
+
   def setup
     @clients = []
+    @servers = []
+    @links = []
+    @dir = nil
   end
 
   def teardown
     @clients.each do |c|
       c.close rescue nil
     end
+
+    @links.each { |l| l.close }
+    @servers.dup.each { |pid| stop_server pid }
+
+    FileUtils.rm_rf @dir if @dir
   end
 
-  def connect
-    c = Harq::Client.new
+  def connect(port=Harq::Client::DEFAULT_PORT)
+    c = Harq::Client.new "localhost", port
     @clients << c
     c
   end
 
+  def start_server(name, port, *args)
+    omit "#{HARQ} isn't built" unless File.executable?(HARQ)
+
+    @dir ||= Dir.mktmpdir
+    dir = File.join(@dir, name)
+    FileUtils.mkdir_p dir
+
+    pid = spawn HARQ, "-p", port.to_s, "-d", File.join(dir, "db"), *args,
+                :chdir => dir, :out => File::NULL, :err => File::NULL
+    @servers << pid
+
+    wait_for do
+      begin
+        TCPSocket.new("localhost", port).close
+        true
+      rescue Errno::ECONNREFUSED
+        false
+      end
+    end
+
+    pid
+  end
+
+  def stop_server(pid)
+    Process.kill :TERM, pid rescue nil
+    Process.wait pid rescue nil
+    @servers.delete pid
+  end
+
+  def wait_for(timeout=5)
+    Timeout.timeout(timeout) do
+      sleep 0.05 until yield
+    end
+  end
+
+  def stat(c, q)
+    c.request_stat q
+    c.read_message.as_stat
+  end
+
+  def metric(port, name)
+    body = Net::HTTP.get("localhost", "/metrics", port)
+    body[/^#{name} (\S+)$/, 1].to_f
+  end
+
   def assert_queue_size(b, size)
     b.request_stat Q
 
@@ -73,4 +174,618 @@ class TestServer < Test::Unit::TestCase
     assert_equal "p2", m.payload
   end
 
+  def test_stat_counters
+    c = connect
+    c.make_ephemeral Q
+    c.queue Q, "p1"
+    c.queue Q, "p2"
+
+    c.request_ack!
+    c.subscribe! Q
+
+    m = c.read_message
+    c.ack m.id
+    c.read_message
+
+    c.request_stat Q
+    s = c.read_message.as_stat
+
+    assert_equal 2, s.enqueued
+    assert_equal 2, s.dequeued
+    assert_equal 1, s.acked
+    assert_equal 1, s.inflight
+    assert_equal 1, s.subscribers
+    assert_equal 4, s.bytes_in
+
+    c.request_stats
+    dump = c.read_message.as_stats
+
+    assert dump.queues.any? { |q| q.name == Q }
+    assert dump.connections.any? { |x| x.inflight == 1 }
+  end
+
+  def test_sync_replicas_holds_confirm
+    q = "#{Q}-sync"
+
+    c = connect
+    c.make_transient q
+    c.sync_replicas q, 1
+
+    c.request_confirm!
+    c.queue q, P
+
+    # No replicas are attached, so nothing can ack it.
+    assert !c.ready?(1)
+  end
+
+  def test_rejects_low_water_above_high_water
+    c = connect
+    c.configure :write_high_water => 10, :write_low_water => 100
+
+    assert_raises(Harq::QueueError) { c.read_message }
+  end
+
+  def test_replica_bootstrap
+    start_server "master", MASTER_PORT
+
+    m = connect MASTER_PORT
+    m.make_durable "#{Q}-d"
+    m.make_transient "#{Q}-t"
+    3.times { |i| m.queue "#{Q}-d", "d#{i}" }
+    2.times { |i| m.queue "#{Q}-t", "t#{i}" }
+    assert_equal 3, stat(m, "#{Q}-d").size
+
+    start_server "replica", REPLICA_PORT, "-m", MASTER_PORT.to_s
+
+    r = connect REPLICA_PORT
+    wait_for { stat(r, "#{Q}-d").size == 3 }
+    wait_for { stat(r, "#{Q}-t").size == 2 }
+
+    # Once it's bootstrapped, changes stream to it as they're made.
+    m.queue "#{Q}-t", "t2"
+    wait_for { stat(r, "#{Q}-t").size == 3 }
+  end
+
+  def test_replica_resumes_after_reconnect
+    q = "#{Q}-resume"
+
+    start_server "master", MASTER_PORT
+
+    link = Link.new LINK_PORT, MASTER_PORT
+    @links << link
+
+    m = connect MASTER_PORT
+    m.make_durable q
+    2.times { |i| m.queue q, "p#{i}" }
+
+    start_server "replica", REPLICA_PORT, "-m", LINK_PORT.to_s
+    r = connect REPLICA_PORT
+    wait_for { stat(r, q).size == 2 }
+
+    link.cut
+
+    2.times { |i| m.queue q, "p#{i + 2}" }
+    assert_equal 4, stat(m, q).size
+
+    # It reconnects by itself and picks up from its last LSN.
+    wait_for { stat(r, q).size == 4 }
+  end
+
+  def test_replica_streams_large_backlogs
+    q = "#{Q}-stream"
+    payload = "x" * 100
+
+    start_server "master", MASTER_PORT
+
+    m = connect MASTER_PORT
+    m.make_transient q
+    1500.times { m.queue q, payload }
+    assert_equal 1500, stat(m, q).size
+
+    # The bootstrap goes out in chunks and the changes after it in many
+    # batch frames, neither of which should stall on an idle server.
+    start_server "replica", REPLICA_PORT, "-m", MASTER_PORT.to_s
+    1500.times { m.queue q, payload }
+
+    r = connect REPLICA_PORT
+    wait_for { stat(r, q).size == 3000 }
+  end
+
+  def test_elided_writes_arent_replicated
+    q = "#{Q}-elide"
+
+    start_server "master", MASTER_PORT, "-G", "0.3", "-M", METRICS_PORT.to_s
+    start_server "replica", REPLICA_PORT, "-m", MASTER_PORT.to_s
+
+    m = connect MASTER_PORT
+    m.make_durable q
+
+    a = connect MASTER_PORT
+    a.request_ack!
+    a.subscribe! q
+
+    20.times do |i|
+      m.queue q, "p#{i}"
+      msg = a.read_message
+      a.ack msg.id
+    end
+
+    a.close
+    m.queue q, "kept"
+
+    # Only the message that outlived the window reaches the replica.
+    r = connect REPLICA_PORT
+    wait_for { stat(r, q).size == 1 }
+
+    # A commit can land mid-loop, so only some of the 20 are elided;
+    # each one that was costs the log both its append and its erase.
+    elided = metric(METRICS_PORT, "harq_elided_writes").to_i
+    assert_operator elided, :>, 0
+
+    written = 20 - elided
+    assert_operator metric(METRICS_PORT, "harq_replication_lsn").to_i,
+                    :<=, 2 + 2 * written + 1
+  end
+
+  def test_coalesced_confirms_only_commit_their_own_writes
+    q = "#{Q}-coalesce"
+    other = "#{Q}-coalesce-other"
+
+    start_server "master", MASTER_PORT, "-G", "30", "-M", METRICS_PORT.to_s
+
+    a = connect MASTER_PORT
+    a.make_durable q
+    a.make_durable other
+    a.queue other, P
+    stat a, other
+
+    c = connect MASTER_PORT
+    c.coalesce_confirms!
+    c.publish_all_confirmed q, [1, 2, 3, 4, 5, 10].map { |id| [P, id] }
+
+    assert_equal [1, 2, 3, 4, 5, 10], Timeout.timeout(5) { c.read_confirms }
+
+    # other wasn't written by c, so its message is still held back and
+    # acking it skips the write.
+    b = connect MASTER_PORT
+    b.request_ack!
+    b.subscribe! other
+    b.ack b.read_message.id
+
+    wait_for { metric(METRICS_PORT, "harq_elided_writes") == 1 }
+  end
+
+  def test_loop_timings_cover_normal_traffic
+    q = "#{Q}-loop"
+
+    start_server "master", MASTER_PORT, "-M", METRICS_PORT.to_s
+
+    c = connect MASTER_PORT
+    c.make_transient q
+    50.times { stat c, q }
+
+    assert_operator metric(METRICS_PORT, "harq_loop_busy_seconds_count"),
+                    :>=, 50
+  end
+
+  def test_sync_confirm_released_by_replica
+    q = "#{Q}-syncrel"
+
+    start_server "master", MASTER_PORT
+    start_server "replica", REPLICA_PORT, "-m", MASTER_PORT.to_s
+
+    m = connect MASTER_PORT
+    m.make_transient q
+    m.sync_replicas q, 1
+
+    m.request_confirm!
+    m.publish_confirmed q, P, 7
+
+    assert_equal 7, Timeout.timeout(5) { m.read_confirm }
+  end
+
+  def test_ttl_expires_messages
+    q = "#{Q}-ttl"
+
+    c = connect
+    c.make_transient q
+    c.queue_ttl q, 100
+
+    c.queue q, "p1"
+    c.queue q, "p2", 5000
+
+    sleep 0.5
+
+    c.request_stat q
+    s = c.read_message.as_stat
+
+    assert_equal 0, s.transient_size
+    assert_equal 2, s.expired
+  end
+
+  def test_ttl_expires_durable_messages_after_restart
+    q = "#{Q}-ttl-restart"
+
+    pid = start_server "ttl", MASTER_PORT
+
+    c = connect MASTER_PORT
+    c.make_durable q
+    c.queue q, "gone", 500
+    c.queue q, "kept"
+    c.close
+
+    stop_server pid
+    start_server "ttl", MASTER_PORT
+
+    c = connect MASTER_PORT
+    wait_for { stat(c, q).expired == 1 }
+
+    s = stat(c, q)
+    assert_equal 1, s.durable_size
+  end
+
+  def test_durable_size_after_restart
+    q = "#{Q}-size-restart"
+
+    pid = start_server "size", MASTER_PORT
+
+    c = connect MASTER_PORT
+    c.make_durable q
+    3.times { c.queue q, P }
+    assert_equal 3, stat(c, q).durable_size
+    c.close
+
+    stop_server pid
+    start_server "size", MASTER_PORT
+
+    c = connect MASTER_PORT
+    assert_equal 3, stat(c, q).durable_size
+  end
+
+  def test_durable_gaps_survive_restart
+    q = "#{Q}-gaps"
+
+    pid = start_server "gaps", MASTER_PORT
+
+    c = connect MASTER_PORT
+    c.make_durable q
+    6.times { |i| c.queue q, "p#{i}" }
+
+    a = connect MASTER_PORT
+    a.request_ack!
+    a.inflight_max = 6
+    a.subscribe! q
+
+    ms = (0...6).map { a.read_message }
+
+    # Punch a hole in the middle and take the newest one off the end.
+    a.ack ms[2].id
+    a.ack ms[5].id
+    sleep 0.2
+    a.close
+    c.close
+
+    stop_server pid
+    start_server "gaps", MASTER_PORT
+
+    c = connect MASTER_PORT
+    assert_equal 4, stat(c, q).durable_size
+    c.queue q, "p6"
+
+    c.subscribe! q
+    assert_equal %w!p0 p1 p3 p4 p6!, (0...5).map { c.read }
+  end
+
+  def test_paused_ack_consumer_still_acks
+    q = "#{Q}-pause-ack"
+
+    start_server "pause", MASTER_PORT, "-Q", "2000"
+
+    o = connect MASTER_PORT
+    o.make_transient q
+
+    # c consumes from the queue it publishes to, so it has to be able to
+    # ack while its publishes are held back.
+    c = connect MASTER_PORT
+    c.request_ack!
+    c.inflight_max = 1
+    c.subscribe! q
+
+    50.times { |i| c.queue q, "%099d" % i }
+
+    sleep 0.3
+    assert_operator stat(o, q).memory_bytes, :<=, 2100
+
+    got = Timeout.timeout(10) do
+      (0...50).map do
+        m = c.read_message
+        c.ack m.id
+        m.payload.to_i
+      end
+    end
+
+    assert_equal (0...50).to_a, got
+  end
+
+  def test_spill_segments_freed_as_they_are_read
+    q = "#{Q}-spill-seg"
+
+    start_server "spill", MASTER_PORT, "-S", "100000"
+    spill = File.join(@dir, "spill", "db.spill")
+
+    c = connect MASTER_PORT
+    c.make_transient q
+
+    payload = "x" * 4096
+    2500.times { |i| c.queue q, "#{i} #{payload}" }
+    stat c, q
+
+    segments = Dir[File.join(spill, "*")].sort_by { |f| f[/\d+$/].to_i }
+    assert_operator segments.size, :>, 1
+
+    c.subscribe! q
+
+    got = (0...1500).map { c.read.to_i }
+
+    # The first segment has been read back by now, so it's gone while
+    # the rest of the queue is still spilled.
+    wait_for { !File.exist?(segments.first) }
+    assert File.exist?(segments.last)
+
+    got += (1500...2500).map { c.read.to_i }
+    assert_equal (0...2500).to_a, got
+  end
+
+  def test_unreadable_spill_segment_only_loses_its_messages
+    q = "#{Q}-spill-bad"
+
+    start_server "spill", MASTER_PORT, "-S", "100000"
+    spill = File.join(@dir, "spill", "db.spill")
+
+    c = connect MASTER_PORT
+    c.make_transient q
+
+    payload = "x" * 4096
+    2500.times { |i| c.queue q, "#{i} #{payload}" }
+    stat c, q
+
+    segments = Dir[File.join(spill, "*")].sort_by { |f| f[/\d+$/].to_i }
+    File.truncate segments.first, 100
+
+    c.subscribe! q
+
+    got = []
+    got << c.read.to_i until got.last == 2499
+
+    # What was in memory and everything after the first segment still
+    # comes through, in order.
+    assert_equal got.sort, got
+    assert_equal 0, got.first
+    assert_operator got.size, :>, 1000
+    assert_operator got.size, :<, 2500
+  end
+
+  def test_scheduled_delivery
+    q = "#{Q}-sched"
+
+    c = connect
+    c.make_transient q
+    c.schedule q, "later", Time.now + 0.5
+    c.queue q, "now"
+
+    c.subscribe! q
+
+    assert_equal "now", c.read
+    assert !c.ready?(0.2)
+    assert_equal "later", c.read
+  end
+
+  def test_scheduled_durable_delivery_survives_write_behind_crash
+    q = "#{Q}-sched-wb"
+
+    pid = start_server "sched", MASTER_PORT, "-G", "30"
+
+    c = connect MASTER_PORT
+    c.make_durable q
+    c.schedule q, "later", Time.now + 0.3
+
+    wait_for { stat(c, q).durable_size == 1 }
+    c.close
+
+    Process.kill :KILL, pid
+    stop_server pid
+
+    start_server "sched", MASTER_PORT
+
+    c = connect MASTER_PORT
+    sleep 0.3
+    assert_equal 1, stat(c, q).durable_size
+  end
+
+  def test_scheduled_transient_messages_count_against_memory
+    q = "#{Q}-sched-mem"
+
+    c = connect
+    c.make_transient q
+    c.schedule q, "x" * 100, Time.now + 0.5
+
+    s = stat(c, q)
+    assert_equal 1, s.scheduled_size
+    assert_equal 100, s.memory_bytes
+
+    wait_for { stat(c, q).transient_size == 1 }
+
+    s = stat(c, q)
+    assert_equal 0, s.scheduled_size
+    assert_equal 100, s.memory_bytes
+  end
+
+  def test_scheduled_durable_messages_are_replicated
+    q = "#{Q}-sched-repl"
+
+    master = start_server "master", MASTER_PORT
+
+    m = connect MASTER_PORT
+    m.make_durable q
+    m.schedule q, "bootstrapped", Time.now + 3
+
+    replica = start_server "replica", REPLICA_PORT, "-m", MASTER_PORT.to_s
+    r = connect REPLICA_PORT
+
+    m.schedule q, "logged", Time.now + 3
+    m.queue q, "now"
+    wait_for { stat(r, q).durable_size == 1 }
+
+    # The master goes before they're due, the replica takes over.
+    Process.kill :KILL, master
+    stop_server master
+    r.close
+    stop_server replica
+
+    start_server "replica", REPLICA_PORT
+    r = connect REPLICA_PORT
+    wait_for(10) { stat(r, q).durable_size == 3 }
+  end
+
+  def test_ack_timeout_redelivers
+    q = "#{Q}-ackto"
+
+    c = connect
+    c.make_transient q
+    c.queue_ack_timeout q, 200
+    c.queue q, P
+
+    a = connect
+    a.request_ack!
+    a.subscribe! q
+
+    m = a.read_message
+    assert_equal P, m.payload
+
+    b = connect
+    b.request_ack!
+    b.subscribe! q
+
+    # a never acks, so b gets it once the timeout passes.
+    m = b.read_message
+    assert_equal P, m.payload
+    assert_equal 1, m.redeliveries
+  end
+
+  def test_ack_timeout_after_consumer_closes
+    q = "#{Q}-ackto-close"
+
+    c = connect
+    c.make_transient q
+    c.queue_ack_timeout q, 200
+    c.queue q, P
+
+    a = connect
+    a.request_ack!
+    a.subscribe! q
+    a.read_message
+    a.close
+
+    # a's deadline fires after it's gone and has to be ignored.
+    sleep 0.4
+
+    b = connect
+    b.request_ack!
+    b.subscribe! q
+
+    m = b.read_message
+    assert_equal P, m.payload
+    assert_equal 1, m.redeliveries
+  end
+
+  def test_weighted_queues_share_a_consumer
+    heavy = "#{Q}-heavy"
+    light = "#{Q}-light"
+
+    c = connect
+    [heavy, light].each do |q|
+      c.make_transient q
+      200.times { c.queue q, q }
+    end
+
+    c.queue_weight heavy, 3
+    c.queue_weight light, 1
+
+    a = connect
+    a.request_ack!
+    a.inflight_max = 4
+    a.subscribe! heavy
+    a.subscribe! light
+
+    counts = Hash.new(0)
+
+    160.times do
+      m = a.read_message
+      counts[m.payload] += 1
+      a.ack m.id
+    end
+
+    ratio = counts[heavy].to_f / counts[light]
+    assert_in_delta 3.0, ratio, 0.5
+  end
+
+  def test_batched_delivery
+    q = "#{Q}-batch"
+
+    c = connect
+    c.make_transient q
+    3.times { |i| c.queue q, "p#{i}" }
+
+    b = connect
+    b.batch! 2
+    b.subscribe! q
+
+    assert_equal %w!p0 p1 p2!, (1..3).map { b.read }
+  end
+
+  def test_batch_bigger_than_high_water_keeps_delivering
+    q = "#{Q}-batch-hw"
+
+    c = connect
+    c.make_transient q
+    20.times { |i| c.queue q, "p#{i}" }
+
+    # The batch goes over high water long before it's full, so only
+    # flushing it lets deliveries carry on.
+    b = connect
+    b.configure :write_high_water => 16, :write_low_water => 0
+    b.batch! 10
+    b.subscribe! q
+
+    got = Timeout.timeout(5) { (0...20).map { b.read } }
+    assert_equal (0...20).map { |i| "p#{i}" }, got
+  end
+
+  def test_unacked_requeued_in_order
+    q = "#{Q}-requeue"
+
+    c = connect
+    c.make_transient q
+    c.queue q, "p1"
+    c.queue q, "p2"
+
+    a = connect
+    a.request_ack!
+    a.inflight_max = 2
+    a.subscribe! q
+
+    assert_equal "p1", a.read
+    assert_equal "p2", a.read
+
+    c.queue q, "p3"
+    a.close
+
+    b = connect
+    b.subscribe! q
+
+    assert_equal "p1", b.read
+    assert_equal "p2", b.read
+    assert_equal "p3", b.read
+  end
+
 end
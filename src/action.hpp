@@ -13,7 +13,10 @@ enum ActionType {
   eMakeDurableQueue = 12,
   eQueueError = 13,
   eBond = 14,
-  eMakeEphemeralQueue = 15
+  eMakeEphemeralQueue = 15,
+  eRequestStatAll = 16,
+  eSetReplication = 17,
+  eSetQueueOptions = 18
 };
 
 #endif
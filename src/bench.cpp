@@ -0,0 +1,216 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <sys/time.h>
+#include <sys/resource.h>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include <iostream>
+#include <sstream>
+#include <list>
+
+#include "message.hpp"
+#include "segment_queue.hpp"
+#include "storage.hpp"
+#include "config.hpp"
+
+#include "wire.pb.h"
+
+// Compares the in-memory queue storage options by queueing and then
+// draining a lot of small messages, the way a transient queue with a
+// slow consumer behaves.
+//
+//   harq bench [count]
+//
+// Or compares the storage engines by writing, reading back and
+// deleting messages the way a durable queue does.
+//
+//   harq bench storage [count] [leveldb path]
+
+static size_t heap_in_use() {
+#ifdef __GLIBC__
+#if __GLIBC_PREREQ(2, 33)
+  struct mallinfo2 mi = mallinfo2();
+#else
+  struct mallinfo mi = mallinfo();
+#endif
+  return mi.uordblks + mi.hblkhd;
+#else
+  struct rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+  return ru.ru_maxrss * 1024;
+#endif
+}
+
+static double elapsed(struct timeval& start) {
+  struct timeval fin, diff;
+  gettimeofday(&fin, 0);
+
+  timersub(&fin, &start, &diff);
+
+  return diff.tv_sec + (diff.tv_usec / 1000000.0);
+}
+
+template <typename Q>
+static void run(const char* name, long count, const wire::Message& proto) {
+  size_t base = heap_in_use();
+
+  struct timeval start;
+  gettimeofday(&start, 0);
+
+  {
+    Q q;
+
+    for(long i = 0; i < count; i++) {
+      q.push_back(Message(proto));
+    }
+
+    double push = elapsed(start);
+    size_t used = heap_in_use() - base;
+
+    gettimeofday(&start, 0);
+
+    size_t bytes = 0;
+
+    while(!q.empty()) {
+      bytes += q.front()->payload().size();
+      q.pop_front();
+    }
+
+    double drain = elapsed(start);
+
+    printf("%-14s push %.3fs (%.0f/s)  drain %.3fs (%.0f/s)  "
+           "%zu bytes/msg  [%zu payload bytes]\n",
+           name, push, count / push, drain, count / drain,
+           used / count, bytes);
+  }
+}
+
+static void run_storage(StorageEngine* engine, long count,
+                        const wire::Message& proto)
+{
+  std::string error;
+
+  if(!engine || !engine->open(error)) {
+    printf("Unable to open storage engine: %s\n", error.c_str());
+    return;
+  }
+
+  std::string val = proto.SerializeAsString();
+  wire::Queue qi;
+
+  struct timeval start;
+  gettimeofday(&start, 0);
+
+  // Every write carries the message and a small index record, like
+  // LevelStore::append_at.
+  for(long i = 0; i < count; i++) {
+    std::stringstream key;
+    key << "-bench:" << i;
+
+    qi.set_size(i + 1);
+
+    StorageBatch batch;
+    batch.put(key.str(), val);
+    batch.put("-bench", qi.SerializeAsString());
+
+    engine->write(batch);
+  }
+
+  double put = elapsed(start);
+  gettimeofday(&start, 0);
+
+  std::string out;
+
+  for(long i = 0; i < count; i++) {
+    std::stringstream key;
+    key << "-bench:" << i;
+
+    engine->get(key.str(), out);
+  }
+
+  double get = elapsed(start);
+  gettimeofday(&start, 0);
+
+  for(long i = 0; i < count; i++) {
+    std::stringstream key;
+    key << "-bench:" << i;
+
+    qi.set_size(count - i - 1);
+
+    StorageBatch batch;
+    batch.del(key.str());
+    batch.put("-bench", qi.SerializeAsString());
+
+    engine->write(batch);
+  }
+
+  double del = elapsed(start);
+
+  printf("%-14s put %.3fs (%.0f/s)  get %.3fs (%.0f/s)  "
+         "delete %.3fs (%.0f/s)\n",
+         engine->name().c_str(), put, count / put, get, count / get,
+         del, count / del);
+}
+
+static int bench_storage(int argc, char** argv) {
+  long count = 100000;
+  std::string path = "harq-bench.db";
+
+  if(argc > 1) count = atol(argv[1]);
+  if(argc > 2) path = argv[2];
+
+  if(count <= 0) {
+    printf("Usage: bench storage [count] [leveldb path]\n");
+    return 1;
+  }
+
+  wire::Message proto;
+  proto.set_destination("bench");
+  proto.set_payload("0123456789abcdef");
+
+  std::cout << "Storing " << count << " messages\n";
+
+  Config cfg("harq-bench.cfg");
+
+  cfg.set_storage_engine("memory");
+  StorageEngine* engine = make_storage_engine(cfg, path);
+  run_storage(engine, count, proto);
+  delete engine;
+
+  cfg.set_storage_engine("leveldb");
+  engine = make_storage_engine(cfg, path);
+  run_storage(engine, count, proto);
+  delete engine;
+
+  return 0;
+}
+
+int bench(int argc, char** argv) {
+  long count = 10000000;
+
+  if(argc > 1 && std::string(argv[1]) == "storage") {
+    return bench_storage(argc - 1, argv + 1);
+  }
+
+  if(argc > 1) count = atol(argv[1]);
+
+  if(count <= 0) {
+    printf("Usage: bench [count]\n");
+    return 1;
+  }
+
+  wire::Message proto;
+  proto.set_destination("bench");
+  proto.set_payload("0123456789abcdef");
+
+  std::cout << "Queueing " << count << " messages\n";
+
+  run<std::list<Message> >("std::list", count, proto);
+  run<SegmentQueue<Message> >("SegmentQueue", count, proto);
+
+  return 0;
+}
@@ -1,6 +1,7 @@
 #include "buffer.hpp"
 
 #include <errno.h>
+#include <string.h>
 
 Buffer::Buffer(size_t size)
   : buffer_(new uint8_t[size])
@@ -12,6 +13,10 @@ Buffer::Buffer(size_t size)
   , slop_pos_(buffer_ + (size / 2))
 {}
 
+Buffer::~Buffer() {
+  delete[] buffer_;
+}
+
 void Buffer::clean_pigpen() {
   size_t unread = write_pos_ - read_pos_;
   if(unread == 0) {
@@ -26,6 +31,34 @@ void Buffer::clean_pigpen() {
   }
 }
 
+// Make room for size bytes from the read position on, so a message
+// bigger than the buffer can still be read in whole.
+void Buffer::reserve(size_t size) {
+  if((size_t)(limit_ - read_pos_) >= size) return;
+
+  size_t capacity = limit_ - buffer_;
+
+  if(size <= capacity) {
+    clean_pigpen();
+    return;
+  }
+
+  if(size < capacity * 2) size = capacity * 2;
+
+  size_t unread = write_pos_ - read_pos_;
+
+  uint8_t* grown = new uint8_t[size];
+  memcpy(grown, read_pos_, unread);
+
+  delete[] buffer_;
+
+  buffer_ = grown;
+  read_pos_ = buffer_;
+  write_pos_ = buffer_ + unread;
+  limit_ = buffer_ + size;
+  slop_pos_ = buffer_ + (size / 2);
+}
+
 ssize_t Buffer::fill(int fd) {
   const size_t left = limit_ - write_pos_;
 
@@ -7,14 +7,19 @@
 #include <iostream>
 
 class Buffer {
-  uint8_t* const buffer_;
+  uint8_t* buffer_;
   uint8_t* read_pos_;
   uint8_t* write_pos_;
   uint8_t* limit_;
   uint8_t* slop_pos_;
 
+  // Not copyable.
+  Buffer(const Buffer&);
+  Buffer& operator=(const Buffer&);
+
 public:
   Buffer(size_t size);
+  ~Buffer();
 
   uint8_t* read_pos() {
     return read_pos_;
@@ -33,6 +38,7 @@ public:
   int read_int32();
 
   void clean_pigpen();
+  void reserve(size_t size);
 
   void advance_read(int size) {
     uint8_t* const ptr = read_pos_ + size;
@@ -39,12 +39,71 @@ private:
 
   unsigned buffer_size_;
 
+  int metrics_port_;
+
+  unsigned write_high_water_;
+  unsigned write_low_water_;
+
+  // 0 means no limit.
+  size_t memory_limit_;
+  size_t queue_memory_limit_;
+
+  // How many payload bytes a transient queue keeps in memory before
+  // it starts spilling to disk. 0 means never spill.
+  size_t spill_threshold_;
+
+  // Where durable queues keep their messages, "leveldb" or "segments".
+  std::string durable_backend_;
+
+  // What the declarations and durable indexes are kept in, "leveldb"
+  // or "memory".
+  std::string storage_engine_;
+
+  // LevelDB tuning. 0 leaves LevelDB's own default in place.
+  size_t cache_size_;
+  int bloom_bits_;
+  size_t write_buffer_size_;
+  bool compression_;
+  int max_open_files_;
+
+  // Seconds between compacting away acked messages, 0 means never.
+  double compact_interval_;
+
+  // Seconds durable appends are held in memory, so a quick ack can
+  // cancel them, before they're written. 0 writes them straight away.
+  double write_behind_;
+
+  // How many durable messages each queue reads ahead of its
+  // consumers. 0 reads them only as they're delivered.
+  unsigned readahead_;
+
+  // How many bytes of recent changes are kept for replicas that
+  // reconnect to resume from.
+  size_t replication_log_size_;
+
 public:
 
   Config(std::string path)
     : path_(path)
     , db_(0)
     , buffer_size_(4096)
+    , metrics_port_(-1)
+    , write_high_water_(1024 * 1024)
+    , write_low_water_(256 * 1024)
+    , memory_limit_(0)
+    , queue_memory_limit_(0)
+    , spill_threshold_(0)
+    , durable_backend_("leveldb")
+    , storage_engine_("leveldb")
+    , cache_size_(32 * 1024 * 1024)
+    , bloom_bits_(10)
+    , write_buffer_size_(0)
+    , compression_(true)
+    , max_open_files_(0)
+    , compact_interval_(60)
+    , write_behind_(0)
+    , readahead_(64)
+    , replication_log_size_(64 * 1024 * 1024)
   {}
 
   ~Config() {
@@ -59,6 +118,139 @@ public:
     return buffer_size_;
   }
 
+  int metrics_port() {
+    return metrics_port_;
+  }
+
+  void set_metrics_port(int port) {
+    metrics_port_ = port;
+  }
+
+  unsigned write_high_water() {
+    return write_high_water_;
+  }
+
+  unsigned write_low_water() {
+    return write_low_water_;
+  }
+
+  void set_write_water(unsigned high, unsigned low) {
+    write_high_water_ = high;
+    write_low_water_ = low;
+  }
+
+  size_t memory_limit() {
+    return memory_limit_;
+  }
+
+  void set_memory_limit(size_t bytes) {
+    memory_limit_ = bytes;
+  }
+
+  size_t queue_memory_limit() {
+    return queue_memory_limit_;
+  }
+
+  void set_queue_memory_limit(size_t bytes) {
+    queue_memory_limit_ = bytes;
+  }
+
+  size_t spill_threshold() {
+    return spill_threshold_;
+  }
+
+  void set_spill_threshold(size_t bytes) {
+    spill_threshold_ = bytes;
+  }
+
+  std::string durable_backend() {
+    return durable_backend_;
+  }
+
+  void set_durable_backend(std::string name) {
+    durable_backend_ = name;
+  }
+
+  std::string storage_engine() {
+    return storage_engine_;
+  }
+
+  void set_storage_engine(std::string name) {
+    storage_engine_ = name;
+  }
+
+  size_t cache_size() {
+    return cache_size_;
+  }
+
+  void set_cache_size(size_t bytes) {
+    cache_size_ = bytes;
+  }
+
+  int bloom_bits() {
+    return bloom_bits_;
+  }
+
+  void set_bloom_bits(int bits) {
+    bloom_bits_ = bits;
+  }
+
+  size_t write_buffer_size() {
+    return write_buffer_size_;
+  }
+
+  void set_write_buffer_size(size_t bytes) {
+    write_buffer_size_ = bytes;
+  }
+
+  bool compression() {
+    return compression_;
+  }
+
+  void set_compression(bool on) {
+    compression_ = on;
+  }
+
+  int max_open_files() {
+    return max_open_files_;
+  }
+
+  void set_max_open_files(int files) {
+    max_open_files_ = files;
+  }
+
+  double compact_interval() {
+    return compact_interval_;
+  }
+
+  void set_compact_interval(double secs) {
+    compact_interval_ = secs;
+  }
+
+  double write_behind() {
+    return write_behind_;
+  }
+
+  void set_write_behind(double secs) {
+    write_behind_ = secs;
+  }
+
+  unsigned readahead() {
+    return readahead_;
+  }
+
+  void set_readahead(unsigned count) {
+    readahead_ = count;
+  }
+
+  size_t replication_log_size() {
+    return replication_log_size_;
+  }
+
+  void set_replication_log_size(size_t bytes) {
+    replication_log_size_ = bytes;
+  }
+
   bool open();
   bool read();
   void close();
@@ -18,16 +18,33 @@
 #include "wire.pb.h"
 #include "debugs.hpp"
 #include "config.hpp"
+#include "replication.hpp"
 
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 
+// How many messages a queue with a weight of 1 gets per round of an
+// ack'ing connection's refill.
+#define REFILL_QUANTUM 8
+
+// How many bytes of publishes a paused ack'ing consumer can send
+// before we stop reading from it.
+#define HELD_PUBLISH_BYTES (1024 * 1024)
+
+// The biggest frame we'll grow the read buffer for.
+#define MAX_FRAME (64 * 1024 * 1024)
+
 #define FLOW(str)
 // #define FLOW(str) debugs << "- " << str << "\n"
 
 Connection::Connection(Server& s, int fd)
-  : tap_(false)
+  : ready_()
+  , ready_set_()
+  , turn_queue_(0)
+  , turn_left_(0)
+  , tap_(false)
   , ack_(false)
   , confirm_(false)
+  , coalesce_confirms_(false)
   , closing_(false)
   , replica_(false)
   , sock_(fd)
@@ -39,14 +56,34 @@ Connection::Connection(Server& s, int fd)
   , state_(eReadSize)
   , writer_started_(false)
   , inflight_max_(1)
+  , high_water_(s.config().write_high_water())
+  , low_water_(s.config().write_low_water())
+  , throttled_(false)
+  , paused_(false)
+  , paused_on_()
+  , held_publishes_()
+  , held_bytes_(0)
+  , held_confirms_()
+  , pending_confirms_()
+  , ack_serial_(0)
+  , batch_max_(0)
+  , batch_bytes_max_(0)
+  , batch_()
+  , batch_size_(0)
+  , batch_w_(s.loop())
+  , wedged_(false)
 {
   read_w_.set<Connection, &Connection::on_readable>(this);
   write_w_.set<Connection, &Connection::on_writable>(this);
+  batch_w_.set<Connection, &Connection::on_batch>(this);
 
   sock_.set_nonblock();
 }
 
 Connection::~Connection() {
+  if(ack_serial_) server_.forget_ack_timeouts(ack_serial_);
+  server_.forget_flushes(this);
+
   if(open_) {
     read_w_.stop();
 
@@ -75,8 +112,12 @@ void Connection::start_replica() {
   FLOW("New Replica Connection");
   read_w_.start(sock_.fd, EV_READ);
 
+  wire::ReplicaStart start;
+  server_.replication().resume_point(start);
+
   wire::ReplicaAction act;
   act.set_type(wire::ReplicaAction::eStart);
+  act.set_payload(start.SerializeAsString());
 
   wire::Message msg;
   msg.set_destination("+replica");
@@ -96,20 +137,100 @@ void Connection::clear_ack(uint64_t id) {
     to_ack_.erase(i);
     debugs << "Successfully acked " << id << "\n";
 
+    wedged_ = false;
+
+    refill();
+  } else {
+    debugs << "Unable to find id " << id << " to clear\n";
+
+    // A late ack for something that timed out still shows we're alive.
+    if(wedged_) {
+      wedged_ = false;
+      refill();
+    }
+  }
+}
+
+// The consumer took longer than the queue allows to ack id, so it goes
+// back to the queue for someone else.
+void Connection::ack_timed_out(uint64_t id) {
+  if(closing_) return;
+
+  AckMap::iterator i = to_ack_.find(id);
+  if(i == to_ack_.end()) return;
+
+  AckRecord rec = i->second;
+  to_ack_.erase(i);
+
+  debugs << "Ack timeout on " << id << ", redelivering\n";
+
+  wedged_ = true;
+  rec.queue.redeliver(rec.msg);
+}
+
+// Pull queued messages from the subscriptions that have them now that
+// we have room, either because of an ack or because the socket
+// drained. With acks, each queue gets up to its weight in quanta per
+// round, and goes to the back of ready_ once it's had its turn. A turn
+// cut short by inflight_max_ carries on at the next refill, so the
+// weights hold even when acks only free a slot or two at a time.
+void Connection::refill() {
+  if(ack_) {
     int capa = inflight_max_ - to_ack_.size();
 
-    for(Queue::List::iterator i = subscriptions_.begin();
-        i != subscriptions_.end();
-        ++i) {
-      capa -= (*i)->flush_at_most(this, capa);
+    while(capa > 0 && !ready_.empty()) {
+      Queue* q = ready_.front();
+
+      if(q != turn_queue_ || turn_left_ <= 0) {
+        turn_queue_ = q;
+        turn_left_ = q->weight() * REFILL_QUANTUM;
+      }
 
-      if(capa == 0) break;
+      int want = turn_left_ < capa ? turn_left_ : capa;
+
+      int got = q->flush_at_most(this, want);
+      capa -= got;
+      turn_left_ -= got;
+
+      // We stopped taking them, so it may still have more.
+      if(throttled_ || wedged_ || closing_) break;
+
+      if(got < want) {
+        ready_.pop_front();
+        ready_set_.erase(q);
+        turn_queue_ = 0;
+      } else if(turn_left_ == 0) {
+        ready_.pop_front();
+        ready_.push_back(q);
+      }
     }
   } else {
-    debugs << "Unable to find id " << id << " to clear\n";
+    Queue::List todo(ready_);
+
+    for(Queue::List::iterator i = todo.begin(); i != todo.end(); ++i) {
+      if(throttled_ || closing_) break;
+
+      // A slice that ran out of messages while we were still taking
+      // them means the queue's empty.
+      if((*i)->flush(this) == 0 && !throttled_ && !closing_) {
+        ready_set_.erase(*i);
+        ready_.remove(*i);
+      }
+    }
   }
 }
 
+void Connection::fill_stat(wire::ConnectionStat& stat) {
+  stat.set_fd(sock_.fd);
+  stat.set_subscriptions(subscriptions_.size());
+  stat.set_inflight(to_ack_.size());
+  stat.set_inflight_max(inflight_max_);
+  stat.set_write_backlog(write_backlog());
+  stat.set_ack(ack_);
+  stat.set_tap(tap_);
+  stat.set_replica(replica_);
+}
+
 void Connection::handle_action(const wire::Action& act) {
   ActionType type = (ActionType)act.type();
 
@@ -130,7 +251,35 @@ void Connection::handle_action(const wire::Action& act) {
         }
         if(cfg.has_ack()) ack_ = cfg.ack();
         if(cfg.has_confirm()) confirm_ = cfg.confirm();
+        if(cfg.has_coalesce_confirms()) {
+          coalesce_confirms_ = cfg.coalesce_confirms();
+        }
         if(cfg.has_inflight()) inflight_max_ = cfg.inflight();
+
+        if(cfg.has_write_high_water() || cfg.has_write_low_water()) {
+          size_t high = high_water_;
+          size_t low = low_water_;
+
+          if(cfg.has_write_high_water()) high = cfg.write_high_water();
+          if(cfg.has_write_low_water()) low = cfg.write_low_water();
+
+          // Throttling would never let up past high water, or flap
+          // on every write with low above it.
+          if(high == 0 || low > high) {
+            send_error("+", "Write low water must be at most high water");
+          } else {
+            high_water_ = high;
+            low_water_ = low;
+            check_low_water();
+          }
+        }
+
+        if(cfg.has_batch_messages() || cfg.has_batch_bytes()) {
+          flush_batch();
+          batch_max_ = cfg.batch_messages();
+          batch_bytes_max_ = cfg.batch_bytes();
+          check_low_water();
+        }
       } else {
         debugs << "Unable to parse configure request\n";
       }
@@ -141,6 +290,7 @@ void Connection::handle_action(const wire::Action& act) {
     if(optref<Queue> q = server_.subscribe(this, act.payload())) {
       debugs << "Subscribed to queue: " << act.payload() << "\n";
       subscriptions_.push_back(q.ptr());
+      queue_ready(q.ptr());
       server_.flush(this, act.payload());
     } else {
       send_error(act.payload(), "No such queue");
@@ -168,6 +318,34 @@ void Connection::handle_action(const wire::Action& act) {
     FLOW("ACT eRequestStat");
     server_.stat(this, act.payload());
     break;
+  case eRequestStatAll:
+    FLOW("ACT eRequestStatAll");
+    server_.stat_all(this);
+    break;
+  case eSetReplication:
+    FLOW("ACT eSetReplication");
+    {
+      wire::QueueReplication qr;
+      if(!qr.ParseFromString(act.payload())) {
+        std::cerr << "Received malformed replication request\n";
+        send_error("+", "Bad replication request");
+      } else if(!server_.set_sync_replicas(qr.queue(), qr.sync_replicas())) {
+        send_error(qr.queue(), "Unable to set replication");
+      }
+    }
+    break;
+  case eSetQueueOptions:
+    FLOW("ACT eSetQueueOptions");
+    {
+      wire::QueueOptions opts;
+      if(!opts.ParseFromString(act.payload())) {
+        std::cerr << "Received malformed queue options\n";
+        send_error("+", "Bad queue options");
+      } else if(!server_.set_queue_options(opts)) {
+        send_error(opts.queue(), "Unable to set queue options");
+      }
+    }
+    break;
   case eMakeBroadcastQueue:
     FLOW("ACT eMakeBroadcastQueue");
     make_queue(act.payload(), Queue::eBroadcast);
@@ -243,19 +421,162 @@ void Connection::handle_replica(const wire::ReplicaAction& act) {
   switch(act.type()) {
   case wire::ReplicaAction::eStart:
     if(!replica_) {
-      server_.add_replica(this);
+      wire::ReplicaStart start;
+      if(!start.ParseFromString(act.payload())) {
+        std::cerr << "Received malformed replica start, bootstrapping\n";
+        start.Clear();
+      }
+
+      server_.add_replica(this, start);
       replica_ = true;
     }
     break;
   case wire::ReplicaAction::eReserve:
     server_.reserve(act.payload());
     break;
+  case wire::ReplicaAction::eEntry:
+    {
+      wire::ReplicaEntry entry;
+      if(entry.ParseFromString(act.payload())) {
+        server_.replication().apply(entry);
+      } else {
+        std::cerr << "Received malformed replica entry\n";
+      }
+    }
+    break;
+  case wire::ReplicaAction::eBatch:
+    server_.replication().apply_batch(act.payload(), act.compressed());
+    break;
+  case wire::ReplicaAction::eAck:
+    server_.replication().acked(this, act.lsn());
+    break;
   default:
     std::cerr << "Received unknown replica action: " << act.type() << "\n";
     return;
   }
 }
 
+// If the sender didn't specify a confirm id, it will be 0 by default,
+// which is fine. They can sort out what that means on their own.
+void Connection::send_confirm(uint64_t id) {
+  wire::Action oa;
+  oa.set_type(eConfirm);
+  oa.set_id(id);
+
+  wire::Message om;
+
+  om.set_destination("+");
+
+  std::string data;
+  if(oa.SerializeToString(&data)) {
+    om.set_payload(data);
+
+    if(write(om)) {
+      debugs << "Sent confirmation of message id " << id << "\n";
+    } else {
+      debugs << "Connection closed while writing confirmation\n";
+    }
+  } else {
+    std::cerr << "Error creating confirmation message: "
+              << oa.InitializationErrorString() << "\n";
+  }
+}
+
+// One eConfirm for all of ids, with runs of consecutive ids as ranges.
+void Connection::send_confirms(const std::vector<uint64_t>& ids) {
+  if(ids.empty()) return;
+
+  if(!coalesce_confirms_ || ids.size() == 1) {
+    for(std::vector<uint64_t>::const_iterator i = ids.begin();
+        i != ids.end();
+        ++i) {
+      send_confirm(*i);
+    }
+
+    return;
+  }
+
+  wire::Confirms confirms;
+  wire::ConfirmRange* range = 0;
+
+  for(std::vector<uint64_t>::const_iterator i = ids.begin();
+      i != ids.end();
+      ++i) {
+    if(range && *i == range->first() + range->count()) {
+      range->set_count(range->count() + 1);
+    } else {
+      range = confirms.add_ranges();
+      range->set_first(*i);
+      range->set_count(1);
+    }
+  }
+
+  wire::Action oa;
+  oa.set_type(eConfirm);
+  oa.set_payload(confirms.SerializeAsString());
+
+  wire::Message om;
+  om.set_destination("+");
+  om.set_payload(oa.SerializeAsString());
+
+  if(write(om)) {
+    debugs << "Sent " << ids.size() << " confirmations\n";
+  } else {
+    debugs << "Connection closed while writing confirmations\n";
+  }
+}
+
+// The publish just delivered is the last change in the replication
+// log, so that's the LSN the replicas have to get to.
+void Connection::add_confirm(uint64_t id, unsigned replicas) {
+  HeldConfirm held;
+  held.id = id;
+  held.lsn = replicas > 0 ? server_.replication().log().next_lsn() - 1 : 0;
+  held.replicas = replicas;
+
+  pending_confirms_.push_back(held);
+}
+
+// Confirm what was published in the read just handled. One commit
+// covers all of their durable writes, and then they're released along
+// with anything already held, in order, as far as replicas allow.
+void Connection::flush_confirms() {
+  if(pending_confirms_.empty()) return;
+
+  // What these publishes wrote has to be on disk before we say it's
+  // safe. Everyone else's writes stay held back for elision.
+  if(!server_.commit_written()) {
+    pending_confirms_.clear();
+    send_error("+", "Unable to write message to durable");
+    return;
+  }
+
+  bool waiting = !held_confirms_.empty();
+
+  held_confirms_.insert(held_confirms_.end(),
+                        pending_confirms_.begin(), pending_confirms_.end());
+  pending_confirms_.clear();
+
+  if(!release_confirms() && !waiting) server_.replication().wait(this);
+}
+
+bool Connection::release_confirms() {
+  std::vector<uint64_t> ids;
+
+  while(!held_confirms_.empty()) {
+    HeldConfirm& held = held_confirms_.front();
+
+    if(!server_.replication().replicated_p(held.lsn, held.replicas)) break;
+
+    ids.push_back(held.id);
+    held_confirms_.pop_front();
+  }
+
+  send_confirms(ids);
+
+  return held_confirms_.empty();
+}
+
 void Connection::handle_message(const Message& msg) {
   std::string dest = msg->destination();
 
@@ -283,32 +604,16 @@ void Connection::handle_message(const Message& msg) {
     Message out = msg;
     if(!server_.deliver(out)) {
       send_error(dest, "No such queue");
-    } else if(confirm_) {
-      // If the sender didn't specify a confirm id, it will
-      // be 0 by default, which is fine. They can sort out what that means
-      // on their own.
-      wire::Action oa;
-      oa.set_type(eConfirm);
-      oa.set_id(msg->confirm_id());
-
-      wire::Message om;
-
-      om.set_destination("+");
-
-      std::string data;
-      if(oa.SerializeToString(&data)) {
-        om.set_payload(data);
-
-        if(write(om)) {
-          debugs << "Sent confirmation of message id "
-                 << msg->confirm_id() << "\n";
-        } else {
-          debugs << "Connection closed while writing confirmation\n";
-        }
-      } else {
-        std::cerr << "Error creating confirmation message: "
-                  << oa.InitializationErrorString() << "\n";
-      }
+      return;
+    }
+
+    if(server_.memory_pressure_p(dest)) pause_reading(dest);
+
+    if(confirm_) {
+      unsigned sync = 0;
+      if(optref<Queue> q = server_.queue(dest)) sync = q->sync_replicas();
+
+      add_confirm(msg->confirm_id(), sync);
     }
   }
 }
@@ -333,11 +638,75 @@ bool Connection::write(const wire::Message& msg) {
   }
 }
 
+// Write msg now, or add it to the batch if we're batching.
+bool Connection::send(const Message& msg) {
+  if(batch_max_ == 0 && batch_bytes_max_ == 0) return write(msg);
+
+  batch_.push_back(msg.serialize());
+  batch_size_ += batch_.back().size();
+
+  if((batch_max_ > 0 && batch_.size() >= batch_max_) ||
+     (batch_bytes_max_ > 0 && batch_size_ >= batch_bytes_max_)) {
+    return flush_batch();
+  }
+
+  batch_w_.start();
+  return true;
+}
+
+bool Connection::flush_batch() {
+  batch_w_.stop();
+
+  if(batch_.empty()) return true;
+
+  wire::MessageBatch mb;
+
+  for(std::vector<std::string>::iterator i = batch_.begin();
+      i != batch_.end();
+      ++i) {
+    mb.add_messages()->swap(*i);
+  }
+
+  batch_.clear();
+  batch_size_ = 0;
+
+  wire::Message frame;
+  frame.set_destination("+batch");
+  frame.set_payload(mb.SerializeAsString());
+
+  return write(frame);
+}
+
+void Connection::on_batch(ev::prepare& w, int revents) {
+  if(closing_) {
+    batch_w_.stop();
+    return;
+  }
+
+  // The batch counts toward high water, so writing it out can be what
+  // brings us back under, and if the socket took it all on_writable
+  // won't run to notice. Whatever the refill batches up has to go out
+  // now too, since we won't be called again until the loop wakes up.
+  do {
+    if(!flush_batch()) return;
+    check_low_water();
+  } while(!batch_.empty() && !closing_);
+}
+
 DeliverStatus Connection::deliver(Message& msg, Queue& from) {
   if(closing_) return eIgnored;
 
+  if(over_high_water_p()) {
+    if(!throttled_) {
+      debugs << "Write backlog over high water, refusing deliveries\n";
+      throttled_ = true;
+    }
+
+    return eIgnored;
+  }
+
   if(ack_) {
-    if(to_ack_.size() >= inflight_max_) return eIgnored;
+    if(wedged_ || to_ack_.size() >= inflight_max_) return eIgnored;
 
     uint64_t id = server_.assign_id(msg.wire());
 
@@ -347,12 +716,17 @@ DeliverStatus Connection::deliver(Message& msg, Queue& from) {
 
     from.recorded_ack(ret.first->second);
 
-    if(!write(msg)) return eIgnored;
+    if(unsigned timeout = from.ack_timeout()) {
+      if(!ack_serial_) ack_serial_ = server_.track_acks(this);
+      server_.ack_later(ack_serial_, id, server_.now() + timeout / 1000.0);
+    }
+
+    if(!send(msg)) return eIgnored;
 
     return eWaitForAck;
   }
 
-  if(!write(msg)) return eIgnored;
+  if(!send(msg)) return eIgnored;
   return eConsumed;
 }
 
@@ -374,8 +748,19 @@ bool Connection::do_read(int revents) {
 
   // debugs << "Read " << recved << " bytes\n";
 
+  server_.track_writes();
+  bool ok = process_buffer();
+  flush_confirms();
+
+  return ok;
+}
+
+bool Connection::process_buffer() {
   // Allow us to parse multiple messages in one read
   for(;;) {
+    // Leave the rest in the buffer until we're resumed.
+    if(paused_ && !read_w_.is_active()) return true;
+
     if(state_ == eReadSize) {
       FLOW("READ SIZE");
 
@@ -387,6 +772,11 @@ bool Connection::do_read(int revents) {
 
       // debugs << "msg size=" << size << "\n";
 
+      if(size < 0 || size > MAX_FRAME) {
+        std::cerr << "Received frame of " << size << " bytes, closing\n";
+        return false;
+      }
+
       need_ = size;
 
       state_ = eReadMessage;
@@ -396,6 +786,7 @@ bool Connection::do_read(int revents) {
 
     if(buffer_.read_available() < need_) {
       FLOW("NEED MORE");
+      buffer_.reserve(need_);
       return true;
     }
 
@@ -407,7 +798,9 @@ bool Connection::do_read(int revents) {
 
     buffer_.advance_read(need_);
 
-    if(ok) {
+    if(ok && paused_ && msg->destination()[0] != '+') {
+      hold_publish(msg);
+    } else if(ok) {
       handle_message(msg);
     } else {
       std::cerr << "Unable to parse request\n";
@@ -424,6 +817,59 @@ void Connection::on_readable(ev::io& w, int revents) {
   if(!do_read(revents)) signal_cleanup();
 }
 
+void Connection::pause_reading(std::string dest) {
+  if(paused_ || closing_) return;
+
+  paused_ = true;
+  paused_on_ = dest;
+
+  // A consumer that we stop reading from can't ack, which would keep
+  // the queue from ever draining, so we only stop taking its publishes.
+  if(ack_ && !subscriptions_.empty()) {
+    debugs << "Holding publishes from an ack'ing consumer\n";
+  } else {
+    read_w_.stop();
+  }
+
+  server_.pause_publisher(this);
+}
+
+void Connection::hold_publish(const Message& msg) {
+  held_publishes_.push_back(msg);
+  held_bytes_ += msg->payload().size();
+
+  if(held_bytes_ >= HELD_PUBLISH_BYTES && read_w_.is_active()) {
+    debugs << "Too many held publishes, pausing reads\n";
+    read_w_.stop();
+  }
+}
+
+void Connection::resume_reading() {
+  if(!paused_) return;
+
+  paused_ = false;
+  paused_on_.clear();
+
+  read_w_.start(sock_.fd, EV_READ);
+
+  // Handle whatever we held or had already read before we were paused,
+  // in order, stopping if that pauses us again.
+  server_.track_writes();
+
+  while(!paused_ && !held_publishes_.empty()) {
+    Message msg = held_publishes_.front();
+    held_publishes_.pop_front();
+    held_bytes_ -= msg->payload().size();
+
+    handle_message(msg);
+  }
+
+  bool ok = process_buffer();
+  flush_confirms();
+
+  if(!ok) signal_cleanup();
+}
+
 void Connection::unsubscribe() {
   for(Queue::List::iterator i = subscriptions_.begin();
       i != subscriptions_.end();
@@ -433,6 +879,26 @@ void Connection::unsubscribe() {
 }
 
 void Connection::cleanup() {
+  // Hand back what's un-ack'd a queue at a time. to_ack_ is keyed by
+  // the id each message was given as it was delivered, so each queue's
+  // messages come out in the order they went out. This happens first
+  // since some of them may be from our ephemeral queues.
+  typedef std::map<Queue*, std::vector<Message> > Requeue;
+  Requeue requeue;
+
+  for(AckMap::iterator i = to_ack_.begin();
+      i != to_ack_.end();
+      ++i) {
+    requeue[&i->second.queue].push_back(i->second.msg);
+  }
+
+  to_ack_.clear();
+
+  for(Requeue::iterator i = requeue.begin(); i != requeue.end(); ++i) {
+    FLOW("Persisting un-ack'd messages");
+    i->first->requeue(i->second);
+  }
+
   for(Queue::List::iterator i = ephemeral_queues_.begin();
       i != ephemeral_queues_.end();
       ++i) {
@@ -440,13 +906,6 @@ void Connection::cleanup() {
   }
 
   ephemeral_queues_.clear();
-
-  for(AckMap::iterator i = to_ack_.begin();
-      i != to_ack_.end();
-      ++i) {
-    FLOW("Persisting un-ack'd message");
-    i->second.queue.deliver(i->second.msg);
-  }
 }
 
 void Connection::signal_cleanup() {
@@ -469,7 +928,7 @@ void Connection::on_writable(ev::io& w, int revents) {
     debugs << "Flushed socket in writable event\n";
     writer_started_ = false;
     write_w_.stop();
-    return;
+    break;
   case eFailure:
     std::cerr << "Error writing to socket in writable event\n";
     signal_cleanup();
@@ -478,7 +937,17 @@ void Connection::on_writable(ev::io& w, int revents) {
     return;
   case eWouldBlock:
     debugs << "Flush didn't finish for writeable event\n";
-    return;
+    break;
+  }
+
+  check_low_water();
+}
+
+void Connection::check_low_water() {
+  if(throttled_ && write_backlog() <= low_water_) {
+    debugs << "Write backlog below low water, accepting deliveries\n";
+    throttled_ = false;
+    refill();
   }
 }
 
@@ -1,10 +1,12 @@
 #ifndef CONNECTION_HPP
 #define CONNECTION_HPP
 
+#include <deque>
 #include <vector>
 #include <list>
 #include <string>
 #include <map>
+#include <set>
 
 #include <ev++.h>
 #include <leveldb/c.h>
@@ -23,6 +25,7 @@ class Message;
 namespace wire {
   class Action;
   class ReplicaAction;
+  class ConnectionStat;
 }
 
 enum DeliverStatus { eIgnored, eWaitForAck, eConsumed };
@@ -33,9 +36,21 @@ public:
 
 private:
   Queue::List subscriptions_;
+
+  // The subscriptions that may have messages for us, in the order a
+  // refill goes round them. Queues add themselves when they hold on to
+  // a message, and refill takes them out once they come up empty.
+  Queue::List ready_;
+  std::set<Queue*> ready_set_;
+
+  // What's left of the turn of the queue at the front of ready_, when
+  // a refill ran out of room partway through it.
+  Queue* turn_queue_;
+  int turn_left_;
   bool tap_;
   bool ack_;
   bool confirm_;
+  bool coalesce_confirms_;
   bool closing_;
   bool replica_;
   Socket sock_;
@@ -60,6 +75,61 @@ private:
 
   int inflight_max_;
 
+  // Once more than high_water_ bytes are waiting to be written we
+  // stop accepting deliveries until on_writable drains us below
+  // low_water_.
+  size_t high_water_;
+  size_t low_water_;
+  bool throttled_;
+
+  // Set when we've stopped reading because dest is over its memory
+  // limit.
+  bool paused_;
+  std::string paused_on_;
+
+  // A paused ack'ing consumer is still read from, so its acks keep the
+  // queue draining, and the publishes it sends meanwhile are held here
+  // until we resume. Once they pass HELD_PUBLISH_BYTES we stop reading
+  // after all.
+  std::deque<Message> held_publishes_;
+  size_t held_bytes_;
+
+  // Confirms waiting until enough replicas have the change at lsn, in
+  // the order they were published. Once one is held, the ones after
+  // it are too so they still go out in order.
+  struct HeldConfirm {
+    uint64_t id;
+    uint64_t lsn;
+    unsigned replicas;
+  };
+
+  std::deque<HeldConfirm> held_confirms_;
+
+  // Publishes from the current read, confirmed together once it's
+  // done.
+  std::vector<HeldConfirm> pending_confirms_;
+
+  // The server's serial for our ack deadlines, 0 until a delivery is
+  // given one. Forgotten when we go so the deadlines are ignored.
+  uint64_t ack_serial_;
+
+  // Deliveries waiting to go out together in one "+batch" frame, which
+  // is written once it reaches batch_max_ messages or batch_bytes_max_
+  // bytes, or from batch_w_ just before the loop blocks.
+  unsigned batch_max_;
+  size_t batch_bytes_max_;
+  std::vector<std::string> batch_;
+  size_t batch_size_;
+  ev::prepare batch_w_;
+
+  // We missed an ack deadline, so nothing more is delivered to us until
+  // we ack something.
+  bool wedged_;
+
+  // Not copyable.
+  Connection(const Connection&);
+  Connection& operator=(const Connection&);
+
 public:
   /*** methods ***/
 
@@ -78,8 +148,27 @@ public:
     return !closing_;
   }
 
+  size_t write_backlog() {
+    return sock_.write_backlog() + batch_size_;
+  }
+
+  bool over_high_water_p() {
+    return write_backlog() >= high_water_;
+  }
+
+  std::string paused_on() {
+    return paused_on_;
+  }
+
+  void pause_reading(std::string dest);
+  void hold_publish(const Message& msg);
+  void resume_reading();
+
+  void fill_stat(wire::ConnectionStat& stat);
+
   void on_readable(ev::io& w, int revents);
   void on_writable(ev::io& w, int revents);
+  void on_batch(ev::prepare& w, int revents);
 
   void start();
   void start_replica();
@@ -90,20 +179,49 @@ public:
   bool WARN_UNUSED write(const wire::Message& msg);
 
   void clear_ack(uint64_t id);
+  void ack_timed_out(uint64_t id);
+
+  // Send whatever held confirms have been replicated enough. Returns
+  // true once none are left.
+  bool release_confirms();
 
   bool make_queue(std::string name, Queue::Kind k);
   void send_error(std::string name, std::string error);
 
   void queue_destroyed(Queue* q) {
     subscriptions_.remove(q);
+
+    if(ready_set_.erase(q) > 0) ready_.remove(q);
+
+    // A new queue could be made at the same address.
+    if(q == turn_queue_) {
+      turn_queue_ = 0;
+      turn_left_ = 0;
+    }
+  }
+
+  void queue_ready(Queue* q) {
+    if(ready_set_.insert(q).second) ready_.push_back(q);
   }
 
   void unsubscribe();
   void cleanup();
 
+  void refill();
+
 private:
   void signal_cleanup();
   bool do_read(int revents);
+  bool process_buffer();
+  void check_low_water();
+
+  bool WARN_UNUSED send(const Message& msg);
+  bool flush_batch();
+
+  void send_confirm(uint64_t id);
+  void send_confirms(const std::vector<uint64_t>& ids);
+  void add_confirm(uint64_t id, unsigned replicas);
+  void flush_confirms();
 
   void handle_message(const Message& msg);
   void handle_action(const wire::Action& act);
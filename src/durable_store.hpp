@@ -0,0 +1,98 @@
+#ifndef DURABLE_STORE_HPP
+#define DURABLE_STORE_HPP
+
+#include <map>
+#include <vector>
+
+#include <stdint.h>
+
+#include "message.hpp"
+
+// Where a durable queue keeps its messages. Each message appended is
+// given an index, which only ever increases within a store, and stays
+// readable until it's erased.
+//
+// Implementations:
+//   LevelStore   - one LevelDB key per message plus a range index.
+//   SegmentStore - append-only segment files with an ack log.
+//
+class DurableStore {
+public:
+  virtual ~DurableStore() {}
+
+  typedef std::map<uint64_t, Message> Appends;
+
+  // Write msg at the end of the store and mark it durable with its
+  // index.
+  bool append(Message& msg) {
+    return append_at(next_index(), msg);
+  }
+
+  // The index the next append will get.
+  virtual uint64_t next_index() = 0;
+
+  // Like append, but at idx, which has to be at or past next_index().
+  // Replicas use this to keep the same indexes as their master.
+  virtual bool append_at(uint64_t idx, Message& msg) = 0;
+
+  // append_at for a batch of messages keyed by index. Each one written
+  // is taken out of msgs, so whatever's left after a failure wasn't.
+  // Stores that can do it in one write override this.
+  virtual bool append_all(Appends& msgs) {
+    while(!msgs.empty()) {
+      Appends::iterator i = msgs.begin();
+
+      if(!append_at(i->first, i->second)) return false;
+
+      msgs.erase(i);
+    }
+
+    return true;
+  }
+
+  // Whether the message at idx is only held in memory so far, waiting
+  // to be written. Those aren't replicated until they are.
+  virtual bool pending_p(uint64_t idx) {
+    return false;
+  }
+
+  virtual bool has(uint64_t idx) = 0;
+
+  // The message at idx has been consumed.
+  virtual bool erase(uint64_t idx) = 0;
+
+  // Erase a batch of messages. Stores that can do it in one write
+  // override this.
+  virtual bool erase_all(const std::vector<uint64_t>& idxs) {
+    bool ok = true;
+
+    for(std::vector<uint64_t>::const_iterator i = idxs.begin();
+        i != idxs.end();
+        ++i) {
+      if(!erase(*i)) ok = false;
+    }
+
+    return ok;
+  }
+
+  // How many messages are stored and not erased.
+  virtual unsigned size() = 0;
+
+  // Erase everything and start the indexes over from 0.
+  virtual bool clear() = 0;
+
+  // Read the first stored message with an index >= from into msg.
+  // Returns false if there isn't one.
+  virtual bool next(uint64_t from, Message& msg) = 0;
+
+  // Reclaim space left behind by erased messages, if enough has built
+  // up to be worth it. Returns true if it did any work.
+  virtual bool compact() = 0;
+
+  // Read in whatever is needed before the first real use. May be
+  // called from the warm-up thread, so it mustn't touch anything but
+  // the store itself and the storage engine.
+  virtual bool warm() = 0;
+};
+
+#endif
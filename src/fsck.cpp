@@ -23,13 +23,11 @@
 #include "flags.hpp"
 #include "debugs.hpp"
 #include "json.hpp"
+#include "level_engine.hpp"
+#include "level_store.hpp"
 
 #include "wire.pb.h"
 
-#include "leveldb/db.h"
-
-using namespace leveldb;
-
 int fsck(int argc, char** argv) {
   const char* path;
 
@@ -41,33 +39,42 @@ int fsck(int argc, char** argv) {
 
   std::cout << "Checking " << path << "...\n";
 
-  Options opts;
-  opts.paranoid_checks = true;
-
-  ReadOptions ro;
-  ro.verify_checksums = true;
+  LevelEngine db(path, true);
 
-  DB* db;
-  Status s = DB::Open(opts, path, &db);
-  if(!s.ok()) {
-    std::cout << "Unable to open: " << s.ToString() << "\n";
+  std::string error;
+  if(!db.open(error)) {
+    std::cout << "Unable to open: " << error << "\n";
     return 1;
   }
 
   std::string val;
   wire::QueueConfiguration cfg;
 
-  s = db->Get(ro, "!harq.config", &val);
-  if(!s.ok()) {
-    std::cout << "Unable to read configuration: " << s.ToString() << "\n";
+  // A database the server hasn't started on since upgrading still has
+  // the declarations in the old blob.
+  switch(db.get(HARQ_CONFIG, val)) {
+  case eMissing:
+    break;
+  case eValid:
+    if(cfg.ParseFromString(val)) break;
+    // fall through
+  case eInvalid:
+    std::cout << "Corrupt configuration detected.\n";
     return 1;
   }
 
-  if(!cfg.ParseFromString(val)) {
-    std::cout << "Corrupt configuration detected.\n";
-    return 1;
+  StorageIterator* iter = db.scan(HARQ_CATALOG);
+
+  for(; iter->valid(); iter->next()) {
+    if(!cfg.add_queues()->ParseFromString(iter->value())) {
+      std::cout << "Corrupt declaration detected '" << iter->key() << "'\n";
+      delete iter;
+      return 1;
+    }
   }
 
+  delete iter;
+
   std::cout << cfg.queues_size() << " queues detected.\n";
 
   bool some_bad = false;
@@ -92,14 +99,18 @@ int fsck(int argc, char** argv) {
       break;
     }
 
-    s = db->Get(ro, decl.name(), &val);
-    if(!s.ok()) {
+    std::string qkey = "-" + decl.name();
+    wire::Queue qi;
+
+    switch(LevelStore::read_index(db, decl.name(), qi)) {
+    case eMissing:
       std::cout << "  Unable to find queue on disk!\n";
-    } else {
-      wire::Queue qi;
-      if(!qi.ParseFromString(val)) {
-        std::cout << "  Queue information corrupt on disk!\n";
-      } else {
+      break;
+    case eInvalid:
+      std::cout << "  Queue information corrupt on disk!\n";
+      break;
+    case eValid:
+      {
         std::cout << "  total messages: " << qi.size() << "\n"
                   << "  ranges:\n";
 
@@ -114,14 +125,13 @@ int fsck(int argc, char** argv) {
         for(int j = 0; j < qi.ranges_size(); j++) {
           const wire::MessageRange& range = qi.ranges(j);
 
-          int fin = range.start() + range.count();
+          uint64_t fin = range.start() + range.count();
 
-          for(int m = range.start(); m < fin; m++) {
+          for(uint64_t m = range.start(); m < fin; m++) {
             std::stringstream tmp;
-            tmp << decl.name() << ":" << m;
+            tmp << qkey << ":" << m;
 
-            s = db->Get(ro, tmp.str(), &val);
-            if(!s.ok()) {
+            if(db.get(tmp.str(), val) != eValid) {
               std::cerr << "Missing message '" << tmp.str() << "'\n";
             } else {
               wire::Message msg;
@@ -0,0 +1,218 @@
+#include "level_engine.hpp"
+#include "config.hpp"
+#include "debugs.hpp"
+
+#include "leveldb/write_batch.h"
+#include "leveldb/cache.h"
+#include "leveldb/filter_policy.h"
+
+#include <sstream>
+
+#include <stdlib.h>
+
+class LevelSnapshot : public StorageSnapshot {
+  LevelSnapshot(const LevelSnapshot&);
+  LevelSnapshot& operator=(const LevelSnapshot&);
+
+public:
+  const leveldb::Snapshot* snap;
+
+  LevelSnapshot(const leveldb::Snapshot* s)
+    : snap(s)
+  {}
+};
+
+class LevelIterator : public StorageIterator {
+  leveldb::Iterator* iter_;
+  std::string prefix_;
+
+  LevelIterator(const LevelIterator&);
+  LevelIterator& operator=(const LevelIterator&);
+
+public:
+  LevelIterator(leveldb::Iterator* iter, std::string prefix)
+    : iter_(iter)
+    , prefix_(prefix)
+  {
+    iter_->Seek(prefix_);
+  }
+
+  ~LevelIterator() {
+    delete iter_;
+  }
+
+  bool valid() {
+    return iter_->Valid() && iter_->key().starts_with(prefix_);
+  }
+
+  void next() {
+    iter_->Next();
+  }
+
+  std::string key() {
+    return iter_->key().ToString();
+  }
+
+  std::string value() {
+    return iter_->value().ToString();
+  }
+};
+
+LevelEngine::LevelEngine(std::string path, bool paranoid)
+  : path_(path)
+  , options_()
+  , read_options_()
+  , write_options_()
+  , db_(0)
+  , cache_(0)
+  , filter_(0)
+{
+  options_.create_if_missing = true;
+
+  if(paranoid) {
+    options_.paranoid_checks = true;
+    read_options_.verify_checksums = true;
+  }
+}
+
+LevelEngine::~LevelEngine() {
+  delete db_;
+  delete cache_;
+  delete filter_;
+}
+
+// Queue messages are written once, read back once and deleted soon
+// after, so most lookups are for keys that are already gone or never
+// existed (bloom filters let those skip the disk entirely) and the
+// block cache mostly helps recovery and durable flushes.
+void LevelEngine::tune(Config& cfg) {
+  if(cfg.cache_size() > 0) {
+    cache_ = leveldb::NewLRUCache(cfg.cache_size());
+    options_.block_cache = cache_;
+  }
+
+  if(cfg.bloom_bits() > 0) {
+    filter_ = leveldb::NewBloomFilterPolicy(cfg.bloom_bits());
+    options_.filter_policy = filter_;
+  }
+
+  if(cfg.write_buffer_size() > 0) {
+    options_.write_buffer_size = cfg.write_buffer_size();
+  }
+
+  if(cfg.max_open_files() > 0) {
+    options_.max_open_files = cfg.max_open_files();
+  }
+
+  options_.compression = cfg.compression() ? leveldb::kSnappyCompression
+                                           : leveldb::kNoCompression;
+}
+
+bool LevelEngine::open(std::string& error) {
+  leveldb::Status s = leveldb::DB::Open(options_, path_, &db_);
+
+  if(!s.ok()) {
+    error = s.ToString();
+    return false;
+  }
+
+  return true;
+}
+
+leveldb::ReadOptions LevelEngine::read_options(const StorageSnapshot* snap) {
+  leveldb::ReadOptions ro = read_options_;
+
+  if(snap) {
+    ro.snapshot = static_cast<const LevelSnapshot*>(snap)->snap;
+  }
+
+  return ro;
+}
+
+DataStatus LevelEngine::get(const std::string& key, std::string& value,
+                            const StorageSnapshot* snap)
+{
+  leveldb::Status s = db_->Get(read_options(snap), key, &value);
+
+  if(s.IsNotFound()) return eMissing;
+  if(s.ok()) return eValid;
+
+  return eInvalid;
+}
+
+bool LevelEngine::write(const StorageBatch& batch) {
+  leveldb::WriteBatch wb;
+
+  const StorageBatch::Ops& ops = batch.ops();
+
+  for(StorageBatch::Ops::const_iterator i = ops.begin();
+      i != ops.end();
+      ++i) {
+    if(i->del) {
+      wb.Delete(i->key);
+    } else {
+      wb.Put(i->key, i->value);
+    }
+  }
+
+  return db_->Write(write_options_, &wb).ok();
+}
+
+StorageIterator* LevelEngine::scan(const std::string& prefix,
+                                   const StorageSnapshot* snap)
+{
+  return new LevelIterator(db_->NewIterator(read_options(snap)), prefix);
+}
+
+const StorageSnapshot* LevelEngine::snapshot() {
+  return new LevelSnapshot(db_->GetSnapshot());
+}
+
+void LevelEngine::release(const StorageSnapshot* snap) {
+  const LevelSnapshot* ls = static_cast<const LevelSnapshot*>(snap);
+
+  db_->ReleaseSnapshot(ls->snap);
+  delete ls;
+}
+
+void LevelEngine::compact(const std::string& start, const std::string& limit) {
+  leveldb::Slice s(start);
+  leveldb::Slice l(limit);
+
+  debugs << "Compacting " << start << " to " << limit << "\n";
+
+  db_->CompactRange(&s, &l);
+}
+
+void LevelEngine::stats(StorageStats& out, std::string& detail) {
+  std::string val;
+
+  for(int level = 0; level < 7; level++) {
+    std::stringstream prop;
+    prop << "leveldb.num-files-at-level" << level;
+
+    if(!db_->GetProperty(prop.str(), &val)) break;
+
+    std::stringstream labels;
+    labels << "{level=\"" << level << "\"}";
+
+    StorageStat st;
+    st.name = "leveldb_files";
+    st.help = "LevelDB table files at each level.";
+    st.labels = labels.str();
+    st.value = strtod(val.c_str(), 0);
+    out.push_back(st);
+  }
+
+  if(db_->GetProperty("leveldb.approximate-memory-usage", &val)) {
+    StorageStat st;
+    st.name = "leveldb_memory_bytes";
+    st.help = "Approximate memory used by LevelDB.";
+    st.value = strtod(val.c_str(), 0);
+    out.push_back(st);
+  }
+
+  if(db_->GetProperty("leveldb.stats", &val)) {
+    detail = val;
+  }
+}
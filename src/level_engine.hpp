@@ -0,0 +1,69 @@
+#ifndef LEVEL_ENGINE_HPP
+#define LEVEL_ENGINE_HPP
+
+#include "storage.hpp"
+
+#include <leveldb/db.h>
+
+class Config;
+
+namespace leveldb {
+  class Cache;
+  class FilterPolicy;
+}
+
+class LevelEngine : public StorageEngine {
+  std::string path_;
+
+  leveldb::Options options_;
+  leveldb::ReadOptions read_options_;
+  leveldb::WriteOptions write_options_;
+
+  leveldb::DB* db_;
+
+  // Owned here since LevelDB doesn't delete them.
+  leveldb::Cache* cache_;
+  const leveldb::FilterPolicy* filter_;
+
+  // Not copyable.
+  LevelEngine(const LevelEngine&);
+  LevelEngine& operator=(const LevelEngine&);
+
+public:
+  // paranoid turns on every check LevelDB has, for fsck.
+  LevelEngine(std::string path, bool paranoid=false);
+  ~LevelEngine();
+
+  std::string name() {
+    return "leveldb";
+  }
+
+  // Apply the settings from cfg. Only has an effect before open().
+  void tune(Config& cfg);
+
+  bool open(std::string& error);
+
+  DataStatus get(const std::string& key, std::string& value,
+                 const StorageSnapshot* snap = 0);
+
+  bool write(const StorageBatch& batch);
+
+  StorageIterator* scan(const std::string& prefix,
+                        const StorageSnapshot* snap = 0);
+
+  const StorageSnapshot* snapshot();
+  void release(const StorageSnapshot* snap);
+
+  void compact(const std::string& start, const std::string& limit);
+
+  bool concurrent_reads_p() {
+    return true;
+  }
+
+  void stats(StorageStats& out, std::string& detail);
+
+private:
+  leveldb::ReadOptions read_options(const StorageSnapshot* snap);
+};
+
+#endif
@@ -0,0 +1,505 @@
+#include "level_store.hpp"
+#include "server.hpp"
+#include "message.hpp"
+#include "debugs.hpp"
+
+#include <sstream>
+#include <iostream>
+
+#include <stdio.h>
+
+// The key a range starting at start is kept under.
+static std::string range_key(const std::string& name, uint64_t start) {
+  char buf[17];
+  snprintf(buf, sizeof(buf), "%016llx", (unsigned long long)start);
+
+  return "-" + name + ":r" + buf;
+}
+
+// One past the last index in qi's ranges, or 0 if there are none.
+static uint64_t ranges_end(const wire::Queue& qi) {
+  if(qi.ranges_size() == 0) return 0;
+
+  const wire::MessageRange& r = qi.ranges(qi.ranges_size() - 1);
+  return r.start() + r.count();
+}
+
+DataStatus LevelStore::read_index(StorageEngine& db, std::string name,
+                                  wire::Queue& qi, bool* legacy)
+{
+  std::string val;
+  DataStatus s = db.get("-" + name, val);
+
+  switch(s) {
+  case eValid:
+    if(!qi.ParseFromString(val)) return eInvalid;
+    break;
+  case eMissing:
+    qi.Clear();
+    qi.set_size(0);
+    break;
+  case eInvalid:
+    return eInvalid;
+  }
+
+  // The old format, with the ranges and size inline.
+  if(qi.ranges_size() > 0) {
+    if(legacy) *legacy = true;
+    return eValid;
+  }
+
+  std::string prefix = "-" + name + ":r";
+  StorageIterator* iter = db.scan(prefix);
+
+  uint64_t size = 0;
+  bool bad = false;
+
+  for(; iter->valid(); iter->next()) {
+    std::string k = iter->key();
+
+    // Something of another queue's whose name starts with ours.
+    if(k.size() != prefix.size() + 16 ||
+        k.find_first_not_of("0123456789abcdef", prefix.size()) !=
+          std::string::npos) {
+      continue;
+    }
+
+    wire::MessageRange* r = qi.add_ranges();
+
+    if(!r->ParseFromString(iter->value())) {
+      bad = true;
+      break;
+    }
+
+    size += r->count();
+  }
+
+  delete iter;
+
+  if(bad) return eInvalid;
+  if(s == eMissing && qi.ranges_size() == 0) return eMissing;
+
+  qi.set_size(size);
+  return eValid;
+}
+
+bool LevelStore::load() {
+  if(loaded_) return true;
+
+  switch(read_index(server_.storage(), name_, index_, &legacy_)) {
+  case eValid:
+    // Ok!
+    break;
+  case eMissing:
+    index_.Clear();
+    index_.set_size(0);
+    break;
+  case eInvalid:
+    std::cerr << "Corrupt queue info for '" << name_ << "' detected!\n";
+    return false;
+  }
+
+  loaded_ = true;
+  return true;
+}
+
+// Add whatever it takes to get from index_ to qi on disk to batch,
+// write it and then take qi as the index.
+//
+// Both sets of ranges are ordered by start, so walking them side by
+// side finds the ranges that went away, the new ones and the ones
+// whose count changed. Usually that's one or two.
+bool LevelStore::write(StorageBatch& batch, wire::Queue& qi) {
+  int i = 0;
+  int j = 0;
+
+  int old_size = legacy_ ? 0 : index_.ranges_size();
+
+  while(i < old_size || j < qi.ranges_size()) {
+    if(j == qi.ranges_size() ||
+        (i < old_size && index_.ranges(i).start() < qi.ranges(j).start())) {
+      batch.del(range_key(name_, index_.ranges(i).start()));
+      i++;
+    } else if(i == old_size ||
+        qi.ranges(j).start() < index_.ranges(i).start()) {
+      batch.put(range_key(name_, qi.ranges(j).start()),
+                qi.ranges(j).SerializeAsString());
+      j++;
+    } else {
+      if(qi.ranges(j).count() != index_.ranges(i).count()) {
+        batch.put(range_key(name_, qi.ranges(j).start()),
+                  qi.ranges(j).SerializeAsString());
+      }
+
+      i++;
+      j++;
+    }
+  }
+
+  // The end of the ranges is the next index, except once the last
+  // ones have been erased, so then it's written down.
+  uint64_t end = ranges_end(qi);
+
+  if(qi.next_index() < end) qi.set_next_index(end);
+
+  if(legacy_ || end < ranges_end(index_)) {
+    wire::Queue head;
+    head.set_size(0);
+    head.set_next_index(qi.next_index());
+
+    batch.put(server_.dname(name_), head.SerializeAsString());
+  }
+
+  if(!server_.storage().write(batch)) return false;
+
+  index_.Swap(&qi);
+  legacy_ = false;
+
+  return true;
+}
+
+std::string LevelStore::key(uint64_t i) {
+  std::stringstream ss;
+  ss << "-";
+  ss << name_;
+  ss << ":";
+  ss << i;
+
+  return ss.str();
+}
+
+unsigned LevelStore::size() {
+  if(!load()) return 0;
+  return index_.size();
+}
+
+// Indexes are never reused, even once every range has been erased,
+// so that anyone scanning forward from an index doesn't miss new
+// messages.
+uint64_t LevelStore::next_index() {
+  if(!load()) return 0;
+
+  uint64_t last_end = ranges_end(index_);
+
+  return last_end > index_.next_index() ? last_end : index_.next_index();
+}
+
+bool LevelStore::has(uint64_t idx) {
+  if(!load()) return false;
+
+  for(int range = 0; range < index_.ranges_size(); range++) {
+    const wire::MessageRange& r = index_.ranges(range);
+
+    if(idx >= r.start() && idx < r.start() + r.count()) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool LevelStore::append_at(uint64_t idx, Message& msg) {
+  if(!load()) {
+    std::cerr << "Corrupt queue info detected, unable to write durable\n";
+    return false;
+  }
+
+  if(idx < next_index()) {
+    std::cerr << "Attempted to append " << idx << " behind the end of "
+              << name_ << "\n";
+    return false;
+  }
+
+  // Work on a copy so that if the write fails we're unchanged.
+  wire::Queue qi = index_;
+
+  if(qi.ranges_size() > 0 && ranges_end(qi) == idx) {
+    wire::MessageRange* r = qi.mutable_ranges(qi.ranges_size() - 1);
+    r->set_count(r->count() + 1);
+  } else {
+    wire::MessageRange* r = qi.add_ranges();
+    r->set_start(idx);
+    r->set_count(1);
+  }
+
+  qi.set_next_index(idx + 1);
+  qi.set_size(qi.size() + 1);
+
+  debugs << "Writing persisted message for " << name_
+         << " (" << idx << ")\n";
+
+  StorageBatch batch;
+  batch.put(key(idx), msg.serialize());
+
+  if(!write(batch, qi)) {
+    std::cerr << "Unable to write message to DB\n";
+    return false;
+  }
+
+  msg.make_durable(idx);
+
+  debugs << "Updated index of " << name_ << "\n";
+  return true;
+}
+
+// Every message and the ranges go in one batch, so each range is only
+// written once.
+bool LevelStore::append_all(Appends& msgs) {
+  if(msgs.empty()) return true;
+
+  if(!load()) {
+    std::cerr << "Corrupt queue info detected, unable to write durable\n";
+    return false;
+  }
+
+  if(msgs.begin()->first < next_index()) {
+    std::cerr << "Attempted to append " << msgs.begin()->first
+              << " behind the end of " << name_ << "\n";
+    return false;
+  }
+
+  wire::Queue qi = index_;
+  StorageBatch batch;
+
+  for(Appends::iterator i = msgs.begin(); i != msgs.end(); ++i) {
+    uint64_t idx = i->first;
+
+    if(qi.ranges_size() > 0 && ranges_end(qi) == idx) {
+      wire::MessageRange* r = qi.mutable_ranges(qi.ranges_size() - 1);
+      r->set_count(r->count() + 1);
+    } else {
+      wire::MessageRange* r = qi.add_ranges();
+      r->set_start(idx);
+      r->set_count(1);
+    }
+
+    batch.put(key(idx), i->second.serialize());
+  }
+
+  qi.set_next_index(msgs.rbegin()->first + 1);
+  qi.set_size(qi.size() + msgs.size());
+
+  debugs << "Writing " << msgs.size() << " persisted messages for "
+         << name_ << "\n";
+
+  if(!write(batch, qi)) {
+    std::cerr << "Unable to write messages to DB\n";
+    return false;
+  }
+
+  for(Appends::iterator i = msgs.begin(); i != msgs.end(); ++i) {
+    i->second.make_durable(i->first);
+  }
+
+  msgs.clear();
+  return true;
+}
+
+bool LevelStore::clear() {
+  if(!load()) return false;
+
+  StorageBatch batch;
+  unsigned count = 0;
+
+  for(int range = 0; range < index_.ranges_size(); range++) {
+    const wire::MessageRange& r = index_.ranges(range);
+
+    for(uint64_t i = r.start(); i < r.start() + r.count(); i++) {
+      batch.del(key(i));
+      count++;
+    }
+  }
+
+  wire::Queue qi;
+  qi.set_size(0);
+  qi.set_next_index(next_index());
+
+  if(!write(batch, qi)) {
+    std::cerr << "Unable to clear " << name_ << "\n";
+    return false;
+  }
+
+  erased_ += count;
+
+  return true;
+}
+
+// Take idx out of qi's ranges. Returns false if it isn't in them.
+static bool remove_index(wire::Queue& qi, uint64_t idx) {
+  google::protobuf::RepeatedPtrField<wire::MessageRange>* ranges =
+    qi.mutable_ranges();
+
+  bool found = false;
+
+  for(int range = 0; range < qi.ranges_size(); range++) {
+    wire::MessageRange* r = ranges->Mutable(range);
+
+    uint64_t start = r->start();
+    uint64_t end = start + r->count();
+
+    if(idx < start || idx >= end) continue;
+
+    // Each case that results in a different range change is seperated
+    // out for clarity.
+    //
+    if(r->count() == 1) {
+      // There was only one message, so we just nuke the range.
+      ranges->DeleteSubrange(range, 1);
+    } else if(idx == start) {
+      // Shrink the range upward.
+      r->set_start(start + 1);
+      r->set_count(r->count() - 1);
+    } else if(idx == end - 1) {
+      // It's the last message, so just decrement count.
+      r->set_count(r->count() - 1);
+    } else {
+      // Ok, it's in the middle, so we have to split the range.
+      r->set_count(idx - start);
+
+      // Make a new record at the end.
+      ranges->Add();
+
+      // Now put the new range into the right position.
+      int target = range + 1;
+
+      // We move from the end towards target, swapping elements
+      // until nr is in the right position.
+      for(int j = ranges->size() - 1; j > target; j--) {
+        ranges->SwapElements(j, j-1);
+      }
+
+      // This will now be our fresh record.
+      wire::MessageRange* nr = ranges->Mutable(target);
+
+      nr->set_start(idx + 1);
+      nr->set_count(end - idx - 1);
+    }
+
+    found = true;
+    break;
+  }
+
+  if(!found) return false;
+
+  qi.set_size(qi.size() - 1);
+  return true;
+}
+
+bool LevelStore::erase(uint64_t idx) {
+  if(!load()) {
+    std::cerr << "Corrupt queue info detected, unable to write durable\n";
+    return false;
+  }
+
+  wire::Queue qi = index_;
+
+  if(!remove_index(qi, idx)) {
+    std::cerr << "Unable to find message " << idx << " in queue " << name_ << "\n";
+    return false;
+  }
+
+  debugs << "Erasing persisted message for " << name_
+         << " (" << idx << ")\n";
+
+  StorageBatch batch;
+  batch.del(key(idx));
+
+  if(!write(batch, qi)) {
+    std::cerr << "Unable to write message to DB\n";
+    return false;
+  }
+
+  erased_++;
+
+  debugs << "Updated index of " << name_ << "\n";
+  return true;
+}
+
+// Every message and the ranges go in one batch, so each range is only
+// written once.
+bool LevelStore::erase_all(const std::vector<uint64_t>& idxs) {
+  if(!load()) {
+    std::cerr << "Corrupt queue info detected, unable to write durable\n";
+    return false;
+  }
+
+  wire::Queue qi = index_;
+  StorageBatch batch;
+  unsigned count = 0;
+
+  for(std::vector<uint64_t>::const_iterator i = idxs.begin();
+      i != idxs.end();
+      ++i) {
+    if(!remove_index(qi, *i)) {
+      std::cerr << "Unable to find message " << *i << " in queue " << name_ << "\n";
+      continue;
+    }
+
+    batch.del(key(*i));
+    count++;
+  }
+
+  if(count == 0) return true;
+
+  if(!write(batch, qi)) {
+    std::cerr << "Unable to erase messages from " << name_ << "\n";
+    return false;
+  }
+
+  erased_ += count;
+
+  return true;
+}
+
+// The keys are "-<queue>:<index>" with the index in decimal, so a run
+// of acked indexes isn't a run of keys. Instead the whole key space of
+// the queue is compacted, once it's fully acked or enough has been
+// erased since the last time to be worth it.
+bool LevelStore::compact() {
+  if(erased_ == 0) return false;
+  if(index_.size() > 0 && erased_ < LEVEL_STORE_COMPACT) return false;
+
+  std::string start = "-" + name_ + ":";
+  std::string limit = "-" + name_ + ";";
+
+  server_.storage().compact(start, limit);
+
+  erased_ = 0;
+  return true;
+}
+
+bool LevelStore::next(uint64_t from, Message& msg) {
+  if(!load()) return false;
+
+  for(int range = 0; range < index_.ranges_size(); range++) {
+    const wire::MessageRange& r = index_.ranges(range);
+
+    uint64_t start = r.start();
+    uint64_t end = start + r.count();
+
+    if(end <= from) continue;
+
+    for(uint64_t cur = start > from ? start : from; cur < end; cur++) {
+      std::string k = key(cur);
+
+      msg = Message(cur);
+
+      switch(server_.read_message(k, msg)) {
+      case eValid:
+        return true;
+      case eMissing:
+        std::cerr << "Unable to get " << k << ". Corrupt QueueInfo?\n";
+        // TODO: Keep going since we assuming haven't lost anything
+        // and we'll fix the Queue later.
+        break;
+      case eInvalid:
+        std::cerr << "Encountered corrupt message on disk\n";
+        // TODO: what should I do here? Delete it? Keep it around and
+        // make the data fairy fixes it? HMMM....
+        break;
+      }
+    }
+  }
+
+  return false;
+}
@@ -0,0 +1,79 @@
+#ifndef LEVEL_STORE_HPP
+#define LEVEL_STORE_HPP
+
+#include <string>
+#include <vector>
+
+#include "durable_store.hpp"
+#include "storage.hpp"
+
+#include "wire.pb.h"
+
+class Server;
+
+// How many erased messages in a queue that still has messages in it
+// make it worth compacting.
+#define LEVEL_STORE_COMPACT 10000
+
+// Keeps each message under its own key ("-<queue>:<index>") and the
+// set of live indexes as ranges, each under its own key
+// ("-<queue>:r<start>", the start in fixed width hex so they scan in
+// order). "-<queue>" holds a wire::Queue with just the next index, so
+// it survives the ranges at the end being erased.
+//
+// The index is read once, the first time it's needed, and then kept
+// in memory. Every change writes the messages and only the ranges it
+// touched in one batch, so a write costs the same no matter how
+// fragmented the queue is.
+class LevelStore : public DurableStore {
+  Server& server_;
+  std::string name_;
+
+  wire::Queue index_;
+  bool loaded_;
+
+  // The index was found in the old format, all the ranges in
+  // "-<queue>". The next write moves them to their own keys.
+  bool legacy_;
+
+  // Messages erased since the last compaction, each leaving a
+  // tombstone behind in LevelDB.
+  unsigned erased_;
+
+public:
+  LevelStore(Server& s, std::string name)
+    : server_(s)
+    , name_(name)
+    , index_()
+    , loaded_(false)
+    , legacy_(false)
+    , erased_(0)
+  {}
+
+  uint64_t next_index();
+  bool append_at(uint64_t idx, Message& msg);
+  bool append_all(Appends& msgs);
+  bool has(uint64_t idx);
+  bool erase(uint64_t idx);
+  bool erase_all(const std::vector<uint64_t>& idxs);
+  unsigned size();
+  bool clear();
+  bool next(uint64_t from, Message& msg);
+  bool compact();
+
+  bool warm() {
+    return load();
+  }
+
+  // Read the index of queue name from db, in either format. legacy
+  // is set if it's the old one.
+  static DataStatus read_index(StorageEngine& db, std::string name,
+                               wire::Queue& qi, bool* legacy = 0);
+
+private:
+  bool load();
+  std::string key(uint64_t idx);
+  bool write(StorageBatch& batch, wire::Queue& qi);
+};
+
+#endif
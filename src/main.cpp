@@ -11,6 +11,7 @@
 #include "util.hpp"
 #include "server.hpp"
 #include "connection.hpp"
+#include "replication.hpp"
 #include "config.hpp"
 
 extern char *optarg;
@@ -19,6 +20,7 @@ Server *server=NULL;
 
 extern int cli(int argc, char** argv);
 extern int fsck(int argc, char** argv);
+extern int bench(int argc, char** argv);
 
 int main(int argc, char** argv) {
   if(argv[1] && strcmp(argv[1], "cli") == 0) {
@@ -29,17 +31,38 @@ int main(int argc, char** argv) {
     return fsck(argc-1,argv+1);
   }
 
+  if(argv[1] && strcmp(argv[1], "bench") == 0) {
+    return bench(argc-1,argv+1);
+  }
+
   bool daemon = false;
 
   std::string host = "";
 
   int port=7621;
   int master_port = -1;
+  int metrics_port = -1;
+  int high_water = -1;
+  long memory_limit = 0;
+  long queue_memory_limit = 0;
+  long spill_threshold = 0;
 
   std::string data_dir = "harq.db";
+  std::string backend = "leveldb";
+  std::string engine = "leveldb";
+
+  long cache_size = -1;
+  int bloom_bits = -1;
+  long write_buffer_size = 0;
+  bool compression = true;
+  int max_open_files = 0;
+  double compact_interval = -1;
+  long replication_log_size = 0;
+  double write_behind = 0;
+  int readahead = -1;
 
   int ch = 0;
-  while((ch = getopt(argc, argv, "hDb:p:d:m:")) != -1) {
+  while((ch = getopt(argc, argv, "hDb:p:d:m:M:W:L:Q:S:B:E:C:F:w:zo:c:R:G:A:")) != -1) {
     switch(ch) {
     default:
     case 'h':
@@ -50,7 +73,23 @@ int main(int argc, char** argv) {
         << "\t-b host-ip:\t listen host\n"
         << "\t-p port:\t listen port\n"
         << "\t-d data-dir:\t data dir\n"
-        << "\t-m master:\t master\n";
+        << "\t-m master:\t master\n"
+        << "\t-M port:\t serve metrics on port\n"
+        << "\t-W bytes:\t per connection write high water\n"
+        << "\t-L bytes:\t memory limit for all queues\n"
+        << "\t-Q bytes:\t memory limit per queue\n"
+        << "\t-S bytes:\t spill transient queues to disk past this\n"
+        << "\t-B backend:\t durable storage, leveldb or segments\n"
+        << "\t-E engine:\t storage engine, leveldb or memory\n"
+        << "\t-C bytes:\t LevelDB block cache size\n"
+        << "\t-F bits:\t LevelDB bloom filter bits per key, 0 for none\n"
+        << "\t-w bytes:\t LevelDB write buffer size\n"
+        << "\t-z:\t\t disable LevelDB compression\n"
+        << "\t-o files:\t LevelDB max open files\n"
+        << "\t-c secs:\t compact acked messages this often, 0 for never\n"
+        << "\t-R bytes:\t changes kept for reconnecting replicas\n"
+        << "\t-G secs:\t hold durable writes this long so acks can cancel them\n"
+        << "\t-A count:\t durable messages read ahead per queue, 0 for none\n";
 
       exit(0);
     case 'D':
@@ -72,6 +111,66 @@ int main(int argc, char** argv) {
     case 'm':
       master_port = atoi(optarg);
       break;
+    case 'M':
+      metrics_port = atoi(optarg);
+      break;
+    case 'W':
+      high_water = atoi(optarg);
+      if(high_water <= 0) {
+        printf("Bad write high water(-W) value\n");
+        exit(1);
+      }
+      break;
+    case 'L':
+      memory_limit = strtol(optarg, (char **)NULL, 10);
+      break;
+    case 'Q':
+      queue_memory_limit = strtol(optarg, (char **)NULL, 10);
+      break;
+    case 'S':
+      spill_threshold = strtol(optarg, (char **)NULL, 10);
+      break;
+    case 'B':
+      backend = optarg;
+      if(backend != "leveldb" && backend != "segments") {
+        printf("Bad durable backend(-B) value\n");
+        exit(1);
+      }
+      break;
+    case 'E':
+      engine = optarg;
+      if(engine != "leveldb" && engine != "memory") {
+        printf("Bad storage engine(-E) value\n");
+        exit(1);
+      }
+      break;
+    case 'C':
+      cache_size = strtol(optarg, (char **)NULL, 10);
+      break;
+    case 'F':
+      bloom_bits = atoi(optarg);
+      break;
+    case 'w':
+      write_buffer_size = strtol(optarg, (char **)NULL, 10);
+      break;
+    case 'z':
+      compression = false;
+      break;
+    case 'o':
+      max_open_files = atoi(optarg);
+      break;
+    case 'c':
+      compact_interval = strtod(optarg, (char **)NULL);
+      break;
+    case 'R':
+      replication_log_size = strtol(optarg, (char **)NULL, 10);
+      break;
+    case 'G':
+      write_behind = strtod(optarg, (char **)NULL);
+      break;
+    case 'A':
+      readahead = atoi(optarg);
+      break;
     }
   }
 
@@ -96,11 +195,34 @@ int main(int argc, char** argv) {
   cfg.show();
   */
 
+  cfg.set_metrics_port(metrics_port);
+
+  if(high_water > 0) cfg.set_write_water(high_water, high_water / 4);
+  if(memory_limit > 0) cfg.set_memory_limit(memory_limit);
+  if(queue_memory_limit > 0) cfg.set_queue_memory_limit(queue_memory_limit);
+  if(spill_threshold > 0) cfg.set_spill_threshold(spill_threshold);
+
+  cfg.set_durable_backend(backend);
+  cfg.set_storage_engine(engine);
+
+  if(cache_size >= 0) cfg.set_cache_size(cache_size);
+  if(bloom_bits >= 0) cfg.set_bloom_bits(bloom_bits);
+  if(write_buffer_size > 0) cfg.set_write_buffer_size(write_buffer_size);
+  if(max_open_files > 0) cfg.set_max_open_files(max_open_files);
+  if(compact_interval >= 0) cfg.set_compact_interval(compact_interval);
+  if(write_behind > 0) cfg.set_write_behind(write_behind);
+  if(readahead >= 0) cfg.set_readahead(readahead);
+  if(replication_log_size > 0) {
+    cfg.set_replication_log_size(replication_log_size);
+  }
+
+  cfg.set_compression(compression);
+
   Server server(cfg, data_dir, host, port);
   if(!server.read_queues()) return 1;
 
   if(master_port > 0) {
-    server.connect_replica("localhost", master_port);
+    server.replication().follow("localhost", master_port);
   }
   server.start();
 
@@ -0,0 +1,107 @@
+#include "memory_engine.hpp"
+
+// Snapshots are a full copy. They're only taken for rare, whole store
+// operations, so that's cheaper overall than versioning every write.
+class MemorySnapshot : public StorageSnapshot {
+public:
+  MemoryEngine::Data data;
+
+  MemorySnapshot(const MemoryEngine::Data& d)
+    : data(d)
+  {}
+};
+
+class MemoryIterator : public StorageIterator {
+  MemoryEngine::Data::const_iterator cur_;
+  MemoryEngine::Data::const_iterator end_;
+  std::string prefix_;
+
+public:
+  MemoryIterator(const MemoryEngine::Data& data, std::string prefix)
+    : cur_(data.lower_bound(prefix))
+    , end_(data.end())
+    , prefix_(prefix)
+  {}
+
+  bool valid() {
+    return cur_ != end_ && cur_->first.compare(0, prefix_.size(), prefix_) == 0;
+  }
+
+  void next() {
+    ++cur_;
+  }
+
+  std::string key() {
+    return cur_->first;
+  }
+
+  std::string value() {
+    return cur_->second;
+  }
+};
+
+DataStatus MemoryEngine::get(const std::string& key, std::string& value,
+                             const StorageSnapshot* snap)
+{
+  const Data& data = snap ? static_cast<const MemorySnapshot*>(snap)->data
+                          : data_;
+
+  Data::const_iterator i = data.find(key);
+  if(i == data.end()) return eMissing;
+
+  value = i->second;
+  return eValid;
+}
+
+bool MemoryEngine::write(const StorageBatch& batch) {
+  const StorageBatch::Ops& ops = batch.ops();
+
+  for(StorageBatch::Ops::const_iterator i = ops.begin();
+      i != ops.end();
+      ++i) {
+    Data::iterator cur = data_.find(i->key);
+
+    if(cur != data_.end()) {
+      bytes_ -= cur->first.size() + cur->second.size();
+      data_.erase(cur);
+    }
+
+    if(!i->del) {
+      data_[i->key] = i->value;
+      bytes_ += i->key.size() + i->value.size();
+    }
+  }
+
+  return true;
+}
+
+StorageIterator* MemoryEngine::scan(const std::string& prefix,
+                                    const StorageSnapshot* snap)
+{
+  const Data& data = snap ? static_cast<const MemorySnapshot*>(snap)->data
+                          : data_;
+
+  return new MemoryIterator(data, prefix);
+}
+
+const StorageSnapshot* MemoryEngine::snapshot() {
+  return new MemorySnapshot(data_);
+}
+
+void MemoryEngine::release(const StorageSnapshot* snap) {
+  delete static_cast<const MemorySnapshot*>(snap);
+}
+
+void MemoryEngine::stats(StorageStats& out, std::string& detail) {
+  StorageStat st;
+
+  st.name = "memory_engine_keys";
+  st.help = "Keys held by the memory storage engine.";
+  st.value = data_.size();
+  out.push_back(st);
+
+  st.name = "memory_engine_bytes";
+  st.help = "Key and value bytes held by the memory storage engine.";
+  st.value = bytes_;
+  out.push_back(st);
+}
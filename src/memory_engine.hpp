@@ -0,0 +1,54 @@
+#ifndef MEMORY_ENGINE_HPP
+#define MEMORY_ENGINE_HPP
+
+#include <map>
+
+#include "storage.hpp"
+
+// Everything kept in a std::map. Nothing survives a restart, which
+// makes it handy for tests and for benchmarking the rest of the
+// broker without disk in the way.
+class MemoryEngine : public StorageEngine {
+public:
+  typedef std::map<std::string, std::string> Data;
+
+private:
+  Data data_;
+  size_t bytes_;
+
+public:
+  MemoryEngine()
+    : data_()
+    , bytes_(0)
+  {}
+
+  std::string name() {
+    return "memory";
+  }
+
+  bool open(std::string& error) {
+    return true;
+  }
+
+  DataStatus get(const std::string& key, std::string& value,
+                 const StorageSnapshot* snap = 0);
+
+  bool write(const StorageBatch& batch);
+
+  StorageIterator* scan(const std::string& prefix,
+                        const StorageSnapshot* snap = 0);
+
+  const StorageSnapshot* snapshot();
+  void release(const StorageSnapshot* snap);
+
+  // Deleted keys are gone immediately, nothing to do.
+  void compact(const std::string& start, const std::string& limit) {}
+
+  bool concurrent_reads_p() {
+    return false;
+  }
+
+  void stats(StorageStats& out, std::string& detail);
+};
+
+#endif
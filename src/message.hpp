@@ -4,32 +4,40 @@
 #include "wire.pb.h"
 
 class Message {
+  // Every queued message carries one of these, so keep it small. The
+  // durable key isn't kept since it's derived from the index.
   struct Data {
     int refs;
+    bool durable;
+
     wire::Message wire;
 
-    bool durable;
-    std::string key;
     uint64_t index;
 
+    // When the message entered the server, 0 if unknown (ie, it
+    // was read back off disk).
+    double stamp;
+
     Data()
       : refs(1)
       , durable(false)
       , index(0)
+      , stamp(0)
     {}
 
     Data(const wire::Message& m)
       : refs(1)
-      , wire(m)
       , durable(false)
+      , wire(m)
       , index(0)
+      , stamp(0)
     {}
   
-    Data(std::string k, uint64_t i)
+    Data(uint64_t i)
       : refs(1) 
       , durable(true)
-      , key(k)
       , index(i)
+      , stamp(0)
     {}
   };
 
@@ -45,8 +53,9 @@ public:
     : data_(new Data(m))
   {}
 
-  Message(std::string k, uint64_t i)
-    : data_(new Data(k, i))
+  explicit
+  Message(uint64_t i)
+    : data_(new Data(i))
   {}
 
   Message(const Message& other)
@@ -91,21 +100,24 @@ public:
     return data_->wire;
   }
 
-  bool durable_p() {
+  bool durable_p() const {
     return data_->durable;
   }
 
-  std::string key() {
-    return data_->key;
+  uint64_t index() const {
+    return data_->index;
   }
 
-  uint64_t index() {
-    return data_->index;
+  double stamp() const {
+    return data_->stamp;
+  }
+
+  void set_stamp(double t) {
+    data_->stamp = t;
   }
 
-  void make_durable(std::string k, uint64_t i) {
+  void make_durable(uint64_t i) {
     data_->durable = true;
-    data_->key = k;
     data_->index = i;
   }
 
@@ -0,0 +1,61 @@
+#ifndef METER_HPP
+#define METER_HPP
+
+#include <stdint.h>
+
+static const double cMeterWindow = 1.0;
+
+// A monotonic counter that also knows roughly how fast it's moving.
+//
+// The rate is computed lazily over fixed windows from the timestamps
+// passed in (normally ev_now), so marking is a couple of adds and
+// reading never needs a timer to have fired.
+//
+class Meter {
+  uint64_t count_;
+  uint64_t window_count_;
+  double window_start_;
+  double rate_;
+
+public:
+  Meter()
+    : count_(0)
+    , window_count_(0)
+    , window_start_(0)
+    , rate_(0)
+  {}
+
+  uint64_t count() const {
+    return count_;
+  }
+
+  void mark(double now, uint64_t n=1) {
+    roll(now);
+    count_ += n;
+    window_count_ += n;
+  }
+
+  double rate(double now) {
+    roll(now);
+    return rate_;
+  }
+
+private:
+  void roll(double now) {
+    double elapsed = now - window_start_;
+    if(elapsed < cMeterWindow) return;
+
+    // If we skipped a whole window without any marks, then the last
+    // full window was empty.
+    if(elapsed < cMeterWindow * 2) {
+      rate_ = window_count_ / elapsed;
+    } else {
+      rate_ = 0;
+    }
+
+    window_count_ = 0;
+    window_start_ = now;
+  }
+};
+
+#endif
@@ -0,0 +1,545 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <errno.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include <iostream>
+#include <sstream>
+
+
+#include "debugs.hpp"
+#include "util.hpp"
+#include "server.hpp"
+#include "replication.hpp"
+#include "connection.hpp"
+#include "metrics.hpp"
+
+#include "wire.pb.h"
+
+// How many queues are rendered per writable event.
+#define SLICE_QUEUES 1000
+
+#define MAX_REQUEST 8192
+
+// How long a scrape can go without reading or writing anything before
+// it's closed.
+#define SCRAPE_IDLE_SECONDS 10.0
+
+struct Family {
+  const char* name;
+  const char* type;
+  const char* help;
+};
+
+static const Family cQueueFamilies[METRICS_QUEUE_FAMILIES] = {
+  { "harq_queue_messages", "gauge", "Messages held in memory." },
+  { "harq_queue_durable_messages", "gauge", "Messages held in durable storage." },
+  { "harq_queue_enqueued_total", "counter", "Messages published to the queue." },
+  { "harq_queue_dequeued_total", "counter", "Messages handed to subscribers." },
+  { "harq_queue_acked_total", "counter", "Messages acknowledged by subscribers." },
+  { "harq_queue_redelivered_total", "counter", "Un-ack'd messages returned to the queue." },
+  { "harq_queue_bytes_in_total", "counter", "Payload bytes published to the queue." },
+  { "harq_queue_bytes_out_total", "counter", "Payload bytes handed to subscribers." },
+  { "harq_queue_subscribers", "gauge", "Connections subscribed to the queue." },
+  { "harq_queue_inflight", "gauge", "Messages delivered but not yet ack'd." },
+  { "harq_queue_oldest_message_age_seconds", "gauge", "Age of the oldest message held in memory." },
+  { "harq_queue_write_backlog_bytes", "gauge", "Bytes waiting to be written to subscribers." },
+  { "harq_queue_memory_bytes", "gauge", "Payload bytes held in memory." },
+  { "harq_queue_spilled_messages", "gauge", "Transient messages spilled to disk." },
+  { "harq_queue_expired_total", "counter", "Messages dropped once their ttl ran out." }
+};
+
+// Upper bounds of the loop latency histogram, the last bucket is +Inf.
+static const double cLatencyBounds[METRICS_LATENCY_BUCKETS - 1] = {
+  0.0001, 0.001, 0.01, 0.1, 1.0
+};
+
+static void write_family(std::string& out, const char* name,
+                         const char* type, const char* help)
+{
+  out += "# HELP ";
+  out += name;
+  out += ' ';
+  out += help;
+  out += "\n# TYPE ";
+  out += name;
+  out += ' ';
+  out += type;
+  out += '\n';
+}
+
+static void write_sample(std::string& out, const char* name,
+                         const std::string& labels, double val)
+{
+  char buf[32];
+  snprintf(buf, sizeof(buf), " %.15g\n", val);
+
+  out += name;
+  out += labels;
+  out += buf;
+}
+
+static void write_sample(std::string& out, const char* name, double val) {
+  write_sample(out, name, std::string(), val);
+}
+
+static void write_gauge(std::string& out, const char* name,
+                        const char* help, double val)
+{
+  write_family(out, name, "gauge", help);
+  write_sample(out, name, val);
+}
+
+static std::string queue_labels(const std::string& name) {
+  std::string out = "{queue=\"";
+
+  for(std::string::const_iterator i = name.begin();
+      i != name.end();
+      ++i) {
+    switch(*i) {
+    case '\\':
+      out += "\\\\";
+      break;
+    case '"':
+      out += "\\\"";
+      break;
+    case '\n':
+      out += "\\n";
+      break;
+    default:
+      out += *i;
+    }
+  }
+
+  out += "\"}";
+  return out;
+}
+
+Scrape::Scrape(Metrics& m, Server& s, int fd)
+  : metrics_(m)
+  , server_(s)
+  , fd_(fd)
+  , io_w_(s.loop())
+  , idle_w_(s.loop())
+  , state_(eReadRequest)
+  , request_()
+  , cursor_()
+  , started_(false)
+  , out_()
+{
+  io_w_.set<Scrape, &Scrape::on_io>(this);
+  idle_w_.set<Scrape, &Scrape::on_idle>(this);
+}
+
+Scrape::~Scrape() {
+  io_w_.stop();
+  idle_w_.stop();
+  close(fd_);
+}
+
+void Scrape::start() {
+  io_w_.start(fd_, EV_READ);
+
+  idle_w_.set(SCRAPE_IDLE_SECONDS, SCRAPE_IDLE_SECONDS);
+  idle_w_.again();
+}
+
+void Scrape::on_idle(ev::timer& w, int revents) {
+  debugs << "Metrics scrape timed out\n";
+  metrics_.finished(this);
+}
+
+// We serve the same thing for any path, so all we care about is
+// seeing the end of the request headers.
+bool Scrape::read_request() {
+  char buf[1024];
+
+  for(;;) {
+    ssize_t got = recv(fd_, buf, sizeof(buf), 0);
+
+    if(got == 0) return false;
+
+    if(got < 0) {
+      if(errno == EINTR) continue;
+      if(errno == EAGAIN || errno == EWOULDBLOCK) return true;
+      return false;
+    }
+
+    request_.append(buf, got);
+
+    if(request_.find("\r\n\r\n") != std::string::npos ||
+       request_.find("\n\n") != std::string::npos ||
+       request_.size() > MAX_REQUEST) {
+      state_ = eRender;
+      request_.clear();
+      return true;
+    }
+  }
+}
+
+void Scrape::render_queue_header() {
+  for(int i = 0; i < METRICS_QUEUE_FAMILIES; i++) {
+    write_family(families_[i], cQueueFamilies[i].name,
+                 cQueueFamilies[i].type, cQueueFamilies[i].help);
+  }
+}
+
+// Render the next SLICE_QUEUES queues. We resume by name rather than
+// keeping an iterator since queues can be destroyed between slices.
+// Returns true once every queue has been rendered.
+bool Scrape::render_slice() {
+  Server::Queues& queues = server_.queues();
+  Server::Queues::iterator i;
+
+  if(started_) {
+    i = queues.upper_bound(cursor_);
+  } else {
+    i = queues.begin();
+    started_ = true;
+  }
+
+  wire::Stat stat;
+
+  for(int n = 0; i != queues.end() && n < SLICE_QUEUES; ++i, ++n) {
+    stat.Clear();
+    i->second->fill_stat(stat);
+
+    std::string labels = queue_labels(i->first);
+
+    double vals[METRICS_QUEUE_FAMILIES] = {
+      (double)stat.transient_size(),
+      (double)stat.durable_size(),
+      (double)stat.enqueued(),
+      (double)stat.dequeued(),
+      (double)stat.acked(),
+      (double)stat.redelivered(),
+      (double)stat.bytes_in(),
+      (double)stat.bytes_out(),
+      (double)stat.subscribers(),
+      (double)stat.inflight(),
+      stat.oldest_age(),
+      (double)stat.write_backlog(),
+      (double)stat.memory_bytes(),
+      (double)stat.spilled_size(),
+      (double)stat.expired()
+    };
+
+    for(int f = 0; f < METRICS_QUEUE_FAMILIES; f++) {
+      write_sample(families_[f], cQueueFamilies[f].name, labels, vals[f]);
+    }
+
+    cursor_ = i->first;
+  }
+
+  return i == queues.end();
+}
+
+void Scrape::finish_render() {
+  std::string body;
+  metrics_.render_server(body);
+
+  for(int i = 0; i < METRICS_QUEUE_FAMILIES; i++) {
+    body += families_[i];
+    families_[i].clear();
+  }
+
+  std::stringstream ss;
+  ss << "HTTP/1.0 200 OK\r\n"
+     << "Content-Type: text/plain; version=0.0.4\r\n"
+     << "Content-Length: " << body.size() << "\r\n"
+     << "Connection: close\r\n\r\n";
+
+  out_.add(ss.str());
+  out_.add(body);
+}
+
+void Scrape::on_io(ev::io& w, int revents) {
+  if(EV_ERROR & revents) {
+    metrics_.finished(this);
+    return;
+  }
+
+  idle_w_.again();
+
+  switch(state_) {
+  case eReadRequest:
+    if(!read_request()) {
+      debugs << "Metrics scrape closed before sending a request\n";
+      metrics_.finished(this);
+      return;
+    }
+
+    if(state_ == eRender) {
+      render_queue_header();
+      io_w_.stop();
+      io_w_.start(fd_, EV_WRITE);
+    }
+    return;
+
+  case eRender:
+    if(!render_slice()) return;
+
+    finish_render();
+    state_ = eWrite;
+
+    // fall through
+  case eWrite:
+    switch(out_.flush(fd_)) {
+    case eOk:
+      debugs << "Metrics scrape served\n";
+      metrics_.finished(this);
+      return;
+    case eFailure:
+      debugs << "Error writing metrics scrape\n";
+      metrics_.finished(this);
+      return;
+    case eWouldBlock:
+      return;
+    }
+  }
+}
+
+Metrics::Metrics(Server& s)
+  : server_(s)
+  , fd_(-1)
+  , accept_w_(s.loop())
+  , check_w_(s.loop())
+  , prepare_w_(s.loop())
+  , woke_(0)
+  , scrapes_()
+  , iterations_(0)
+  , busy_total_(0)
+  , busy_max_(0)
+{
+  for(int i = 0; i < METRICS_LATENCY_BUCKETS; i++) {
+    buckets_[i] = 0;
+  }
+}
+
+Metrics::~Metrics() {
+  accept_w_.stop();
+  check_w_.stop();
+  prepare_w_.stop();
+
+  for(Scrapes::iterator i = scrapes_.begin();
+      i != scrapes_.end();
+      ++i) {
+    delete *i;
+  }
+
+  if(fd_ >= 0) close(fd_);
+}
+
+bool Metrics::start(std::string hostaddr, int port) {
+  fd_ = make_listener(hostaddr, port);
+  if(fd_ < 0) return false;
+
+  accept_w_.set<Metrics, &Metrics::on_connection>(this);
+  accept_w_.start(fd_, EV_READ);
+
+  check_w_.set<Metrics, &Metrics::on_check>(this);
+  check_w_.start();
+
+  prepare_w_.set<Metrics, &Metrics::on_prepare>(this);
+  prepare_w_.start();
+
+  return true;
+}
+
+void Metrics::on_connection(ev::io& w, int revents) {
+  if(EV_ERROR & revents) {
+    puts("Metrics::on_connection() got error event.");
+    return;
+  }
+
+  struct sockaddr_in addr;
+  socklen_t addr_len = sizeof(addr);
+  int fd = accept(fd_, (struct sockaddr*)&addr, &addr_len);
+
+  if(fd < 0) {
+    perror("accept()");
+    return;
+  }
+
+  set_nonblock(fd);
+
+  Scrape* scrape = new Scrape(*this, server_, fd);
+  scrapes_.push_back(scrape);
+
+  scrape->start();
+}
+
+void Metrics::finished(Scrape* scrape) {
+  scrapes_.remove(scrape);
+  delete scrape;
+}
+
+// Check watchers run once each time the loop wakes up, and ev_now is
+// still the time it woke, so that's when the iteration started.
+void Metrics::on_check(ev::check& w, int revents) {
+  woke_ = server_.now();
+}
+
+// Prepare watchers run just before the loop blocks again, so the
+// difference is how long we spent running callbacks this iteration.
+void Metrics::on_prepare(ev::prepare& w, int revents) {
+  if(woke_ == 0) return;
+
+  double busy = ev_time() - woke_;
+  if(busy < 0) busy = 0;
+
+  iterations_++;
+  busy_total_ += busy;
+  if(busy > busy_max_) busy_max_ = busy;
+
+  int b = 0;
+  while(b < METRICS_LATENCY_BUCKETS - 1 && busy > cLatencyBounds[b]) b++;
+
+  buckets_[b]++;
+}
+
+void Metrics::render_server(std::string& out) {
+  write_gauge(out, "harq_queues", "Queues declared.",
+              server_.queues().size());
+  write_gauge(out, "harq_connections", "Open client connections.",
+              server_.connections().size());
+  write_gauge(out, "harq_replicas", "Attached replicas.",
+              server_.replicas().size());
+
+  ReplicationLog& log = server_.replication().log();
+  write_gauge(out, "harq_replication_lsn",
+              "LSN the next replicated change will get.", log.next_lsn());
+  write_gauge(out, "harq_replication_log_bytes",
+              "Bytes of changes kept for reconnecting replicas.", log.bytes());
+  write_gauge(out, "harq_replication_max_lag",
+              "Most changes any replica hasn't been sent yet.",
+              server_.replication().max_lag());
+  write_gauge(out, "harq_replication_applied_lsn",
+              "Last change applied from our master.",
+              server_.replication().applied_lsn());
+  write_gauge(out, "harq_taps", "Attached taps.",
+              server_.taps().size());
+
+  uint64_t backlog = 0;
+  Connections& cons = server_.connections();
+
+  for(Connections::iterator i = cons.begin();
+      i != cons.end();
+      ++i) {
+    backlog += (*i)->write_backlog();
+  }
+
+  write_gauge(out, "harq_write_backlog_bytes",
+              "Bytes waiting to be written to all connections.", backlog);
+
+  write_gauge(out, "harq_memory_bytes",
+              "Payload bytes held in memory across all queues.",
+              server_.memory_bytes());
+  write_gauge(out, "harq_elided_writes",
+              "Durable writes skipped because the message was acked first.",
+              server_.elided_writes());
+  write_gauge(out, "harq_scheduled_messages",
+              "Messages waiting on their not-before time.",
+              server_.scheduled_messages());
+  write_gauge(out, "harq_paused_publishers",
+              "Publishers held off by memory limits.",
+              server_.paused().size());
+
+  render_loop(out);
+  render_storage(out);
+  render_allocator(out);
+}
+
+void Metrics::render_loop(std::string& out) {
+  const char* name = "harq_loop_busy_seconds";
+
+  write_family(out, name, "histogram",
+               "Time spent running callbacks per loop iteration.");
+
+  uint64_t cumulative = 0;
+  char labels[32];
+
+  for(int i = 0; i < METRICS_LATENCY_BUCKETS; i++) {
+    cumulative += buckets_[i];
+
+    if(i < METRICS_LATENCY_BUCKETS - 1) {
+      snprintf(labels, sizeof(labels), "{le=\"%g\"}", cLatencyBounds[i]);
+    } else {
+      snprintf(labels, sizeof(labels), "{le=\"+Inf\"}");
+    }
+
+    write_sample(out, "harq_loop_busy_seconds_bucket", labels, cumulative);
+  }
+
+  write_sample(out, "harq_loop_busy_seconds_sum", busy_total_);
+  write_sample(out, "harq_loop_busy_seconds_count", iterations_);
+
+  write_gauge(out, "harq_loop_busy_max_seconds",
+              "Longest loop iteration since the previous scrape.", busy_max_);
+
+  busy_max_ = 0;
+}
+
+// Whatever the storage engine reports, each stat becoming a gauge
+// named harq_<stat>.
+void Metrics::render_storage(std::string& out) {
+  StorageEngine& storage = server_.storage();
+
+  StorageStats stats;
+  std::string detail;
+
+  storage.stats(stats, detail);
+
+  std::string last;
+
+  for(StorageStats::iterator i = stats.begin();
+      i != stats.end();
+      ++i) {
+    std::string name = "harq_" + i->name;
+
+    if(name != last) {
+      write_family(out, name.c_str(), "gauge", i->help.c_str());
+      last = name;
+    }
+
+    write_sample(out, name.c_str(), i->labels, i->value);
+  }
+
+  // Things like the LevelDB compaction table aren't something we can
+  // sensibly turn into samples, so pass them through as comments for
+  // humans.
+  std::stringstream ss(detail);
+  std::string line;
+
+  while(std::getline(ss, line)) {
+    out += "# " + storage.name() + ".stats ";
+    out += line;
+    out += '\n';
+  }
+}
+
+void Metrics::render_allocator(std::string& out) {
+#ifdef __GLIBC__
+#if __GLIBC_PREREQ(2, 33)
+  struct mallinfo2 mi = mallinfo2();
+#else
+  struct mallinfo mi = mallinfo();
+#endif
+
+  write_gauge(out, "harq_malloc_arena_bytes",
+              "Bytes obtained from the system via sbrk.", mi.arena);
+  write_gauge(out, "harq_malloc_mmap_bytes",
+              "Bytes obtained from the system via mmap.", mi.hblkhd);
+  write_gauge(out, "harq_malloc_inuse_bytes",
+              "Bytes in allocated chunks.", mi.uordblks);
+  write_gauge(out, "harq_malloc_free_bytes",
+              "Bytes in free chunks.", mi.fordblks);
+#endif
+}
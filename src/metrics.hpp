@@ -0,0 +1,108 @@
+#ifndef METRICS_HPP
+#define METRICS_HPP
+
+#include <list>
+#include <string>
+
+#include <stdint.h>
+
+#include <ev++.h>
+
+#include "write_set.hpp"
+
+class Server;
+class Metrics;
+
+#define METRICS_LATENCY_BUCKETS 6
+#define METRICS_QUEUE_FAMILIES 15
+
+// One in-progress scrape. The request is read, then the queues are
+// rendered a slice at a time each time the socket is writable so that
+// a huge number of queues can't hold up the loop, then the response
+// is written out and the socket closed. One that goes quiet for too
+// long, at any point, is closed.
+class Scrape {
+public:
+  enum State { eReadRequest, eRender, eWrite };
+
+private:
+  Metrics& metrics_;
+  Server& server_;
+  int fd_;
+  ev::io io_w_;
+  ev::timer idle_w_;
+
+  State state_;
+  std::string request_;
+
+  // Name of the last queue rendered, the next slice starts after it.
+  std::string cursor_;
+  bool started_;
+
+  std::string families_[METRICS_QUEUE_FAMILIES];
+
+  WriteSet out_;
+
+  // Not copyable.
+  Scrape(const Scrape&);
+  Scrape& operator=(const Scrape&);
+
+public:
+  Scrape(Metrics& m, Server& s, int fd);
+  ~Scrape();
+
+  void start();
+  void on_io(ev::io& w, int revents);
+  void on_idle(ev::timer& w, int revents);
+
+private:
+  bool read_request();
+  bool render_slice();
+  void render_queue_header();
+  void finish_render();
+};
+
+class Metrics {
+  Server& server_;
+  int fd_;
+  ev::io accept_w_;
+  // Time every loop iteration from when it wakes up to when it's
+  // about to block again. Only the rendering waits for a scrape.
+  ev::check check_w_;
+  ev::prepare prepare_w_;
+  double woke_;
+
+  typedef std::list<Scrape*> Scrapes;
+  Scrapes scrapes_;
+
+  // How long each loop iteration spent running callbacks.
+  uint64_t iterations_;
+  double busy_total_;
+  double busy_max_;
+  uint64_t buckets_[METRICS_LATENCY_BUCKETS];
+
+  // Not copyable.
+  Metrics(const Metrics&);
+  Metrics& operator=(const Metrics&);
+
+public:
+  Metrics(Server& s);
+  ~Metrics();
+
+  bool start(std::string hostaddr, int port);
+
+  void on_connection(ev::io& w, int revents);
+  void on_check(ev::check& w, int revents);
+  void on_prepare(ev::prepare& w, int revents);
+
+  void finished(Scrape* scrape);
+
+  void render_server(std::string& out);
+
+private:
+  void render_loop(std::string& out);
+  void render_storage(std::string& out);
+  void render_allocator(std::string& out);
+};
+
+#endif
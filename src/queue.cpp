@@ -2,19 +2,33 @@
 #include "connection.hpp"
 #include "flags.hpp"
 #include "server.hpp"
+#include "config.hpp"
 #include "debugs.hpp"
 #include "message.hpp"
+#include "spill.hpp"
+#include "durable_store.hpp"
+#include "replication.hpp"
 
 #include "wire.pb.h"
-#include "leveldb/db.h"
-#include "leveldb/write_batch.h"
 
-#include <sstream>
+#include <algorithm>
 #include <iostream>
 
+#include <math.h>
+
+// The most one flush hands a connection before letting the rest of
+// the loop run.
+#define FLUSH_SLICE_MESSAGES 1000
+#define FLUSH_SLICE_BYTES (1024 * 1024)
+#define FLUSH_SLICE_SECONDS 0.005
+
 #define DURABLE_BROKEN() std::cerr << "Durable storage broken!\n";
 #define UNREACHABLE(msg) std::cerr << "Unreachable branch hit: " << msg << "\n";
 
+static bool index_less(const Message& msg, uint64_t idx) {
+  return msg.index() < idx;
+}
+
 Queue::~Queue() {
   for(List::iterator i = bonded_to_.begin();
       i != bonded_to_.end();
@@ -28,25 +42,457 @@ Queue::~Queue() {
       ++i) {
     (*i)->queue_destroyed(this);
   }
+
+  server_.sub_memory(memory_bytes_ + scheduled_bytes_);
+
+  if(readahead_queued_) server_.cancel_readahead(this);
+  server_.forget_flushes(this);
+  if(serial_) server_.forget_queue(serial_);
+
+  delete spill_;
+  delete store_;
+}
+
+DurableStore& Queue::store() {
+  if(!store_) {
+    store_ = server_.open_store(name_);
+    expire_stored();
+  }
+
+  return *store_;
+}
+
+unsigned Queue::queued_messages() {
+  return transient_.size() + spilled_messages();
+}
+
+unsigned Queue::spilled_messages() {
+  return spill_ ? spill_->size() : 0;
 }
 
 void Queue::write_transient(const Message& msg) {
+  size_t bytes = msg->payload().size();
+
+  if(kind_ != eEphemeral) server_.replication().enqueued(name_, msg);
+
+  double at = expires_at(msg);
+  if(at > 0) expire_later(msg, at);
+
+  // Once anything is spilled, everything after it has to go to the
+  // spill file too to keep the order.
+  if(spill_ && !spill_->empty_p()) {
+    if(page_out(msg)) return;
+  } else if(kind_ == eTransient) {
+    size_t budget = server_.config().spill_threshold();
+
+    if(budget > 0 && memory_bytes_ + bytes > budget) {
+      if(page_out(msg)) return;
+    }
+  }
+
   transient_.push_back(msg);
+  add_memory(bytes);
+}
+
+bool Queue::page_out(const Message& msg) {
+  if(!spill_) {
+    spill_ = new SpillFile(server_.spill_path());
+
+    if(!spill_->open()) {
+      delete spill_;
+      spill_ = 0;
+      return false;
+    }
+
+    debugs << "Spilling queue " << name_ << " to disk\n";
+  }
+
+  if(!spill_->append(msg)) {
+    std::cerr << "Unable to spill message for " << name_
+              << ", keeping it in memory\n";
+    return false;
+  }
+
+  return true;
+}
+
+// Read spilled messages back into memory until we're back up to the
+// spill threshold (or at least have one to deliver). Returns true if
+// anything was read.
+bool Queue::page_in() {
+  if(!spill_ || spill_->empty_p()) return false;
+
+  size_t budget = server_.config().spill_threshold();
+  bool got = false;
+
+  while(!spill_->empty_p() &&
+        (transient_.empty() || memory_bytes_ < budget)) {
+    Message msg;
+
+    // The spill file has already given up on any segment it couldn't
+    // read, so this only fails if what's left can't be written out to
+    // be read yet. That's tried again next time.
+    if(!spill_->read(msg)) break;
+
+    transient_.push_back(msg);
+    add_memory(msg->payload().size());
+    got = true;
+  }
+
+  return got;
+}
+
+void Queue::add_memory(size_t bytes) {
+  memory_bytes_ += bytes;
+  server_.add_memory(bytes);
+}
+
+void Queue::sub_memory(size_t bytes) {
+  memory_bytes_ -= bytes;
+  server_.sub_memory(bytes);
+}
+
+void Queue::scheduled(const Message& msg) {
+  size_t bytes = msg->payload().size();
+
+  scheduled_++;
+  scheduled_bytes_ += bytes;
+  server_.add_memory(bytes);
+}
+
+void Queue::unscheduled(const Message& msg) {
+  size_t bytes = msg->payload().size();
+
+  scheduled_--;
+  scheduled_bytes_ -= bytes;
+  server_.sub_memory(bytes);
+}
+
+// Indicates if publishers into this queue should be held off. Once
+// held, they're let go again when we've drained to 3/4 of the limit
+// so they don't flap on and off at the limit.
+bool Queue::memory_pressure_p(bool resuming) {
+  if(kind_ == eBroadcast) {
+    for(List::iterator i = broadcast_into_.begin();
+        i != broadcast_into_.end();
+        ++i) {
+      if((*i)->memory_pressure_p(resuming)) return true;
+    }
+
+    return false;
+  }
+
+  size_t limit = server_.config().queue_memory_limit();
+  if(limit == 0) return false;
+
+  size_t bytes = memory_bytes_ + scheduled_bytes_;
+
+  if(resuming) return bytes > limit / 4 * 3;
+
+  return bytes >= limit;
+}
+
+bool Queue::adopt_store(DurableStore* store) {
+  if(store_) return false;
+
+  store_ = store;
+  expire_stored();
+  return true;
+}
+
+bool Queue::bonded_p(Queue* other) {
+  for(List::iterator i = broadcast_into_.begin();
+      i != broadcast_into_.end();
+      ++i) {
+    if(*i == other) return true;
+  }
+
+  return false;
+}
+
+// The earlier of when msg itself expires and when our ttl runs out
+// for it, 0 if neither.
+double Queue::expires_at(const Message& msg) {
+  double at = msg->has_expires() ? msg->expires() : 0;
+
+  if(ttl_ > 0 && msg.stamp() > 0) {
+    double ours = msg.stamp() + ttl_ / 1000.0;
+    if(at == 0 || ours < at) at = ours;
+  }
+
+  return at;
+}
+
+bool Queue::expired_p(const Message& msg, double now) {
+  double at = expires_at(msg);
+  return at > 0 && at <= now;
+}
+
+uint64_t Queue::serial() {
+  if(!serial_) serial_ = server_.track_queue(this);
+  return serial_;
+}
+
+void Queue::expire_later(const Message& msg, double at) {
+  if(msg.durable_p()) {
+    server_.expire_later(this, at, true, msg.index());
+    return;
+  }
+
+  // One timer at the end of a tick covers everything in transient_
+  // due within it. One due before the last timer, behind a message
+  // with a longer ttl, goes when that one does or at delivery.
+  double tick = ceil(at / TIMER_RESOLUTION) * TIMER_RESOLUTION;
+  if(tick <= head_expiry_) return;
+
+  head_expiry_ = tick;
+  server_.expire_later(this, tick, false, 0);
+}
+
+// The server arms the timers in the expiry index at startup, but a
+// store that isn't indexed has to be scanned for them once it's open.
+// Arming them indexes them. The ones already due fire on the next tick.
+void Queue::expire_stored() {
+  if(kind_ != eDurable || expiries_indexed_) return;
+  if(server_.replication().following_p()) return;
+
+  Message msg;
+  uint64_t from = 0;
+  unsigned armed = 0;
+
+  while(store_->next(from, msg)) {
+    from = msg.index() + 1;
+
+    double at = expires_at(msg);
+    if(at == 0) continue;
+
+    expire_later(msg, at);
+    armed++;
+  }
+
+  if(armed > 0) {
+    debugs << "Armed " << armed << " expiries for " << name_ << "\n";
+  }
+
+  expiries_indexed_ = true;
+  server_.redeclare(this);
+}
+
+void Queue::expire_head() {
+  double now = server_.now();
+  unsigned popped = 0;
+
+  while(!transient_.empty() || page_in()) {
+    Message& msg = transient_.front();
+    if(!expired_p(msg, now)) break;
+
+    sub_memory(msg->payload().size());
+    transient_.pop_front();
+    expired_.mark(now);
+    popped++;
+  }
+
+  if(popped > 0 && kind_ != eEphemeral) {
+    server_.replication().dequeued(name_, popped);
+  }
+}
+
+// Erase the messages at idxs that are still waiting, in one write.
+// Ones in flight are left to their consumer, and are dropped if they
+// come back to be redelivered.
+void Queue::expire_durable(const std::vector<uint64_t>& idxs) {
+  if(kind_ != eDurable) return;
+
+  std::vector<uint64_t> gone;
+  gone.reserve(idxs.size());
+
+  for(std::vector<uint64_t>::const_iterator i = idxs.begin();
+      i != idxs.end();
+      ++i) {
+    if(durable_inflight_.count(*i) > 0) continue;
+    if(!store().has(*i)) continue;
+
+    gone.push_back(*i);
+  }
+
+  if(gone.empty()) return;
+
+  // Elided writes were never replicated, so there's nothing to erase.
+  std::vector<bool> pending;
+  pending.reserve(gone.size());
+
+  for(std::vector<uint64_t>::iterator i = gone.begin();
+      i != gone.end();
+      ++i) {
+    pending.push_back(store().pending_p(*i));
+  }
+
+  if(!store().erase_all(gone)) {
+    std::cerr << "Unable to erase expired messages from " << name_ << "\n";
+    return;
+  }
+
+  double now = server_.now();
+
+  for(size_t i = 0; i < gone.size(); i++) {
+    remove_readahead(gone[i]);
+    if(!pending[i]) server_.replication().erased(name_, gone[i]);
+    expired_.mark(now);
+  }
+
+  debugs << "Expired " << gone.size() << " messages from " << name_ << "\n";
+}
+
+bool Queue::next_durable(uint64_t from, Message& msg) {
+  return store().next(from, msg);
+}
+
+bool Queue::durable_pending_p(uint64_t idx) {
+  return store().pending_p(idx);
+}
+
+// Everything in transient_ and the spill file, in order.
+bool Queue::snapshot_transient(std::vector<Message>& out) {
+  out.reserve(queued_messages());
+
+  for(Messages::iterator i = transient_.begin();
+      i != transient_.end();
+      ++i) {
+    out.push_back(*i);
+  }
+
+  if(spill_ && !spill_->empty_p()) return spill_->peek_all(out);
+
+  return true;
+}
+
+// The bootstrap stream may send a durable message that a buffered
+// change then appends again, so anything behind the end of the store
+// is already here (or was, and was erased).
+void Queue::apply_append(uint64_t idx, Message& msg) {
+  if(idx < store().next_index()) return;
+
+  if(!store().append_at(idx, msg)) {
+    std::cerr << "Unable to apply replicated message " << idx
+              << " to " << name_ << "\n";
+    return;
+  }
+
+  // Our master keeps the expiry index, so if we take over, this has
+  // to be found by scanning.
+  if(msg->has_expires() && expiries_indexed_) {
+    expiries_indexed_ = false;
+    server_.redeclare(this);
+  }
+
+  if(!store().pending_p(idx)) server_.replication().appended(name_, msg);
+}
+
+void Queue::apply_erase(uint64_t idx) {
+  if(store().has(idx)) erase_durable(idx);
+}
+
+void Queue::apply_enqueue(const Message& msg) {
+  write_transient(msg);
+}
+
+void Queue::apply_requeue(const std::vector<Message>& msgs) {
+  push_transient_front(msgs);
+}
+
+void Queue::apply_dequeue(unsigned count) {
+  unsigned popped = 0;
+
+  while(popped < count) {
+    if(transient_.empty() && !page_in()) break;
+
+    sub_memory(transient_.front()->payload().size());
+    transient_.pop_front();
+    popped++;
+  }
+
+  server_.replication().dequeued(name_, popped);
+}
+
+void Queue::apply_reset() {
+  transient_.clear();
+  sub_memory(memory_bytes_);
+
+  delete spill_;
+  spill_ = 0;
+
+  if(kind_ == eDurable || store_) {
+    if(!store().clear()) {
+      std::cerr << "Unable to reset durable messages of " << name_ << "\n";
+    }
+  }
+
+  durable_inflight_.clear();
+  durable_cursor_ = 0;
+  drop_readahead();
+
+  server_.replication().reset(name_);
+}
+
+bool Queue::compact_durable() {
+  if(!store_) return false;
+  return store_->compact();
 }
 
+// Stat calls this for every queue, so an unopened store isn't opened
+// for it.
 unsigned Queue::durable_messages() {
-  wire::Queue qi;
+  if(store_) durable_count_ = store_->size();
+  return durable_count_;
+}
 
-  switch(server_.read_queue(name_, qi)) {
-  case eValid:
-    // Ok!
-    break;
-  case eMissing:
-  case eInvalid:
-    return 0;
+void Queue::fill_stat(wire::Stat& stat) {
+  double now = server_.now();
+
+  stat.set_name(name_);
+  stat.set_exists(true);
+  stat.set_transient_size(queued_messages());
+  stat.set_spilled_size(spilled_messages());
+  stat.set_scheduled_size(scheduled_);
+
+  if(durable_p()) {
+    stat.set_durable_size(durable_messages());
+  }
+
+  stat.set_enqueued(enqueued_.count());
+  stat.set_dequeued(dequeued_.count());
+  stat.set_acked(acked_.count());
+  stat.set_redelivered(redelivered_.count());
+  stat.set_expired(expired_.count());
+  stat.set_bytes_in(bytes_in_.count());
+  stat.set_bytes_out(bytes_out_.count());
+
+  stat.set_enqueue_rate(enqueued_.rate(now));
+  stat.set_dequeue_rate(dequeued_.rate(now));
+  stat.set_ack_rate(acked_.rate(now));
+  stat.set_redelivery_rate(redelivered_.rate(now));
+
+  stat.set_subscribers(subscribers_.size());
+  stat.set_inflight(inflight_);
+
+  // Only in memory messages carry the time they arrived, durable
+  // ones read back from disk report 0.
+  if(!transient_.empty() && transient_.front().stamp() > 0) {
+    stat.set_oldest_age(now - transient_.front().stamp());
+  } else {
+    stat.set_oldest_age(0);
+  }
+
+  uint64_t backlog = 0;
+
+  for(Connections::iterator i = subscribers_.begin();
+      i != subscribers_.end();
+      ++i) {
+    backlog += (*i)->write_backlog();
   }
 
-  return qi.size();
+  stat.set_write_backlog(backlog);
+  stat.set_memory_bytes(memory_bytes_ + scheduled_bytes_);
 }
 
 bool Queue::change_kind(Queue::Kind k) {
@@ -75,6 +521,8 @@ bool Queue::change_kind(Queue::Kind k) {
 bool Queue::flush_to_durable() {
   // pre(kind_ == eTransient);
 
+  unsigned queued = queued_messages();
+
   server_.reserve(name_);
 
   for(Messages::iterator i = transient_.begin();
@@ -93,267 +541,295 @@ bool Queue::flush_to_durable() {
     // we stay as transient and keep the messages.
   }
 
+  while(spill_ && !spill_->empty_p()) {
+    Message msg;
+
+    if(!spill_->read(msg)) {
+      std::cerr << "Unable to read spill file for " << name_
+                << ", dropping " << spill_->size() << " messages\n";
+      break;
+    }
+
+    if(!write_durable(msg)) {
+      std::cerr << "Critical error flushing spilled messages to durable\n";
+      // It's out of the spill file now, so it goes at the end of
+      // transient_, which is still in order since everything before
+      // it is there already.
+      transient_.push_back(msg);
+      add_memory(msg->payload().size());
+      return false;
+    }
+  }
+
+  delete spill_;
+  spill_ = 0;
+
   // Ok, all messages flushed to durable, let's go ahead and cleanup the
   // transient ones.
 
   transient_.clear();
+  sub_memory(memory_bytes_);
+
+  server_.replication().dequeued(name_, queued);
 
   kind_ = eDurable;
 
   return true;
 }
 
-std::string Queue::durable_key(int i) {
-  std::stringstream ss;
-  ss << "-";
-  ss << name_;
-  ss << ":";
-  ss << i;
-
-  return ss.str();
-}
-
 int Queue::flush_at_most(Connection* con, int count) {
+  double now = server_.now();
   int wrote = 0;
+  unsigned popped = 0;
+
+  while(wrote < count) {
+    if(transient_.empty() && !page_in()) break;
 
-  for(Messages::iterator j = transient_.begin();
-      j != transient_.end();)
-  {
-    if(count == wrote) break;
+    Message& msg = transient_.front();
 
-    if(con->deliver(*j, ref(this)) != eIgnored) {
-      j = transient_.erase(j);
+    if(expired_p(msg, now)) {
+      sub_memory(msg->payload().size());
+      transient_.pop_front();
+      expired_.mark(now);
+      popped++;
+      continue;
+    }
+
+    if(con->deliver(msg, ref(this)) != eIgnored) {
+      delivered(msg);
+      sub_memory(msg->payload().size());
+      transient_.pop_front();
       wrote++;
+      popped++;
     } else {
       debugs << "Connection refused delivery.\n";
       break;
     }
   }
 
+  if(kind_ != eEphemeral) server_.replication().dequeued(name_, popped);
+
+  // Read the next part of the spill back in while there's still some
+  // in memory to deliver.
+  if(spill_ && memory_bytes_ <= server_.config().spill_threshold() / 2) {
+    page_in();
+  }
+
   if(kind_ != eDurable) return wrote;
 
-  wire::Queue qi;
+  uint64_t scan = durable_cursor_;
+  Message msg;
 
-  switch(server_.read_queue(name_, qi)) {
-  case eValid:
-    // Ok!
-    break;
-  case eMissing:
-    debugs << "No message to flush from " << name_ << "\n";
-    return wrote;
-  case eInvalid:
-    std::cerr << "Corrupt queue info for '" << name_ << "' detected!\n";
-    return wrote;
+  while(wrote < count && next_deliverable(scan, msg)) {
+    uint64_t idx = msg.index();
+    scan = idx + 1;
+
+    bool ahead = !readahead_.empty() && readahead_.front().index() == idx;
+
+    if(durable_inflight_.count(idx) > 0) {
+      if(ahead) readahead_.pop_front();
+      continue;
+    }
+
+    // Messages read back after a restart have no timer, so they're
+    // caught here.
+    if(expired_p(msg, now)) {
+      erase_durable(idx);
+      expired_.mark(now);
+      continue;
+    }
+
+    if(con->deliver(msg, ref(this)) == eIgnored) {
+      // The connection is rejecting our messages now, so bail and
+      // pick this one up again next time.
+      scan = idx;
+      break;
+    }
+
+    if(ahead) readahead_.pop_front();
+
+    delivered(msg);
+    wrote++;
+
+    // If the connection doesn't use acks, then we need
+    // to delete the durable version now. (with acks, it's
+    // deleted when we get the ack)
+    if(!con->use_acks()) erase_durable(idx);
+    debugs << "Flushed message " << idx << "\n";
   }
 
-  int size = qi.size();
+  durable_cursor_ = scan;
+  if(readahead_end_ < scan) readahead_end_ = scan;
 
-  debugs << "Messages to flush: " << size << "\n";
+  schedule_readahead();
 
-  for(int cur_range = 0; cur_range < qi.ranges_size(); cur_range++) {
-    const wire::MessageRange& range = qi.ranges(cur_range);
+  return wrote;
+}
 
-    int fin = range.start() + range.count();
+// The next message to deliver at or after from, out of readahead_ if
+// it has one.
+bool Queue::next_deliverable(uint64_t from, Message& msg) {
+  if(!readahead_.empty()) {
+    msg = readahead_.front();
+    return true;
+  }
 
-    for(int cur_msg = range.start(); cur_msg < fin; cur_msg++) {
-      if(count == wrote) goto done;
+  if(!store().next(from, msg)) return false;
 
-      std::string key = durable_key(cur_msg);
+  // Reading ahead picks up after whatever we had to read ourselves.
+  if(readahead_end_ <= msg.index()) readahead_end_ = msg.index() + 1;
 
-      Message msg(key, cur_msg);
+  return true;
+}
 
-      switch(server_.read_message(key, msg)) {
-      case eMissing:
-        std::cerr << "Unable to get " << key << ". Corrupt QueueInfo?\n";
-        // TODO: Keep going since we assuming haven't lost anything
-        // and we'll fix the Queue later.
-        break;
-      case eInvalid:
-        std::cerr << "Encountered corrupt message on disk\n";
-        // TODO: what should I do here? Delete it? Keep it around and
-        // make the data fairy fixes it? HMMM....
-        break;
-      case eValid:
-        if(con->deliver(msg, ref(this)) == eIgnored) {
-          // The connection is rejecting our messages now, so bail.
-          goto done;
-        } else {
-          wrote++;
-          // If the connection doesn't use acks, then we need
-          // to delete the durable version now. (with acks, it's
-          // deleted when we get the ack)
-          if(!con->use_acks()) erase_durable(cur_msg);
-          debugs << "Flushed message " << cur_msg << "\n";
-        }
-        break;
-      }
-    }
+// Top readahead_ back up once it's half empty, if there's anything
+// left in the store past it.
+void Queue::schedule_readahead() {
+  unsigned window = server_.config().readahead();
+
+  if(window == 0 || readahead_queued_) return;
+  if(readahead_.size() > window / 2) return;
+  if(readahead_end_ >= store().next_index()) return;
+
+  readahead_queued_ = true;
+  server_.schedule_readahead(this);
+}
+
+void Queue::fill_readahead() {
+  if(kind_ != eDurable) return;
+
+  unsigned window = server_.config().readahead();
+  uint64_t from = readahead_end_;
+  if(from < durable_cursor_) from = durable_cursor_;
+
+  Message msg;
+
+  while(readahead_.size() < window && store().next(from, msg)) {
+    from = msg.index() + 1;
+
+    if(durable_inflight_.count(msg.index()) > 0) continue;
+
+    readahead_.push_back(msg);
   }
 
-done:
-  return wrote;
+  readahead_end_ = from;
 }
 
+void Queue::drop_readahead() {
+  readahead_.clear();
+  readahead_end_ = durable_cursor_;
+}
+
+void Queue::remove_readahead(uint64_t idx) {
+  if(readahead_.empty() || idx < readahead_.front().index() ||
+     idx > readahead_.back().index()) return;
+
+  std::deque<Message>::iterator i =
+    std::lower_bound(readahead_.begin(), readahead_.end(), idx, index_less);
+
+  if(i != readahead_.end() && i->index() == idx) readahead_.erase(i);
+}
+
+// Flush one slice of the backlog to con. If there's more, the server
+// picks it up again on the next loop iteration. If con stops taking
+// them, its refill picks it up once its socket drains.
 int Queue::flush(Connection* con) {
   int wrote = 0;
+  uint64_t bytes = bytes_out_.count();
+  double start = ev_time();
+
   while(con->active_p()) {
     int w = flush_at_most(con, 25);
     if(w == 0) break;
     wrote += w;
+
+    if(wrote >= FLUSH_SLICE_MESSAGES ||
+       bytes_out_.count() - bytes >= FLUSH_SLICE_BYTES ||
+       ev_time() - start >= FLUSH_SLICE_SECONDS) {
+      server_.schedule_flush(con, this);
+      break;
+    }
   }
 
   return wrote;
 }
 
 bool Queue::write_durable(Message& msg) {
-  wire::Queue qi;
+  // Stored with the message, since the time it arrived isn't.
+  double at = expires_at(msg);
+  if(at > 0) msg->set_expires(at);
 
-  switch(server_.read_queue(name_, qi)) {
-  case eValid:
-    // Ok!
-    break;
-  case eInvalid:
-    std::cerr << "Corrupt queue info detected, unable to write durable\n";
+  if(!store().append(msg)) {
+    std::cerr << "Unable to write message for " << name_ << " to durable\n";
+    // TODO: durable is busted! What to do?!
     return false;
-  case eMissing:
-    qi.set_size(0);
-    break;
   }
 
-  // Add the message to the end of the last range always.
-
-  int idx = 0;
-
-  if(qi.ranges_size() == 0) {
-    wire::MessageRange* r = qi.add_ranges();
-    r->set_start(0);
-    r->set_count(1);
-  } else {
-    int range = qi.ranges_size() - 1;
-    wire::MessageRange* r = qi.mutable_ranges(range);
-    idx = r->start() + r->count();
-    r->set_count(r->count() + 1);
+  // A write-behind store replicates it once it's committed.
+  if(!store().pending_p(msg.index())) {
+    server_.replication().appended(name_, msg);
   }
 
-  std::string key = durable_key(idx);
-
-  debugs << "Writing persisted message for " << name_
-         << " (" << idx << ")\n";
-
-  qi.set_size(qi.size() + 1);
-
-  if(server_.update_queue(name_, qi, key, msg)) {
-    msg.make_durable(key, idx);
-    debugs << "Updated index of " << name_ << "\n";
-    return true;
-  } else {
-    std::cerr << "Unable to write message to DB\n";
-    // TODO: durable is busted! What to do?!
-    return false;
-  }
+  if(at > 0) expire_later(msg, at);
+  return true;
 }
 
 bool Queue::erase_durable(uint64_t idx) {
-  wire::Queue qi;
+  durable_inflight_.erase(idx);
 
-  switch(server_.read_queue(name_, qi)) {
-  case eValid:
-    // Ok!
-    break;
-  case eInvalid:
-    std::cerr << "Corrupt queue info detected, unable to write durable\n";
-    return false;
-  case eMissing:
-    std::cerr << "Missing queue info detected, unable to write durable\n";
-    return false;
-  }
+  // Only a replicated erase or an expiry takes out a message we've
+  // read ahead.
+  remove_readahead(idx);
 
-  // Fixup the ranges to remove idx.
+  // Erasing a pending write elides it, and it was never replicated.
+  bool pending = store().pending_p(idx);
 
-  if(qi.ranges_size() == 0) {
-    // WTF. Well, indicate the weird situation and then continue on.
-    std::cerr << "Attempted to delete from queue with no ranges.\n";
+  if(!store().erase(idx)) {
+    std::cerr << "Unable to erase message " << idx << " from " << name_ << "\n";
+    // TODO: durable is busted! What to do?!
     return false;
   }
 
-  google::protobuf::RepeatedPtrField<wire::MessageRange>* ranges = qi.mutable_ranges();
-
-  for(int range = 0; range < qi.ranges_size(); range++) {
-    wire::MessageRange* r = ranges->Mutable(range);
-
-    // Each case that results in a different range change is seperated
-    // out for clarity.
-    //
-    if(idx == r->start()) {
-      // There was only one message, so we just nuke the range.
-      if(r->count() == 0) {
-        ranges->DeleteSubrange(range, 1);
-      } else {
-        // Shrink the range upward.
-        r->set_start(r->start() + 1);
-        r->set_count(r->count() - 1);
-      }
-
-      goto write;
-    }
-
-    // Ok, idx is in this range.
-    if(idx > r->start() && idx < r->start() + r->count()) {
-      // It's the last message, so just decrement count.
-      if(idx == r->start() + r->count() - 1) {
-        r->set_count(r->count() - 1);
-      } else {
-        // Ok, it's in the middle, so we have to split the range.
+  if(!pending) server_.replication().erased(name_, idx);
+  return true;
+}
 
-        // Make a new record at the end.
-        ranges->Add();
+void Queue::deliver(Message& msg) {
+  double now = server_.now();
 
-        // Now put the new range into the right position.
-        int target = range + 1;
+  if(msg.stamp() == 0) msg.set_stamp(now);
 
-        // We move from the end towards target, swapping elements
-        // until nr is in the right position.
-        for(int j = ranges->size() - 1; j > target; j--) {
-          ranges->SwapElements(j, j-1);
-        }
+  enqueued_.mark(now);
+  bytes_in_.mark(now, msg->payload().size());
 
-        // This will now be our fresh record.
-        wire::MessageRange* nr = ranges->Mutable(target);
+  route(msg);
+}
 
-        nr->set_start(idx + 1);
-        nr->set_count((r->start() + r->count()) - idx);
+void Queue::redeliver(Message& msg) {
+  double now = server_.now();
 
-        r->set_count(idx - r->start());
-      }
+  if(inflight_ > 0) inflight_--;
 
-      goto write;
-    }
+  if(expired_p(msg, now)) {
+    if(kind_ == eDurable && msg.durable_p()) erase_durable(msg.index());
+    expired_.mark(now);
+    return;
   }
 
-  // Fell through for and didn't find a range.
-  std::cerr << "Unable to find message " << idx << " in queue " << name_ << "\n";
-  return false;
-
-write:
+  redelivered_.mark(now);
+  msg->set_redeliveries(msg->redeliveries() + 1);
 
-  std::string key = durable_key(idx);
-
-  debugs << "Erasing persisted message for " << name_
-         << " (" << idx << ")\n";
+  route(msg);
+}
 
-  qi.set_size(qi.size() - 1);
+void Queue::delivered(Message& msg) {
+  double now = server_.now();
 
-  if(!server_.remove_message(name_, qi, key)) {
-    std::cerr << "Unable to write message to DB\n";
-    // TODO: durable is busted! What to do?!
-    return false;
-  } else {
-    debugs << "Updated index of " << name_ << "\n";
-    return true;
-  }
+  dequeued_.mark(now);
+  bytes_out_.mark(now, msg->payload().size());
 }
 
-void Queue::deliver(Message& msg) {
+void Queue::route(Message& msg) {
   // With broadcast, we don't support acks because wtf would that
   // even mean? So we handle it specially and invoke
   // Connection::write to just write the message directly to the
@@ -363,7 +839,15 @@ void Queue::deliver(Message& msg) {
     for(List::iterator i = broadcast_into_.begin();
         i != broadcast_into_.end();
         ++i) {
-      (*i)->deliver(msg);
+      // A durable queue records its own index in the message, so it
+      // can't share it with the others.
+      if((*i)->durable_p()) {
+        Message copy(msg.wire());
+        copy.set_stamp(msg.stamp());
+        (*i)->deliver(copy);
+      } else {
+        (*i)->deliver(msg);
+      }
     }
 
     return;
@@ -383,11 +867,25 @@ queue_it:
       } else {
         if(msg.durable_p()) {
           debugs << "Not re-writing already written durable message from ack\n";
+
+          // It's back in the store for anyone to take, so make sure
+          // the next flush goes back far enough to find it.
+          durable_inflight_.erase(msg.index());
+          if(msg.index() < durable_cursor_) durable_cursor_ = msg.index();
+
+          // Everything read ahead comes after the cursor, so this goes
+          // in front of it.
+          if(!readahead_.empty() && msg.index() < readahead_.front().index()) {
+            readahead_.push_front(msg);
+          } else if(msg.index() < readahead_end_) {
+            drop_readahead();
+          }
         } else {
           write_durable(msg);
         }
       }
 
+      notify_ready();
       break;
     }
 
@@ -429,13 +927,109 @@ queue_it:
       debugs << "Connection ignored message, moving to another..\n";
       break;
     case eConsumed:
+      // A redelivered durable message is still in the store.
+      if(kind_ == eDurable && msg.durable_p()) erase_durable(msg.index());
+      // fall through
     case eWaitForAck:
       debugs << "Connection queued/delivered the message\n";
+      delivered(msg);
       return;
     }
   }
 }
 
+// Messages a connection had in flight when it went, in the order they
+// were delivered. They go back at the head of the queue in one go,
+// ahead of anything queued since, and are then handed out by the
+// subscribers' normal credit-based refill.
+void Queue::requeue(std::vector<Message>& msgs) {
+  double now = server_.now();
+  unsigned count = msgs.size();
+
+  inflight_ -= count < inflight_ ? count : inflight_;
+
+  std::vector<Message> kept;
+  kept.reserve(count);
+
+  for(std::vector<Message>::iterator i = msgs.begin();
+      i != msgs.end();
+      ++i) {
+    if(expired_p(*i, now)) {
+      if(kind_ == eDurable && i->durable_p()) erase_durable(i->index());
+      expired_.mark(now);
+      continue;
+    }
+
+    (*i)->set_redeliveries((*i)->redeliveries() + 1);
+    kept.push_back(*i);
+  }
+
+  redelivered_.mark(now, kept.size());
+
+  switch(kind_) {
+  case eBroadcast:
+    UNREACHABLE("Requeue on broadcast queue");
+    return;
+  case eEphemeral:
+  case eTransient:
+    push_transient_front(kept);
+    break;
+  case eDurable:
+    {
+      // They're all still in the store, so moving the cursor back to
+      // the first one is enough to put them at the head.
+      uint64_t first = durable_cursor_;
+
+      for(std::vector<Message>::iterator i = kept.begin();
+          i != kept.end();
+          ++i) {
+        if(!i->durable_p()) {
+          route(*i);
+          continue;
+        }
+
+        durable_inflight_.erase(i->index());
+        if(i->index() < first) first = i->index();
+      }
+
+      durable_cursor_ = first;
+
+      // What's been read ahead starts after them.
+      if(first < readahead_end_) drop_readahead();
+    }
+    break;
+  }
+
+  notify_ready();
+
+  Connections subs(subscribers_);
+
+  for(Connections::iterator i = subs.begin(); i != subs.end(); ++i) {
+    (*i)->refill();
+  }
+}
+
+// Tell our subscribers we have messages waiting for them, so their
+// next refill looks here.
+void Queue::notify_ready() {
+  for(Connections::iterator i = subscribers_.begin();
+      i != subscribers_.end();
+      ++i) {
+    (*i)->queue_ready(this);
+  }
+}
+
+void Queue::push_transient_front(const std::vector<Message>& msgs) {
+  if(kind_ != eEphemeral) server_.replication().requeued(name_, msgs);
+
+  for(std::vector<Message>::const_reverse_iterator i = msgs.rbegin();
+      i != msgs.rend();
+      ++i) {
+    transient_.push_front(*i);
+    add_memory((*i)->payload().size());
+  }
+}
+
 void Queue::recorded_ack(AckRecord& rec) {
   switch(kind_) {
   case eBroadcast:
@@ -443,20 +1037,28 @@ void Queue::recorded_ack(AckRecord& rec) {
     break;
   case eEphemeral:
   case eTransient:
+    inflight_++;
     break;
   case eDurable:
+    inflight_++;
     if(rec.msg.durable_p()) {
       debugs << "Detected ack on already durable message, not re-writing\n";
     } else {
       if(!write_durable(rec.msg)) {
         std::cerr << "Error saving messsage to durable!\n";
+        break;
       }
     }
+
+    durable_inflight_.insert(rec.msg.index());
     break;
   }
 }
 
 void Queue::acked(AckRecord& rec) {
+  if(inflight_ > 0) inflight_--;
+  acked_.mark(server_.now());
+
   switch(kind_) {
   case eBroadcast:
     UNREACHABLE("Received ack on broadcast queue");
@@ -1,14 +1,20 @@
 #ifndef QUEUE_HPP
 #define QUEUE_HPP
 
+#include <deque>
 #include <list>
+#include <set>
 #include <string>
+#include <vector>
 
 #include "message.hpp"
+#include "meter.hpp"
+#include "segment_queue.hpp"
 
 namespace wire {
   class Message;
   class Queue;
+  class Stat;
 }
 
 namespace leveldb {
@@ -17,6 +23,8 @@ namespace leveldb {
 
 class Connection;
 class Server;
+class SpillFile;
+class DurableStore;
 struct AckRecord;
 
 class Queue {
@@ -25,7 +33,7 @@ public:
   typedef std::list<Queue*> List;
 
 private:
-  typedef std::list<Message> Messages;
+  typedef SegmentQueue<Message> Messages;
   typedef std::list<Connection*> Connections;
 
   Server& server_;
@@ -33,16 +41,124 @@ private:
   Messages transient_;
   Connections subscribers_;
 
+  // Holds the tail of transient_ once it's over the spill threshold.
+  SpillFile* spill_;
+
   List broadcast_into_;
   List bonded_to_;
 
   Kind kind_;
 
+  // How many replicas have to have a change to this queue before the
+  // publisher is sent its confirm. 0 confirms straight away.
+  unsigned sync_replicas_;
+
+  // Milliseconds a message can wait here before it's dropped, 0 is
+  // forever.
+  unsigned ttl_;
+
+  // Milliseconds a consumer has to ack a message from here, 0 is
+  // forever.
+  unsigned ack_timeout_;
+
+  // How many shares of a consumer's refill this queue gets.
+  unsigned weight_;
+
+  // Timers are only put in the server's wheel once a message can
+  // expire, and transient_ only needs one per tick since it expires
+  // from the head. This is the last tick it has one for.
+  //
+  // Expiring from the head means a transient message stuck behind
+  // one that expires later (or never) stays queued until that one is
+  // gone, and is only dropped when it comes up for delivery. It's
+  // still never delivered late. Durable messages each get a timer.
+  //
+  // The timers are made with serial_, 0 until the first one.
+  uint64_t serial_;
+  double head_expiry_;
+
+  // Whether every durable message that can expire is in the server's
+  // expiry index. A store from before there was one, or written to as
+  // a replica, is scanned for them once when it's opened.
+  bool expiries_indexed_;
+
+  // Opened the first time a durable message is touched.
+  DurableStore* store_;
+
+  // How many messages store_ had when it was last looked at, or what
+  // the declaration said, so stat never has to open it.
+  uint64_t durable_count_;
+
+  // Durable messages handed to a connection and waiting on an ack.
+  // They stay in the store until acked, so flushing skips them.
+  std::set<uint64_t> durable_inflight_;
+
+  // Everything in the store before this index is either in flight or
+  // erased, so flushing starts here rather than at the front.
+  uint64_t durable_cursor_;
+
+  // The next durable messages from durable_cursor_ on that aren't in
+  // flight, read ahead of time in the server's idle time so that a
+  // refill can deliver without waiting on the store. Reading ahead
+  // carries on from readahead_end_.
+  std::deque<Message> readahead_;
+  uint64_t readahead_end_;
+  bool readahead_queued_;
+
+  unsigned inflight_;
+
+  // Payload bytes held in transient_.
+  size_t memory_bytes_;
+
+  // Messages the server is holding in memory for us until their
+  // not_before time, and their payload bytes. They count against our
+  // memory, but aren't in transient_ so resets leave them alone.
+  unsigned scheduled_;
+  size_t scheduled_bytes_;
+
+  Meter enqueued_;
+  Meter dequeued_;
+  Meter acked_;
+  Meter redelivered_;
+  Meter bytes_in_;
+  Meter bytes_out_;
+  Meter expired_;
+
+  // Not copyable.
+  Queue(const Queue&);
+  Queue& operator=(const Queue&);
+
 public:
   Queue(Server& s, std::string name, Kind k)
     : server_(s)
     , name_(name)
+    , spill_(0)
     , kind_(k)
+    , sync_replicas_(0)
+    , ttl_(0)
+    , ack_timeout_(0)
+    , weight_(1)
+    , serial_(0)
+    , head_expiry_(0)
+    , expiries_indexed_(true)
+    , store_(0)
+    , durable_count_(0)
+    , durable_inflight_()
+    , durable_cursor_(0)
+    , readahead_()
+    , readahead_end_(0)
+    , readahead_queued_(false)
+    , inflight_(0)
+    , memory_bytes_(0)
+    , scheduled_(0)
+    , scheduled_bytes_(0)
+    , enqueued_()
+    , dequeued_()
+    , acked_()
+    , redelivered_()
+    , bytes_in_()
+    , bytes_out_()
+    , expired_()
   {}
 
   ~Queue();
@@ -59,12 +175,51 @@ public:
     return name_;
   }
 
-  unsigned queued_messages() {
-    return transient_.size();
-  }
+  unsigned queued_messages();
+  unsigned spilled_messages();
 
   unsigned durable_messages();
 
+  void set_durable_count(uint64_t count) {
+    durable_count_ = count;
+  }
+
+  bool store_open_p() {
+    return store_ != 0;
+  }
+
+  bool expiries_indexed_p() {
+    return expiries_indexed_;
+  }
+
+  void set_expiries_indexed(bool indexed) {
+    expiries_indexed_ = indexed;
+  }
+
+  // The serial our expiry and schedule timers are made with.
+  uint64_t serial();
+
+  // A message for us was held in memory until its not_before time, or
+  // was released.
+  void scheduled(const Message& msg);
+  void unscheduled(const Message& msg);
+
+  bool durable_inflight_p(uint64_t idx) {
+    return durable_inflight_.count(idx) > 0;
+  }
+
+  unsigned inflight_messages() {
+    return inflight_;
+  }
+
+  size_t memory_bytes() {
+    return memory_bytes_;
+  }
+
+  bool memory_pressure_p(bool resuming);
+
+  void fill_stat(wire::Stat& stat);
+
   void subscribe(Connection* con) {
     subscribers_.push_back(con);
   }
@@ -77,27 +232,120 @@ public:
     return kind_ == eDurable;
   }
 
+  Kind kind() {
+    return kind_;
+  }
+
+  unsigned sync_replicas() {
+    return sync_replicas_;
+  }
+
+  void set_sync_replicas(unsigned count) {
+    sync_replicas_ = count;
+  }
+
+  unsigned ttl() {
+    return ttl_;
+  }
+
+  void set_ttl(unsigned ms) {
+    ttl_ = ms;
+  }
+
+  unsigned ack_timeout() {
+    return ack_timeout_;
+  }
+
+  void set_ack_timeout(unsigned ms) {
+    ack_timeout_ = ms;
+  }
+
+  unsigned weight() {
+    return weight_;
+  }
+
+  void set_weight(unsigned w) {
+    weight_ = w > 0 ? w : 1;
+  }
+
   void broadcast_into(Queue* other) {
     broadcast_into_.push_back(other);
     other->bonded_to_.push_back(this);
   }
 
+  bool bonded_p(Queue* other);
+
+  List& bonds() {
+    return broadcast_into_;
+  }
+
   bool change_kind(Kind k);
 
+  bool compact_durable();
+
+  // Read ahead up to the server's read-ahead window. Called when the
+  // loop is idle.
+  void fill_readahead();
+
+  void readahead_dequeued() {
+    readahead_queued_ = false;
+  }
+
+  // Drop expired messages, called by the server's expiry timer.
+  void expire_head();
+  void expire_durable(const std::vector<uint64_t>& idxs);
+
+  bool next_durable(uint64_t from, Message& msg);
+  bool durable_pending_p(uint64_t idx);
+  bool snapshot_transient(std::vector<Message>& out);
+
+  // Changes from our master, when we're a replica.
+  void apply_append(uint64_t idx, Message& msg);
+  void apply_erase(uint64_t idx);
+  void apply_enqueue(const Message& msg);
+  void apply_dequeue(unsigned count);
+  void apply_requeue(const std::vector<Message>& msgs);
+  void apply_reset();
+
+  // Take a store opened ahead of time, unless one is already open.
+  bool adopt_store(DurableStore* store);
+
   int flush(Connection* con);
   int flush_at_most(Connection* con, int count);
   void deliver(Message& msg);
+  void redeliver(Message& msg);
+  void requeue(std::vector<Message>& msgs);
 
   void recorded_ack(AckRecord& rec);
   void acked(AckRecord& rec);
 
 private:
+  void route(Message& msg);
+  void notify_ready();
+  void delivered(Message& msg);
+
+  DurableStore& store();
+
+  double expires_at(const Message& msg);
+  bool expired_p(const Message& msg, double now);
+  void expire_later(const Message& msg, double at);
+  void expire_stored();
+
   void write_transient(const Message& msg);
+  void push_transient_front(const std::vector<Message>& msgs);
+  bool page_out(const Message& msg);
+  bool page_in();
+  void add_memory(size_t bytes);
+  void sub_memory(size_t bytes);
   bool write_durable(Message& msg);
   bool erase_durable(uint64_t index);
 
+  bool next_deliverable(uint64_t from, Message& msg);
+  void schedule_readahead();
+  void drop_readahead();
+  void remove_readahead(uint64_t idx);
+
   bool flush_to_durable();
-  std::string durable_key(int j);
 };
 
 #endif
@@ -0,0 +1,879 @@
+#include "replication.hpp"
+#include "server.hpp"
+#include "connection.hpp"
+#include "config.hpp"
+#include "debugs.hpp"
+
+#include <iostream>
+
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <snappy.h>
+
+// How many entries to stream to a bootstrapping replica per loop
+// iteration.
+#define REPLICA_CHUNK 256
+
+// Frames to replicas are written once this many bytes of entries
+// have been collected, and compressed if they're at least
+// REPLICA_COMPRESS_MIN bytes.
+#define REPLICA_BATCH_BYTES (64 * 1024)
+#define REPLICA_COMPRESS_MIN 512
+
+// Seconds between attempts to reconnect to our master.
+#define REPLICA_RETRY 1.0
+
+static wire::QueueDeclaration::Type declaration_type(Queue::Kind k) {
+  switch(k) {
+  case Queue::eBroadcast:
+    return wire::QueueDeclaration::eBroadcast;
+  case Queue::eDurable:
+    return wire::QueueDeclaration::eDurable;
+  case Queue::eTransient:
+  case Queue::eEphemeral:
+    break;
+  }
+
+  return wire::QueueDeclaration::eTransient;
+}
+
+ReplicationLog::ReplicationLog(size_t max_bytes)
+  : epoch_(0)
+  , first_lsn_(1)
+  , entries_()
+  , bytes_(0)
+  , max_bytes_(max_bytes)
+{
+  struct timeval tv;
+  gettimeofday(&tv, 0);
+
+  epoch_ = ((uint64_t)tv.tv_sec << 20) ^ (uint64_t)tv.tv_usec
+         ^ ((uint64_t)getpid() << 40);
+}
+
+uint64_t ReplicationLog::append(wire::ReplicaEntry& entry) {
+  uint64_t lsn = next_lsn();
+  entry.set_lsn(lsn);
+
+  entries_.push_back(entry.SerializeAsString());
+  bytes_ += entries_.back().size();
+
+  // Always keep the newest, however big, so a live replica doesn't
+  // have to be bootstrapped again over it.
+  while(bytes_ > max_bytes_ && entries_.size() > 1) {
+    bytes_ -= entries_.front().size();
+    entries_.pop_front();
+    first_lsn_++;
+  }
+
+  return lsn;
+}
+
+Replica::Replica(Server& s, ReplicationLog& log, Connection* con)
+  : server_(s)
+  , log_(log)
+  , con_(con)
+  , state_(eBootstrap)
+  , send_w_(s.loop())
+  , busy_w_(s.loop())
+  , cursor_(0)
+  , acked_(false)
+  , acked_lsn_(0)
+  , batch_()
+  , batch_bytes_(0)
+  , names_()
+  , current_()
+  , stage_(eNextQueue)
+  , scan_(0)
+  , pos_(0)
+  , snapshots_()
+  , schedule_keys_()
+{
+  send_w_.set<Replica, &Replica::on_send>(this);
+  busy_w_.set<Replica, &Replica::on_busy>(this);
+}
+
+void Replica::start(const wire::ReplicaStart& start) {
+  if(start.has_epoch() && start.epoch() == log_.epoch() &&
+     log_.resumable_p(start.lsn())) {
+    debugs << "Replica resuming after LSN " << start.lsn() << "\n";
+
+    cursor_ = start.lsn() + 1;
+    state_ = eCatchup;
+    send_w_.start();
+    return;
+  }
+
+  bootstrap();
+}
+
+// Send everything we have, starting from the current end of the log.
+void Replica::bootstrap() {
+  Server::Queues& queues = server_.queues();
+
+  names_.clear();
+  snapshots_.clear();
+  schedule_keys_.clear();
+  stage_ = eNextQueue;
+
+  for(Server::Queues::iterator i = queues.begin();
+      i != queues.end();
+      ++i) {
+    Queue* q = i->second;
+
+    if(q->kind() == Queue::eEphemeral) continue;
+
+    names_.push_back(i->first);
+
+    // Pushes and pops are positional, so the replica has to start from
+    // exactly what we have at this moment.
+    if(q->kind() == Queue::eTransient) {
+      q->snapshot_transient(snapshots_[i->first]);
+    }
+  }
+
+  server_.schedule_keys(schedule_keys_);
+
+  cursor_ = log_.next_lsn();
+  state_ = eBootstrap;
+
+  debugs << "Bootstrapping replica with " << names_.size() << " queues\n";
+
+  send_w_.start();
+}
+
+void Replica::stop() {
+  send_w_.stop();
+  busy_w_.stop();
+}
+
+void Replica::notify() {
+  if(state_ == eLive) send_w_.start();
+}
+
+bool Replica::send(const wire::ReplicaEntry& entry) {
+  return send(entry.SerializeAsString());
+}
+
+// Add entry to the current batch, writing the batch out if it's full.
+// Returns false once the replica can't take any more right now.
+bool Replica::send(const std::string& entry) {
+  batch_.add_entries(entry);
+  batch_bytes_ += entry.size();
+
+  if(batch_bytes_ < REPLICA_BATCH_BYTES) return true;
+
+  return flush() && !con_->over_high_water_p();
+}
+
+bool Replica::flush() {
+  if(batch_bytes_ == 0) return true;
+
+  wire::ReplicaAction act;
+  act.set_type(wire::ReplicaAction::eBatch);
+
+  std::string payload = batch_.SerializeAsString();
+
+  batch_.Clear();
+  batch_bytes_ = 0;
+
+  if(payload.size() >= REPLICA_COMPRESS_MIN) {
+    std::string packed;
+    snappy::Compress(payload.data(), payload.size(), &packed);
+
+    if(packed.size() < payload.size()) {
+      act.set_compressed(true);
+      payload.swap(packed);
+    }
+  }
+
+  act.set_payload(payload);
+
+  wire::Message msg;
+  msg.set_destination("+replica");
+  msg.set_payload(act.SerializeAsString());
+
+  if(!con_->write(msg)) {
+    std::cerr << "Replica disconnected with " << lag()
+              << " changes not sent, it will resume or bootstrap "
+              << "when it reconnects\n";
+    return false;
+  }
+
+  return true;
+}
+
+void Replica::on_send(ev::prepare& w, int revents) {
+  // Let the socket drain before giving it more. Its write watcher
+  // wakes the loop once it has.
+  if(!con_->active_p() || con_->over_high_water_p()) {
+    busy_w_.stop();
+    return;
+  }
+
+  switch(state_) {
+  case eBootstrap:
+    if(!stream()) break;
+
+    send_bonds();
+
+    {
+      wire::ReplicaEntry entry;
+      entry.set_type(wire::ReplicaEntry::eSynced);
+      entry.set_epoch(log_.epoch());
+      entry.set_lsn(cursor_ - 1);
+      send(entry);
+    }
+
+    debugs << "Replica bootstrap streamed, sending "
+           << lag() << " changes made since\n";
+
+    state_ = eCatchup;
+    // fall through
+  case eCatchup:
+  case eLive:
+    if(!catch_up()) break;
+
+    if(state_ == eCatchup) {
+      debugs << "Replica is live\n";
+      state_ = eLive;
+    }
+
+    send_w_.stop();
+    break;
+  }
+
+  if(con_->active_p()) flush();
+
+  if(send_w_.is_active() && con_->active_p() &&
+     !con_->over_high_water_p()) {
+    busy_w_.start();
+  } else {
+    busy_w_.stop();
+  }
+}
+
+void Replica::on_busy(ev::idle& w, int revents) {
+  // Nothing to do here, on_send runs before the next poll.
+}
+
+// Send the next chunk of queue state. Returns true once every queue
+// has been sent.
+bool Replica::stream() {
+  int sent = 0;
+
+  while(sent < REPLICA_CHUNK) {
+    if(!con_->active_p()) return false;
+
+    switch(stage_) {
+    case eNextQueue:
+      {
+        if(names_.empty()) {
+          wire::ReplicaEntry reset;
+          reset.set_type(wire::ReplicaEntry::eResetSchedule);
+
+          stage_ = eSchedule;
+          if(!send(reset)) return false;
+          sent++;
+          break;
+        }
+
+        current_ = names_.front();
+        names_.pop_front();
+
+        optref<Queue> q = server_.queue(current_);
+        if(!q) break;
+
+        wire::ReplicaEntry decl;
+        decl.set_type(wire::ReplicaEntry::eDeclare);
+        decl.set_queue(current_);
+        decl.set_kind(declaration_type(q->kind()));
+
+        wire::ReplicaEntry reset;
+        reset.set_type(wire::ReplicaEntry::eReset);
+        reset.set_queue(current_);
+
+        send(decl);
+        sent += 2;
+
+        bool more = send(reset);
+
+        if(q->kind() == Queue::eDurable) {
+          stage_ = eDurable;
+          scan_ = 0;
+        } else if(q->kind() == Queue::eTransient) {
+          stage_ = eTransient;
+          pos_ = 0;
+        }
+
+        if(!more) return false;
+      }
+      break;
+    case eDurable:
+      {
+        optref<Queue> q = server_.queue(current_);
+        Message msg;
+
+        if(!q || !q->next_durable(scan_, msg)) {
+          stage_ = eNextQueue;
+          break;
+        }
+
+        scan_ = msg.index() + 1;
+
+        // Its append is logged when it's committed, if it isn't
+        // elided first.
+        if(q->durable_pending_p(msg.index())) break;
+
+        wire::ReplicaEntry entry;
+        entry.set_type(wire::ReplicaEntry::eAppend);
+        entry.set_queue(current_);
+        entry.set_index(msg.index());
+        entry.mutable_message()->CopyFrom(msg.wire());
+
+        if(!send(entry)) return false;
+        sent++;
+      }
+      break;
+    case eTransient:
+      {
+        std::vector<Message>& snap = snapshots_[current_];
+
+        if(pos_ >= snap.size()) {
+          snapshots_.erase(current_);
+          stage_ = eNextQueue;
+          break;
+        }
+
+        wire::ReplicaEntry entry;
+        entry.set_type(wire::ReplicaEntry::eEnqueue);
+        entry.set_queue(current_);
+        entry.mutable_message()->CopyFrom(snap[pos_++].wire());
+
+        if(!send(entry)) return false;
+        sent++;
+      }
+      break;
+    case eSchedule:
+      {
+        if(schedule_keys_.empty()) return true;
+
+        std::string key = schedule_keys_.front();
+        schedule_keys_.pop_front();
+
+        std::string val;
+        wire::ReplicaEntry entry;
+
+        if(server_.storage().get(key, val) != eValid ||
+            !entry.mutable_message()->ParseFromString(val)) {
+          break;
+        }
+
+        entry.set_type(wire::ReplicaEntry::eSchedule);
+        entry.set_key(key);
+
+        if(!send(entry)) return false;
+        sent++;
+      }
+      break;
+    }
+  }
+
+  return false;
+}
+
+// Bonds aren't kept on disk and there are few of them, so they're
+// sent all at once from what we have now.
+void Replica::send_bonds() {
+  Server::Queues& queues = server_.queues();
+
+  for(Server::Queues::iterator i = queues.begin();
+      i != queues.end();
+      ++i) {
+    Queue::List& into = i->second->bonds();
+
+    for(Queue::List::iterator j = into.begin(); j != into.end(); ++j) {
+      if((*j)->kind() == Queue::eEphemeral) continue;
+
+      wire::ReplicaEntry entry;
+      entry.set_type(wire::ReplicaEntry::eBond);
+      entry.set_queue(i->first);
+      entry.set_destination((*j)->name());
+
+      send(entry);
+    }
+  }
+}
+
+// Send the log from cursor_ on. Returns true once it's all sent.
+bool Replica::catch_up() {
+  while(cursor_ < log_.next_lsn()) {
+    if(!con_->active_p()) return false;
+
+    if(cursor_ < log_.first_lsn()) {
+      std::cerr << "Replica fell " << lag() << " changes behind, past "
+                << "the replication log, bootstrapping it again\n";
+
+      batch_.Clear();
+      batch_bytes_ = 0;
+
+      bootstrap();
+      return false;
+    }
+
+    bool more = send(log_.at(cursor_));
+    cursor_++;
+
+    if(!more) return false;
+  }
+
+  return true;
+}
+
+Replication::Replication(Server& s)
+  : server_(s)
+  , log_(s.config().replication_log_size())
+  , logging_(false)
+  , replicas_()
+  , dead_()
+  , waiting_()
+  , master_host_()
+  , master_port_(0)
+  , master_(0)
+  , retry_w_(s.loop())
+  , synced_(false)
+  , master_epoch_(0)
+  , applied_lsn_(0)
+  , reported_lsn_(0)
+{
+  retry_w_.set<Replication, &Replication::on_retry>(this);
+}
+
+Replication::~Replication() {
+  for(Replicas::iterator i = replicas_.begin(); i != replicas_.end(); ++i) {
+    delete *i;
+  }
+
+  reap();
+}
+
+void Replication::attach(Connection* con, const wire::ReplicaStart& start) {
+  logging_ = true;
+
+  Replica* r = new Replica(server_, log_, con);
+  replicas_.push_back(r);
+  r->start(start);
+}
+
+void Replication::detach(Connection* con) {
+  for(Replicas::iterator i = replicas_.begin(); i != replicas_.end(); ++i) {
+    if((*i)->connection() == con) {
+      (*i)->stop();
+      dead_.push_back(*i);
+      replicas_.erase(i);
+      return;
+    }
+  }
+}
+
+bool Replication::replicated_p(uint64_t lsn, unsigned count) {
+  if(count == 0) return true;
+
+  unsigned have = 0;
+
+  for(Replicas::iterator i = replicas_.begin(); i != replicas_.end(); ++i) {
+    if((*i)->has_p(lsn) && ++have >= count) return true;
+  }
+
+  return false;
+}
+
+void Replication::wait(Connection* con) {
+  waiting_.push_back(con);
+}
+
+void Replication::acked(Connection* con, uint64_t lsn) {
+  for(Replicas::iterator i = replicas_.begin(); i != replicas_.end(); ++i) {
+    if((*i)->connection() == con) {
+      (*i)->acked(lsn);
+      break;
+    }
+  }
+
+  // Swapped out since a failed confirm write closes the connection,
+  // which takes it out of waiting_ through lost().
+  Waiting waiting;
+  waiting.swap(waiting_);
+
+  for(Waiting::iterator i = waiting.begin(); i != waiting.end(); ++i) {
+    Connection* con = *i;
+
+    if(!con->release_confirms() && con->active_p()) {
+      waiting_.push_back(con);
+    }
+  }
+}
+
+uint64_t Replication::max_lag() {
+  uint64_t lag = 0;
+
+  for(Replicas::iterator i = replicas_.begin(); i != replicas_.end(); ++i) {
+    if((*i)->lag() > lag) lag = (*i)->lag();
+  }
+
+  return lag;
+}
+
+void Replication::reap() {
+  for(Replicas::iterator i = dead_.begin(); i != dead_.end(); ++i) {
+    delete *i;
+  }
+
+  dead_.clear();
+}
+
+void Replication::append(wire::ReplicaEntry& entry) {
+  log_.append(entry);
+
+  // Copy since a failed write can detach a replica.
+  Replicas replicas = replicas_;
+
+  for(Replicas::iterator i = replicas.begin(); i != replicas.end(); ++i) {
+    (*i)->notify();
+  }
+}
+
+void Replication::declared(std::string queue, Queue::Kind k) {
+  if(!logging_ || k == Queue::eEphemeral) return;
+
+  wire::ReplicaEntry entry;
+  entry.set_type(wire::ReplicaEntry::eDeclare);
+  entry.set_queue(queue);
+  entry.set_kind(declaration_type(k));
+
+  append(entry);
+}
+
+void Replication::bonded(std::string queue, std::string destination) {
+  if(!logging_) return;
+
+  wire::ReplicaEntry entry;
+  entry.set_type(wire::ReplicaEntry::eBond);
+  entry.set_queue(queue);
+  entry.set_destination(destination);
+
+  append(entry);
+}
+
+void Replication::appended(std::string queue, const Message& msg) {
+  if(!logging_) return;
+
+  wire::ReplicaEntry entry;
+  entry.set_type(wire::ReplicaEntry::eAppend);
+  entry.set_queue(queue);
+  entry.set_index(msg.index());
+  entry.mutable_message()->CopyFrom(msg.wire());
+
+  append(entry);
+}
+
+void Replication::erased(std::string queue, uint64_t idx) {
+  if(!logging_) return;
+
+  wire::ReplicaEntry entry;
+  entry.set_type(wire::ReplicaEntry::eErase);
+  entry.set_queue(queue);
+  entry.set_index(idx);
+
+  append(entry);
+}
+
+void Replication::enqueued(std::string queue, const Message& msg) {
+  if(!logging_) return;
+
+  wire::ReplicaEntry entry;
+  entry.set_type(wire::ReplicaEntry::eEnqueue);
+  entry.set_queue(queue);
+  entry.mutable_message()->CopyFrom(msg.wire());
+
+  append(entry);
+}
+
+void Replication::requeued(std::string queue,
+                           const std::vector<Message>& msgs)
+{
+  if(!logging_ || msgs.empty()) return;
+
+  wire::ReplicaEntry entry;
+  entry.set_type(wire::ReplicaEntry::eRequeue);
+  entry.set_queue(queue);
+
+  for(std::vector<Message>::const_iterator i = msgs.begin();
+      i != msgs.end();
+      ++i) {
+    entry.add_messages()->CopyFrom(i->wire());
+  }
+
+  append(entry);
+}
+
+void Replication::dequeued(std::string queue, unsigned count) {
+  if(!logging_ || count == 0) return;
+
+  wire::ReplicaEntry entry;
+  entry.set_type(wire::ReplicaEntry::eDequeue);
+  entry.set_queue(queue);
+  entry.set_count(count);
+
+  append(entry);
+}
+
+void Replication::reset(std::string queue) {
+  if(!logging_) return;
+
+  wire::ReplicaEntry entry;
+  entry.set_type(wire::ReplicaEntry::eReset);
+  entry.set_queue(queue);
+
+  append(entry);
+}
+
+void Replication::scheduled(const std::string& key, const Message& msg) {
+  if(!logging_) return;
+
+  wire::ReplicaEntry entry;
+  entry.set_type(wire::ReplicaEntry::eSchedule);
+  entry.set_key(key);
+  entry.mutable_message()->CopyFrom(msg.wire());
+
+  append(entry);
+}
+
+void Replication::unscheduled(const std::string& key) {
+  if(!logging_) return;
+
+  wire::ReplicaEntry entry;
+  entry.set_type(wire::ReplicaEntry::eUnschedule);
+  entry.set_key(key);
+
+  append(entry);
+}
+
+void Replication::follow(std::string host, int port) {
+  master_host_ = host;
+  master_port_ = port;
+
+  connect();
+}
+
+void Replication::connect() {
+  reported_lsn_ = 0;
+  master_ = server_.connect_replica(master_host_, master_port_);
+
+  // Starting can fail and close it before we knew it was our master.
+  if(master_ && !master_->active_p()) master_ = 0;
+
+  if(!master_) {
+    retry_w_.start(REPLICA_RETRY);
+  }
+}
+
+void Replication::lost(Connection* con) {
+  waiting_.remove(con);
+
+  if(!master_ || con != master_) return;
+
+  std::cerr << "Lost connection to master, reconnecting\n";
+
+  master_ = 0;
+  retry_w_.start(REPLICA_RETRY);
+}
+
+void Replication::on_retry(ev::timer& w, int revents) {
+  debugs << "Reconnecting to master\n";
+  connect();
+}
+
+void Replication::resume_point(wire::ReplicaStart& start) {
+  if(!synced_) return;
+
+  start.set_epoch(master_epoch_);
+  start.set_lsn(applied_lsn_);
+}
+
+void Replication::apply_batch(const std::string& payload, bool compressed) {
+  std::string raw;
+
+  if(compressed) {
+    if(!snappy::Uncompress(payload.data(), payload.size(), &raw)) {
+      std::cerr << "Received corrupt replica batch\n";
+      return;
+    }
+  }
+
+  wire::ReplicaBatch batch;
+  if(!batch.ParseFromString(compressed ? raw : payload)) {
+    std::cerr << "Received malformed replica batch\n";
+    return;
+  }
+
+  for(int i = 0; i < batch.entries_size(); i++) {
+    wire::ReplicaEntry entry;
+    if(entry.ParseFromString(batch.entries(i))) {
+      apply(entry);
+    } else {
+      std::cerr << "Received malformed replica entry\n";
+    }
+  }
+
+  send_ack();
+}
+
+// Tell our master how far we've got. The master doesn't wait for this
+// before sending more, so acks only cost a round trip for the publishes
+// waiting on them.
+void Replication::send_ack() {
+  if(!master_ || !synced_ || applied_lsn_ == reported_lsn_) return;
+
+  wire::ReplicaAction act;
+  act.set_type(wire::ReplicaAction::eAck);
+  act.set_lsn(applied_lsn_);
+
+  wire::Message msg;
+  msg.set_destination("+replica");
+  msg.set_payload(act.SerializeAsString());
+
+  if(master_->write(msg)) {
+    reported_lsn_ = applied_lsn_;
+  } else {
+    debugs << "Master disconnected while sending ack\n";
+  }
+}
+
+void Replication::apply(const wire::ReplicaEntry& entry) {
+  if(entry.type() == wire::ReplicaEntry::eSynced) {
+    std::cerr << "Caught up with master\n";
+
+    synced_ = true;
+    master_epoch_ = entry.epoch();
+    applied_lsn_ = entry.lsn();
+    return;
+  }
+
+  if(!entry.has_lsn()) {
+    // Part of a bootstrap, we can't resume until it's finished.
+    synced_ = false;
+  } else if(synced_) {
+    // Already applied, we asked to resume from before it.
+    if(entry.lsn() <= applied_lsn_) return;
+
+    if(entry.lsn() != applied_lsn_ + 1) {
+      std::cerr << "Missed replicated changes " << applied_lsn_ + 1
+                << " through " << entry.lsn() - 1
+                << ", will bootstrap on reconnect\n";
+      synced_ = false;
+    }
+
+    applied_lsn_ = entry.lsn();
+  }
+
+  if(entry.type() == wire::ReplicaEntry::eDeclare) {
+    Queue::Kind k;
+
+    switch(entry.kind()) {
+    case wire::QueueDeclaration::eBroadcast:
+      k = Queue::eBroadcast;
+      break;
+    case wire::QueueDeclaration::eDurable:
+      k = Queue::eDurable;
+      break;
+    default:
+      k = Queue::eTransient;
+      break;
+    }
+
+    if(!server_.make_queue(entry.queue(), k)) {
+      std::cerr << "Unable to declare replicated queue '"
+                << entry.queue() << "'\n";
+    }
+
+    return;
+  }
+
+  // The schedule isn't kept by queue.
+  switch(entry.type()) {
+  case wire::ReplicaEntry::eSchedule:
+    server_.apply_schedule(entry.key(), Message(entry.message()));
+    return;
+  case wire::ReplicaEntry::eUnschedule:
+    server_.apply_unschedule(entry.key());
+    return;
+  case wire::ReplicaEntry::eResetSchedule:
+    server_.apply_reset_schedule();
+    return;
+  default:
+    break;
+  }
+
+  optref<Queue> q = server_.queue(entry.queue());
+
+  if(!q) {
+    std::cerr << "Replicated change for unknown queue '"
+              << entry.queue() << "'\n";
+    return;
+  }
+
+  switch(entry.type()) {
+  case wire::ReplicaEntry::eBond:
+    if(optref<Queue> into = server_.queue(entry.destination())) {
+      if(!q->bonded_p(into.ptr())) {
+        q->broadcast_into(into.ptr());
+        bonded(entry.queue(), entry.destination());
+      }
+    } else {
+      std::cerr << "Replicated bond into unknown queue '"
+                << entry.destination() << "'\n";
+    }
+    break;
+  case wire::ReplicaEntry::eAppend:
+    {
+      Message msg(entry.message());
+      q->apply_append(entry.index(), msg);
+    }
+    break;
+  case wire::ReplicaEntry::eErase:
+    q->apply_erase(entry.index());
+    break;
+  case wire::ReplicaEntry::eEnqueue:
+    {
+      Message msg(entry.message());
+      q->apply_enqueue(msg);
+    }
+    break;
+  case wire::ReplicaEntry::eDequeue:
+    q->apply_dequeue(entry.count());
+    break;
+  case wire::ReplicaEntry::eRequeue:
+    {
+      std::vector<Message> msgs;
+      msgs.reserve(entry.messages_size());
+
+      for(int i = 0; i < entry.messages_size(); i++) {
+        msgs.push_back(Message(entry.messages(i)));
+      }
+
+      q->apply_requeue(msgs);
+    }
+    break;
+  case wire::ReplicaEntry::eReset:
+    q->apply_reset();
+    break;
+  case wire::ReplicaEntry::eDeclare:
+  case wire::ReplicaEntry::eSynced:
+  case wire::ReplicaEntry::eSchedule:
+  case wire::ReplicaEntry::eUnschedule:
+  case wire::ReplicaEntry::eResetSchedule:
+    break;
+  }
+}
@@ -0,0 +1,308 @@
+#ifndef REPLICATION_HPP
+#define REPLICATION_HPP
+
+#include <deque>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+#include <ev++.h>
+
+#include "queue.hpp"
+
+#include "wire.pb.h"
+
+class Server;
+class Connection;
+class Replication;
+
+// Replicas keep a copy of the master's queue state by applying the
+// same changes in the same order: declarations, bonds, durable appends
+// and erases, and transient pushes and pops. Deliveries themselves
+// aren't replicated, only what they leave behind, so a replica is a
+// standby and shouldn't have consumers of its own.
+
+// The changes made on the master, numbered in order by LSN starting
+// at 1. Only the most recent are kept, up to max_bytes_ worth, so a
+// replica that reconnects soon enough can pick up where it left off
+// instead of being bootstrapped all over again.
+//
+// The epoch is picked at startup. LSNs start over each run, so a
+// replica can only resume if it was following this same run.
+class ReplicationLog {
+  uint64_t epoch_;
+
+  // LSN of entries_.front().
+  uint64_t first_lsn_;
+
+  // Kept serialized, they're sent as is to every replica.
+  std::deque<std::string> entries_;
+  size_t bytes_;
+  size_t max_bytes_;
+
+  // Not copyable.
+  ReplicationLog(const ReplicationLog&);
+  ReplicationLog& operator=(const ReplicationLog&);
+
+public:
+  ReplicationLog(size_t max_bytes);
+
+  uint64_t epoch() {
+    return epoch_;
+  }
+
+  uint64_t first_lsn() {
+    return first_lsn_;
+  }
+
+  // The LSN the next change will get.
+  uint64_t next_lsn() {
+    return first_lsn_ + entries_.size();
+  }
+
+  size_t size() {
+    return entries_.size();
+  }
+
+  size_t bytes() {
+    return bytes_;
+  }
+
+  // Whether everything after lsn is still here to be sent.
+  bool resumable_p(uint64_t lsn) {
+    return lsn + 1 >= first_lsn_ && lsn < next_lsn();
+  }
+
+  const std::string& at(uint64_t lsn) {
+    return entries_[lsn - first_lsn_];
+  }
+
+  // Number entry and add it, dropping the oldest entries if that puts
+  // us over max_bytes_.
+  uint64_t append(wire::ReplicaEntry& entry);
+};
+
+// One replica attached to us, the master.
+//
+// Nothing is written to a replica from inside a change, notify() only
+// makes sure we'll look at it at the end of the loop iteration. Then
+// whatever it hasn't been sent yet is batched into frames and written
+// until its socket is over the high water mark, and the rest waits for
+// the next iteration. A replica that falls so far behind that the log
+// no longer has its position is bootstrapped again on the same
+// connection.
+//
+// A replica that's following this run and whose position is still in
+// the log only needs what came after it. Otherwise it's bootstrapped:
+// the transient queues are copied as they are right now, and then every
+// queue and the durable schedule are streamed to it a chunk per loop
+// iteration. Either way it's
+// then sent the log from its position until it's caught up, and after
+// that changes are sent as they happen.
+//
+// Durable queues are streamed from the live store rather than a
+// snapshot (SegmentStore doesn't have one), so a change from the log
+// may already be reflected in what was streamed. Replicas apply
+// durable changes idempotently, so replaying it is harmless.
+class Replica {
+public:
+  enum State { eBootstrap, eCatchup, eLive };
+  enum Stage { eNextQueue, eDurable, eTransient, eSchedule };
+
+private:
+  Server& server_;
+  ReplicationLog& log_;
+  Connection* con_;
+  State state_;
+
+  // Sends whatever's waiting just before the loop polls, so changes
+  // made while handling I/O go out in the same iteration. busy_w_ is
+  // only there to keep poll from blocking while a bootstrap or catch
+  // up has more to send and the socket has room for it.
+  ev::prepare send_w_;
+  ev::idle busy_w_;
+
+  // LSN of the next change to send. Everything in the log from here
+  // on is what's waiting to go to this replica, so the log's size is
+  // what bounds how far behind it can get.
+  uint64_t cursor_;
+
+  // The last LSN it told us it has applied. Replicas ack each batch
+  // as they apply it while we carry on sending, so this trails
+  // cursor_ by about a round trip.
+  bool acked_;
+  uint64_t acked_lsn_;
+
+  // Entries collected to go out in one frame.
+  wire::ReplicaBatch batch_;
+  size_t batch_bytes_;
+
+  // Queues left to stream and where we are in the current one.
+  std::deque<std::string> names_;
+  std::string current_;
+  Stage stage_;
+  uint64_t scan_;
+  size_t pos_;
+
+  // Transient queues as they were when the bootstrap started.
+  typedef std::map<std::string, std::vector<Message> > Snapshots;
+  Snapshots snapshots_;
+
+  // Keys of the durable scheduled messages left to send once the
+  // queues are done. Ones gone by the time we get to them are skipped,
+  // the log has their delete.
+  std::deque<std::string> schedule_keys_;
+
+  // Not copyable.
+  Replica(const Replica&);
+  Replica& operator=(const Replica&);
+
+public:
+  Replica(Server& s, ReplicationLog& log, Connection* con);
+
+  Connection* connection() {
+    return con_;
+  }
+
+  State state() {
+    return state_;
+  }
+
+  // How many changes we have that it hasn't been sent.
+  uint64_t lag() {
+    return log_.next_lsn() - cursor_;
+  }
+
+  bool has_p(uint64_t lsn) {
+    return acked_ && acked_lsn_ >= lsn;
+  }
+
+  void acked(uint64_t lsn) {
+    acked_ = true;
+    if(lsn > acked_lsn_) acked_lsn_ = lsn;
+  }
+
+  void start(const wire::ReplicaStart& start);
+  void stop();
+
+  // A change was added to the log.
+  void notify();
+
+  void on_send(ev::prepare& w, int revents);
+  void on_busy(ev::idle& w, int revents);
+
+private:
+  bool send(const wire::ReplicaEntry& entry);
+  bool send(const std::string& entry);
+  bool flush();
+  void bootstrap();
+  bool stream();
+  bool catch_up();
+  void send_bonds();
+};
+
+class Replication {
+  Server& server_;
+  ReplicationLog log_;
+
+  // Changes are only logged once a replica has attached, and from then
+  // on even while none are, so that one can come back.
+  bool logging_;
+
+  typedef std::list<Replica*> Replicas;
+  Replicas replicas_;
+
+  // Detached, deleted from Server::cleanup once nothing is using them.
+  Replicas dead_;
+
+  // Connections holding confirms until their changes are replicated.
+  typedef std::list<Connection*> Waiting;
+  Waiting waiting_;
+
+  // When we're a replica, our master and how far we've followed it.
+  std::string master_host_;
+  int master_port_;
+  Connection* master_;
+  ev::timer retry_w_;
+
+  bool synced_;
+  uint64_t master_epoch_;
+  uint64_t applied_lsn_;
+
+  // The last LSN we acked to our master.
+  uint64_t reported_lsn_;
+
+  // Not copyable.
+  Replication(const Replication&);
+  Replication& operator=(const Replication&);
+
+public:
+  Replication(Server& s);
+  ~Replication();
+
+  ReplicationLog& log() {
+    return log_;
+  }
+
+  bool active_p() {
+    return !replicas_.empty();
+  }
+
+  uint64_t applied_lsn() {
+    return applied_lsn_;
+  }
+
+  // We're a replica, our master makes the changes.
+  bool following_p() {
+    return master_port_ > 0;
+  }
+
+  // The most changes any replica is behind by.
+  uint64_t max_lag();
+
+  void attach(Connection* con, const wire::ReplicaStart& start);
+  void detach(Connection* con);
+  void reap();
+
+  // Whether at least count replicas have applied the change at lsn.
+  bool replicated_p(uint64_t lsn, unsigned count);
+
+  // con is holding confirms, tell it when replicas ack something.
+  void wait(Connection* con);
+  void acked(Connection* con, uint64_t lsn);
+
+  // The changes we replicate, called as they happen on the master.
+  void declared(std::string queue, Queue::Kind k);
+  void bonded(std::string queue, std::string destination);
+  void appended(std::string queue, const Message& msg);
+  void erased(std::string queue, uint64_t idx);
+  void enqueued(std::string queue, const Message& msg);
+  void dequeued(std::string queue, unsigned count);
+  void requeued(std::string queue, const std::vector<Message>& msgs);
+  void reset(std::string queue);
+  void scheduled(const std::string& key, const Message& msg);
+  void unscheduled(const std::string& key);
+
+  // Become a replica of the server at host:port, reconnecting and
+  // resuming whenever the connection drops.
+  void follow(std::string host, int port);
+  void lost(Connection* con);
+  void on_retry(ev::timer& w, int revents);
+
+  // Where to ask our master to resume from.
+  void resume_point(wire::ReplicaStart& start);
+
+  // Apply a change, or a batch of them, from our master.
+  void apply(const wire::ReplicaEntry& entry);
+  void apply_batch(const std::string& payload, bool compressed);
+
+private:
+  void append(wire::ReplicaEntry& entry);
+  void connect();
+  void send_ack();
+};
+
+#endif
@@ -0,0 +1,189 @@
+#ifndef SEGMENT_QUEUE_HPP
+#define SEGMENT_QUEUE_HPP
+
+#include <deque>
+#include <new>
+
+#include <stddef.h>
+
+// A FIFO stored as a deque of fixed size segments. Elements are
+// constructed in place inside the segments, so pushing and popping
+// don't allocate per element (a segment is only allocated every N
+// pushes, and the last freed one is kept around for reuse) and
+// walking the queue touches contiguous memory.
+//
+// Only the ends change: push_back, push_front, front and pop_front.
+template <typename T, int N = 1024>
+class SegmentQueue {
+  struct Segment {
+    union {
+      char bytes[N * sizeof(T)];
+      double align_;
+      void* align_ptr_;
+    };
+  };
+
+  typedef std::deque<Segment*> Segments;
+
+  Segments segments_;
+
+  // Index of the first element in the first segment, and one past the
+  // last element in the last segment.
+  int head_;
+  int tail_;
+
+  size_t size_;
+
+  Segment* spare_;
+
+  // Not copyable.
+  SegmentQueue(const SegmentQueue&);
+  SegmentQueue& operator=(const SegmentQueue&);
+
+  static T* slot(Segment* seg, int i) {
+    return reinterpret_cast<T*>(seg->bytes) + i;
+  }
+
+  Segment* alloc() {
+    if(spare_) {
+      Segment* seg = spare_;
+      spare_ = 0;
+      return seg;
+    }
+
+    return new Segment;
+  }
+
+  void release(Segment* seg) {
+    if(spare_) {
+      delete seg;
+    } else {
+      spare_ = seg;
+    }
+  }
+
+public:
+  class iterator {
+    SegmentQueue* q_;
+    size_t seg_;
+    int idx_;
+
+  public:
+    iterator(SegmentQueue* q, size_t seg, int idx)
+      : q_(q)
+      , seg_(seg)
+      , idx_(idx)
+    {}
+
+    T& operator*() {
+      return *slot(q_->segments_[seg_], idx_);
+    }
+
+    T* operator->() {
+      return slot(q_->segments_[seg_], idx_);
+    }
+
+    iterator& operator++() {
+      if(++idx_ == N) {
+        seg_++;
+        idx_ = 0;
+      }
+
+      return *this;
+    }
+
+    bool operator==(const iterator& other) const {
+      return seg_ == other.seg_ && idx_ == other.idx_;
+    }
+
+    bool operator!=(const iterator& other) const {
+      return !(*this == other);
+    }
+  };
+
+  SegmentQueue()
+    : segments_()
+    , head_(0)
+    , tail_(0)
+    , size_(0)
+    , spare_(0)
+  {}
+
+  ~SegmentQueue() {
+    clear();
+    delete spare_;
+  }
+
+  size_t size() const {
+    return size_;
+  }
+
+  bool empty() const {
+    return size_ == 0;
+  }
+
+  T& front() {
+    return *slot(segments_.front(), head_);
+  }
+
+  void push_back(const T& val) {
+    if(segments_.empty() || tail_ == N) {
+      segments_.push_back(alloc());
+      tail_ = 0;
+    }
+
+    new(slot(segments_.back(), tail_)) T(val);
+    tail_++;
+    size_++;
+  }
+
+  void push_front(const T& val) {
+    if(segments_.empty()) {
+      segments_.push_back(alloc());
+      head_ = N;
+      tail_ = N;
+    } else if(head_ == 0) {
+      segments_.push_front(alloc());
+      head_ = N;
+    }
+
+    head_--;
+    new(slot(segments_.front(), head_)) T(val);
+    size_++;
+  }
+
+  void pop_front() {
+    slot(segments_.front(), head_)->~T();
+    head_++;
+    size_--;
+
+    if(size_ == 0) {
+      release(segments_.front());
+      segments_.clear();
+      head_ = 0;
+      tail_ = 0;
+    } else if(head_ == N) {
+      release(segments_.front());
+      segments_.pop_front();
+      head_ = 0;
+    }
+  }
+
+  void clear() {
+    while(size_ > 0) pop_front();
+  }
+
+  iterator begin() {
+    return iterator(this, 0, head_);
+  }
+
+  iterator end() {
+    if(segments_.empty()) return begin();
+
+    // One past the last element, normalized the same way ++ does.
+    if(tail_ == N) return iterator(this, segments_.size(), 0);
+    return iterator(this, segments_.size() - 1, tail_);
+  }
+};
+
+#endif
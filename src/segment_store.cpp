@@ -0,0 +1,645 @@
+#include "segment_store.hpp"
+#include "message.hpp"
+#include "debugs.hpp"
+
+#include "wire.pb.h"
+
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#define RECORD_HEADER 4
+
+// When to start a new segment. Smaller segments are freed sooner once
+// they're consumed, larger ones mean fewer files.
+#define SEGMENT_MESSAGES 4096
+#define SEGMENT_BYTES (4 * 1024 * 1024)
+
+// Gaps in the indexes shorter than this are filled in the current
+// segment rather than starting a new one.
+#define SEGMENT_GAP 64
+
+// acks.log is rewritten once it has this many entries, if most of them
+// refer to segments that are gone.
+#define ACKS_COMPACT 65536
+
+static bool write_all(int fd, const char* buf, size_t len, off_t pos) {
+  size_t done = 0;
+
+  while(done < len) {
+    ssize_t r = pwrite(fd, buf + done, len - done, pos + done);
+
+    if(r < 0) {
+      if(errno == EINTR) continue;
+      return false;
+    }
+
+    done += r;
+  }
+
+  return true;
+}
+
+// For fds opened with O_APPEND, where pwrite's offset doesn't apply.
+static bool append_bytes(int fd, const char* buf, size_t len) {
+  size_t done = 0;
+
+  while(done < len) {
+    ssize_t r = write(fd, buf + done, len - done);
+
+    if(r < 0) {
+      if(errno == EINTR) continue;
+      return false;
+    }
+
+    done += r;
+  }
+
+  return true;
+}
+
+SegmentStore::~SegmentStore() {
+  for(Segments::iterator i = segments_.begin();
+      i != segments_.end();
+      ++i) {
+    close(i->second->fd);
+    delete i->second;
+  }
+
+  if(acks_fd_ >= 0) close(acks_fd_);
+}
+
+std::string SegmentStore::segment_path(uint64_t first) {
+  std::stringstream ss;
+  ss << dir_ << "/" << std::hex << std::setw(16) << std::setfill('0')
+     << first << ".seg";
+
+  return ss.str();
+}
+
+std::string SegmentStore::acks_path() {
+  return dir_ + "/acks.log";
+}
+
+// Read the segments and acks.log back in. Done the first time the
+// store is used rather than at startup.
+bool SegmentStore::open() {
+  if(opened_) return acks_fd_ >= 0;
+  opened_ = true;
+
+  if(mkdir(dir_.c_str(), 0700) != 0 && errno != EEXIST) {
+    std::cerr << "Unable to create segment directory " << dir_
+              << " (" << strerror(errno) << ")\n";
+    return false;
+  }
+
+  DIR* dir = opendir(dir_.c_str());
+  if(!dir) {
+    std::cerr << "Unable to read segment directory " << dir_ << "\n";
+    return false;
+  }
+
+  struct dirent* ent;
+
+  while((ent = readdir(dir)) != 0) {
+    std::string name = ent->d_name;
+
+    if(name.size() != 20 || name.compare(16, 4, ".seg") != 0) continue;
+
+    uint64_t first = strtoull(name.substr(0, 16).c_str(), 0, 16);
+    segments_[first] = new Segment(first);
+  }
+
+  closedir(dir);
+
+  for(Segments::iterator i = segments_.begin();
+      i != segments_.end();
+      ++i) {
+    if(!load_segment(i->second)) return false;
+  }
+
+  if(!segments_.empty()) {
+    Segment* tail = segments_.rbegin()->second;
+    next_index_ = tail->first + tail->offsets.size();
+  }
+
+  if(!replay_acks()) return false;
+
+  // Drop anything that was fully consumed before we last stopped,
+  // except the newest segment, which is where next_index_ comes from.
+  Segments::iterator i = segments_.begin();
+
+  while(i != segments_.end()) {
+    Segment* seg = i->second;
+    ++i;
+
+    if(seg->live == 0 && i != segments_.end()) drop(seg);
+  }
+
+  acks_fd_ = ::open(acks_path().c_str(), O_WRONLY | O_CREAT | O_APPEND, 0600);
+
+  if(acks_fd_ < 0) {
+    std::cerr << "Unable to open " << acks_path()
+              << " (" << strerror(errno) << ")\n";
+    return false;
+  }
+
+  debugs << "Opened segment store " << dir_ << " with " << live_
+         << " messages in " << segments_.size() << " segments\n";
+
+  return true;
+}
+
+// Find where each record starts. A record cut short by a crash is
+// truncated off the end.
+bool SegmentStore::load_segment(Segment* seg) {
+  std::string path = segment_path(seg->first);
+
+  seg->fd = ::open(path.c_str(), O_RDWR);
+
+  if(seg->fd < 0) {
+    std::cerr << "Unable to open segment " << path
+              << " (" << strerror(errno) << ")\n";
+    return false;
+  }
+
+  struct stat st;
+  if(fstat(seg->fd, &st) != 0) {
+    std::cerr << "Unable to stat segment " << path << "\n";
+    return false;
+  }
+
+  off_t pos = 0;
+
+  while(pos + RECORD_HEADER <= st.st_size) {
+    uint32_t len;
+
+    if(pread(seg->fd, &len, RECORD_HEADER, pos) != RECORD_HEADER) break;
+    if(pos + RECORD_HEADER + (off_t)len > st.st_size) break;
+
+    // An empty record fills an index that was skipped.
+    seg->offsets.push_back(pos);
+    seg->erased.push_back(len == 0);
+
+    if(len > 0) {
+      seg->live++;
+      live_++;
+    }
+
+    pos += RECORD_HEADER + len;
+  }
+
+  if(pos != st.st_size) {
+    std::cerr << "Truncating partial record at the end of " << path << "\n";
+
+    if(ftruncate(seg->fd, pos) != 0) {
+      std::cerr << "Unable to truncate " << path << "\n";
+      return false;
+    }
+  }
+
+  seg->size = pos;
+
+  return true;
+}
+
+bool SegmentStore::replay_acks() {
+  int fd = ::open(acks_path().c_str(), O_RDONLY);
+
+  if(fd < 0) {
+    if(errno == ENOENT) return true;
+
+    std::cerr << "Unable to open " << acks_path()
+              << " (" << strerror(errno) << ")\n";
+    return false;
+  }
+
+  uint64_t buf[1024];
+
+  // Bytes of an entry split across reads, carried to the next one.
+  size_t have = 0;
+
+  for(;;) {
+    ssize_t r = read(fd, (char*)buf + have, sizeof(buf) - have);
+
+    if(r < 0) {
+      if(errno == EINTR) continue;
+
+      std::cerr << "Error reading " << acks_path() << "\n";
+      close(fd);
+      return false;
+    }
+
+    if(r == 0) break;
+
+    have += r;
+
+    size_t entries = have / sizeof(uint64_t);
+
+    for(size_t j = 0; j < entries; j++) {
+      Segment* seg = find(buf[j]);
+      if(!seg) continue;
+
+      size_t pos = buf[j] - seg->first;
+
+      if(!seg->erased[pos]) {
+        seg->erased[pos] = true;
+        seg->live--;
+        live_--;
+      }
+    }
+
+    acks_written_ += entries;
+
+    have -= entries * sizeof(uint64_t);
+    memmove(buf, buf + entries, have);
+  }
+
+  close(fd);
+
+  // An entry cut short by a crash would misalign everything appended
+  // after it.
+  if(have > 0) {
+    std::cerr << "Truncating partial entry at the end of "
+              << acks_path() << "\n";
+
+    if(truncate(acks_path().c_str(),
+                acks_written_ * sizeof(uint64_t)) != 0) {
+      std::cerr << "Unable to truncate " << acks_path() << "\n";
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Rewrite acks.log with only the entries for segments still around.
+bool SegmentStore::compact_acks() {
+  std::string tmp = acks_path() + ".tmp";
+
+  int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+
+  if(fd < 0) {
+    std::cerr << "Unable to open " << tmp
+              << " (" << strerror(errno) << ")\n";
+    return false;
+  }
+
+  std::vector<uint64_t> entries;
+
+  for(Segments::iterator i = segments_.begin();
+      i != segments_.end();
+      ++i) {
+    Segment* seg = i->second;
+
+    for(size_t j = 0; j < seg->erased.size(); j++) {
+      if(seg->erased[j]) entries.push_back(seg->first + j);
+    }
+  }
+
+  size_t len = entries.size() * sizeof(uint64_t);
+
+  if(!write_all(fd, (const char*)entries.data(), len, 0) ||
+      rename(tmp.c_str(), acks_path().c_str()) != 0) {
+    std::cerr << "Unable to rewrite " << acks_path() << "\n";
+    close(fd);
+    unlink(tmp.c_str());
+    return false;
+  }
+
+  close(fd);
+  close(acks_fd_);
+
+  acks_fd_ = ::open(acks_path().c_str(), O_WRONLY | O_APPEND);
+  acks_written_ = entries.size();
+
+  debugs << "Compacted " << acks_path() << " to " << acks_written_
+         << " entries\n";
+
+  return acks_fd_ >= 0;
+}
+
+SegmentStore::Segment* SegmentStore::find(uint64_t idx) {
+  Segments::iterator i = segments_.upper_bound(idx);
+  if(i == segments_.begin()) return 0;
+
+  --i;
+
+  Segment* seg = i->second;
+  if(idx >= seg->first + seg->offsets.size()) return 0;
+
+  return seg;
+}
+
+void SegmentStore::drop(Segment* seg) {
+  std::string path = segment_path(seg->first);
+
+  close(seg->fd);
+
+  if(unlink(path.c_str()) != 0) {
+    std::cerr << "Unable to remove consumed segment " << path << "\n";
+  }
+
+  debugs << "Removed consumed segment " << path << "\n";
+
+  segments_.erase(seg->first);
+  delete seg;
+}
+
+SegmentStore::Segment* SegmentStore::roll() {
+  Segment* prev = segments_.empty() ? 0 : segments_.rbegin()->second;
+
+  Segment* seg = new Segment(next_index_);
+  std::string path = segment_path(next_index_);
+
+  seg->fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+
+  if(seg->fd < 0) {
+    std::cerr << "Unable to create segment " << path
+              << " (" << strerror(errno) << ")\n";
+    delete seg;
+    return 0;
+  }
+
+  segments_[seg->first] = seg;
+
+  // The old tail was only kept to remember next_index_.
+  if(prev && prev->live == 0) drop(prev);
+
+  return seg;
+}
+
+bool SegmentStore::clear() {
+  if(!open()) return false;
+
+  while(!segments_.empty()) {
+    drop(segments_.begin()->second);
+  }
+
+  if(ftruncate(acks_fd_, 0) != 0) {
+    std::cerr << "Unable to truncate " << acks_path() << "\n";
+    return false;
+  }
+
+  next_index_ = 0;
+  live_ = 0;
+  acks_written_ = 0;
+
+  return true;
+}
+
+unsigned SegmentStore::size() {
+  if(!open()) return 0;
+  return live_;
+}
+
+uint64_t SegmentStore::next_index() {
+  if(!open()) return 0;
+  return next_index_;
+}
+
+bool SegmentStore::has(uint64_t idx) {
+  if(!open()) return false;
+
+  Segment* seg = find(idx);
+  return seg && !seg->erased[idx - seg->first];
+}
+
+bool SegmentStore::append_at(uint64_t idx, Message& msg) {
+  Appends msgs;
+  msgs[idx] = msg;
+
+  return append_all(msgs);
+}
+
+// One write per segment the messages land in.
+bool SegmentStore::append_all(Appends& msgs) {
+  if(!open()) return false;
+
+  while(!msgs.empty()) {
+    if(!append_run(msgs)) return false;
+  }
+
+  return true;
+}
+
+// Write as many messages from the front of msgs as fit in the newest
+// segment, or a new one, and take them out of msgs.
+bool SegmentStore::append_run(Appends& msgs) {
+  uint64_t idx = msgs.begin()->first;
+
+  if(idx < next_index_) {
+    std::cerr << "Attempted to append " << idx << " behind the end of "
+              << dir_ << "\n";
+    return false;
+  }
+
+  Segment* seg = segments_.empty() ? 0 : segments_.rbegin()->second;
+
+  // Offsets within a segment are dense. A short gap, like the ones
+  // left by elided writes, is filled with empty records, anything
+  // longer starts a new segment at idx.
+  uint64_t gap = idx - next_index_;
+
+  if(!seg || gap >= SEGMENT_GAP ||
+      seg->offsets.size() + gap >= SEGMENT_MESSAGES ||
+      seg->size >= SEGMENT_BYTES) {
+    next_index_ = idx;
+
+    seg = roll();
+    if(!seg) return false;
+  }
+
+  std::string data;
+  std::vector<off_t> offsets;
+  std::vector<bool> erased;
+  uint64_t next = next_index_;
+
+  Appends::iterator i = msgs.begin();
+
+  for(; i != msgs.end(); ++i) {
+    gap = i->first - next;
+
+    if(i != msgs.begin() &&
+        (gap >= SEGMENT_GAP ||
+         seg->offsets.size() + offsets.size() + gap >= SEGMENT_MESSAGES ||
+         seg->size + (off_t)data.size() >= SEGMENT_BYTES)) {
+      break;
+    }
+
+    std::string rec;
+
+    if(!i->second->SerializeToString(&rec)) {
+      std::cerr << "Error serializing message to segment\n";
+      return false;
+    }
+
+    for(uint64_t g = 0; g < gap; g++) {
+      offsets.push_back(seg->size + data.size());
+      erased.push_back(true);
+      data.append(RECORD_HEADER, '\0');
+    }
+
+    uint32_t len = rec.size();
+
+    offsets.push_back(seg->size + data.size());
+    erased.push_back(false);
+    data.append((const char*)&len, RECORD_HEADER);
+    data.append(rec);
+
+    next = i->first + 1;
+  }
+
+  if(!write_all(seg->fd, data.data(), data.size(), seg->size)) {
+    std::cerr << "Error writing segment in " << dir_
+              << " (" << strerror(errno) << ")\n";
+
+    // Don't leave half a record behind for the next one to follow.
+    if(ftruncate(seg->fd, seg->size) != 0) {
+      std::cerr << "Unable to truncate segment in " << dir_ << "\n";
+    }
+
+    return false;
+  }
+
+  seg->offsets.insert(seg->offsets.end(), offsets.begin(), offsets.end());
+  seg->erased.insert(seg->erased.end(), erased.begin(), erased.end());
+  seg->size += data.size();
+
+  next_index_ = next;
+
+  for(Appends::iterator j = msgs.begin(); j != i;) {
+    seg->live++;
+    live_++;
+
+    j->second.make_durable(j->first);
+    msgs.erase(j++);
+  }
+
+  return true;
+}
+
+bool SegmentStore::erase(uint64_t idx) {
+  std::vector<uint64_t> idxs(1, idx);
+  return erase_all(idxs);
+}
+
+// All the indexes go into acks.log with one write.
+bool SegmentStore::erase_all(const std::vector<uint64_t>& idxs) {
+  if(!open()) return false;
+
+  std::vector<uint64_t> found;
+  found.reserve(idxs.size());
+
+  for(std::vector<uint64_t>::const_iterator i = idxs.begin();
+      i != idxs.end();
+      ++i) {
+    Segment* seg = find(*i);
+
+    if(!seg || seg->erased[*i - seg->first]) {
+      std::cerr << "Unable to find message " << *i << " in " << dir_ << "\n";
+      continue;
+    }
+
+    found.push_back(*i);
+  }
+
+  if(found.empty()) return idxs.empty();
+
+  size_t bytes = found.size() * sizeof(uint64_t);
+
+  if(!append_bytes(acks_fd_, (const char*)&found[0], bytes)) {
+    std::cerr << "Error writing " << acks_path()
+              << " (" << strerror(errno) << ")\n";
+
+    // Don't leave part of an entry for the next ones to follow.
+    if(ftruncate(acks_fd_, acks_written_ * sizeof(uint64_t)) != 0) {
+      std::cerr << "Unable to truncate " << acks_path() << "\n";
+    }
+
+    return false;
+  }
+
+  acks_written_ += found.size();
+
+  for(std::vector<uint64_t>::iterator i = found.begin();
+      i != found.end();
+      ++i) {
+    Segment* seg = find(*i);
+
+    // Erasing the last of an earlier index may have dropped it.
+    if(!seg) continue;
+
+    size_t pos = *i - seg->first;
+    if(seg->erased[pos]) continue;
+
+    seg->erased[pos] = true;
+    seg->live--;
+    live_--;
+
+    if(seg->live == 0 && seg != segments_.rbegin()->second) drop(seg);
+  }
+
+  if(acks_written_ >= ACKS_COMPACT) {
+    size_t erased = 0;
+
+    for(Segments::iterator i = segments_.begin();
+        i != segments_.end();
+        ++i) {
+      erased += i->second->offsets.size() - i->second->live;
+    }
+
+    if(erased < acks_written_ / 2) compact_acks();
+  }
+
+  return true;
+}
+
+bool SegmentStore::next(uint64_t from, Message& msg) {
+  if(!open()) return false;
+
+  Segments::iterator i = segments_.upper_bound(from);
+  if(i != segments_.begin()) --i;
+
+  std::string buf;
+
+  for(; i != segments_.end(); ++i) {
+    Segment* seg = i->second;
+
+    size_t j = from > seg->first ? from - seg->first : 0;
+
+    for(; j < seg->offsets.size(); j++) {
+      if(seg->erased[j]) continue;
+
+      off_t start = seg->offsets[j] + RECORD_HEADER;
+      off_t end = j + 1 < seg->offsets.size() ? seg->offsets[j+1] : seg->size;
+
+      buf.resize(end - start);
+
+      if(pread(seg->fd, &buf[0], buf.size(), start) != (ssize_t)buf.size()) {
+        std::cerr << "Error reading segment in " << dir_ << "\n";
+        continue;
+      }
+
+      msg = Message(seg->first + j);
+
+      if(!msg.wire().ParseFromString(buf)) {
+        std::cerr << "Encountered corrupt message in " << dir_ << "\n";
+        continue;
+      }
+
+      return true;
+    }
+  }
+
+  return false;
+}
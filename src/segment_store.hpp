@@ -0,0 +1,115 @@
+#ifndef SEGMENT_STORE_HPP
+#define SEGMENT_STORE_HPP
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+#include <sys/types.h>
+
+#include "durable_store.hpp"
+
+// Keeps a durable queue as a directory of append-only segment files
+// plus an append-only log of erased indexes.
+//
+// A segment is named by the index of its first message and holds
+// records of [4 byte length][serialized wire::Message]. Appending is a
+// single write at the end of the newest segment, and erasing is an 8
+// byte write at the end of acks.log, so neither rewrites anything.
+//
+// The offset of every record and which ones are erased are kept in
+// memory. Once every message in a segment has been erased the file is
+// unlinked, and acks.log is rewritten when it's grown mostly stale.
+//
+// Nothing is fsync'd, the same as LevelDB's default writes. Everything
+// written survives the process crashing but not the machine, which can
+// lose whatever the OS hadn't written back yet. A record or ack entry
+// left incomplete is cut off the end of its file when it's next
+// opened.
+class SegmentStore : public DurableStore {
+  struct Segment {
+    uint64_t first;
+    int fd;
+    off_t size;
+    unsigned live;
+
+    std::vector<off_t> offsets;
+    std::vector<bool> erased;
+
+    Segment(uint64_t f)
+      : first(f)
+      , fd(-1)
+      , size(0)
+      , live(0)
+      , offsets()
+      , erased()
+    {}
+  };
+
+  typedef std::map<uint64_t, Segment*> Segments;
+
+  std::string dir_;
+  bool opened_;
+
+  Segments segments_;
+
+  uint64_t next_index_;
+  unsigned live_;
+
+  int acks_fd_;
+  uint64_t acks_written_;
+
+  // Not copyable.
+  SegmentStore(const SegmentStore&);
+  SegmentStore& operator=(const SegmentStore&);
+
+public:
+  SegmentStore(std::string dir)
+    : dir_(dir)
+    , opened_(false)
+    , segments_()
+    , next_index_(0)
+    , live_(0)
+    , acks_fd_(-1)
+    , acks_written_(0)
+  {}
+
+  ~SegmentStore();
+
+  uint64_t next_index();
+  bool append_at(uint64_t idx, Message& msg);
+  bool append_all(Appends& msgs);
+  bool has(uint64_t idx);
+  bool erase(uint64_t idx);
+  bool erase_all(const std::vector<uint64_t>& idxs);
+  unsigned size();
+  bool clear();
+  bool next(uint64_t from, Message& msg);
+
+  // Consumed segments are unlinked as soon as they're done and acks.log
+  // is rewritten as it goes, so there's never anything left to do.
+  bool compact() {
+    return false;
+  }
+
+  bool warm() {
+    return open();
+  }
+
+private:
+  bool open();
+  bool load_segment(Segment* seg);
+  bool append_run(Appends& msgs);
+  bool replay_acks();
+  bool compact_acks();
+
+  Segment* roll();
+  Segment* find(uint64_t idx);
+  void drop(Segment* seg);
+
+  std::string segment_path(uint64_t first);
+  std::string acks_path();
+};
+
+#endif
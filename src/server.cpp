@@ -10,18 +10,27 @@
 
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/stat.h>
 #include <netdb.h>
+#include <dirent.h>
 #include <errno.h>
 
 #include <iostream>
 #include <sstream>
-
-#include "leveldb/write_batch.h"
+#include <iomanip>
+#include <set>
 
 #include "debugs.hpp"
 #include "util.hpp"
 #include "server.hpp"
 #include "connection.hpp"
+#include "config.hpp"
+#include "metrics.hpp"
+#include "level_store.hpp"
+#include "segment_store.hpp"
+#include "warmup.hpp"
+#include "replication.hpp"
+#include "write_behind.hpp"
 
 #include "flags.hpp"
 #include "types.hpp"
@@ -42,29 +51,66 @@
 #define EVBACKEND EVBACKEND_KQUEUE
 #endif
 
-#define HARQ_CONFIG "!harq.config"
-
 Server::Server(Config& cfg, std::string db_path, std::string hostaddr, int port)
     : config_(cfg)
     , db_path_(db_path)
     , hostaddr_(hostaddr)
     , port_(port)
     , fd_(-1)
+    , storage_(0)
     , loop_(EVBACKEND)
     , connection_watcher_(loop_)
     , sigint_watcher_(loop_)
     , sigterm_watcher_(loop_)
     , cleanup_watcher_(loop_)
+    , compact_timer_(loop_)
+    , commit_timer_(loop_)
+    , uncommitted_()
+    , written_()
+    , elided_writes_(0)
+    , readahead_w_(loop_)
+    , readahead_()
+    , flushes_()
+    , flush_set_()
+    , flush_timer_(loop_)
+    , expiries_(TIMER_RESOLUTION, loop_.now())
+    , expire_timer_(loop_)
+    , queue_serials_()
+    , schedule_(TIMER_RESOLUTION, loop_.now())
+    , schedule_timer_(loop_)
+    , next_schedule_(0)
+    , delivered_()
+    , ack_timeouts_(TIMER_RESOLUTION, loop_.now())
+    , ack_timer_(loop_)
+    , ack_owners_()
+    , compact_cursor_()
+    , paused_()
+    , memory_bytes_(0)
+    , spill_dir_(db_path + ".spill")
+    , next_spill_(0)
+    , segment_dir_(db_path + ".segments")
     , next_id_(0)
+    , catalog_()
+    , metrics_(0)
+    , warmer_(0)
+    , replication_(0)
 {
-  options_.create_if_missing = true;
+  storage_ = make_storage_engine(config_, db_path_);
+  if(!storage_) {
+    std::cerr << "Unknown storage engine " << config_.storage_engine() << "\n";
+    exit(1);
+  }
 
-  leveldb::Status s = leveldb::DB::Open(options_, db_path_, &db_);
-  if(!s.ok()) {
-    puts(s.ToString().c_str());
+  std::string error;
+  if(!storage_->open(error)) {
+    puts(error.c_str());
     exit(1);
   }
 
+  clear_spill_dir();
+
+  replication_ = new Replication(ref(this));
+
   sigint_watcher_.set<Server, &Server::on_signal>(this);
   sigint_watcher_.start(SIGINT);
 
@@ -73,10 +119,29 @@ Server::Server(Config& cfg, std::string db_path, std::string hostaddr, int port)
 
   cleanup_watcher_.set<Server, &Server::cleanup>(this);
   cleanup_watcher_.start();
+
+  compact_timer_.set<Server, &Server::on_compact>(this);
+  commit_timer_.set<Server, &Server::on_commit>(this);
+  readahead_w_.set<Server, &Server::on_readahead>(this);
+  flush_timer_.set<Server, &Server::on_flush>(this);
+  expire_timer_.set<Server, &Server::on_expire>(this);
+  schedule_timer_.set<Server, &Server::on_schedule>(this);
+  ack_timer_.set<Server, &Server::on_ack_timeout>(this);
+
+  // Keys from an earlier run can't be reused, so the sequence carries
+  // on from the time we started.
+  next_schedule_ = (uint64_t)(loop_.now() * 1000000);
 }
 
 Server::~Server() {
-  delete db_;
+  commit_writes();
+  forget_delivered();
+  save_durable_counts();
+
+  delete replication_;
+  delete warmer_;
+  delete metrics_;
+  delete storage_;
   close(fd_);
 }
 
@@ -93,75 +158,818 @@ void Server::cleanup(ev::check& w, int revents) {
   }
 
   closing_connections_.clear();
+
+  replication_->reap();
+
+  if(!paused_.empty()) resume_publishers();
 }
 
+void Server::remove_connection(Connection* con) {
+  connections_.remove(con);
+  paused_.remove(con);
 
-DataStatus Server::read_queue(std::string name, wire::Queue& qi) {
-  std::string val;
-  leveldb::Status s = db_->Get(leveldb::ReadOptions(), dname(name), &val);
+  if(replica_p(con)) {
+    replicas_.remove(con);
+    replication_->detach(con);
+  }
+
+  replication_->lost(con);
+
+  closing_connections_.push_back(con);
+}
+
+bool Server::replica_p(Connection* con) {
+  for(Connections::iterator i = replicas_.begin();
+      i != replicas_.end();
+      ++i) {
+    if(*i == con) return true;
+  }
+
+  return false;
+}
+
+// A replica connected to us, start bringing it up to date.
+void Server::add_replica(Connection* con, const wire::ReplicaStart& start) {
+  replicas_.push_back(con);
+  replication_->attach(con, start);
+}
+
+void Server::schedule_commit(WriteBehindStore* store) {
+  uncommitted_.push_back(store);
+
+  if(!commit_timer_.is_active()) {
+    commit_timer_.start(config_.write_behind());
+  }
+}
+
+void Server::forget_commit(WriteBehindStore* store) {
+  uncommitted_.remove(store);
+  written_.erase(store);
+}
 
-  if(s.IsNotFound()) return eMissing;
+// Commit every write-behind store. One that fails stays queued and is
+// tried again when the window is next up.
+bool Server::commit_writes() {
+  if(uncommitted_.empty()) return true;
 
-  if(s.ok()) {
-    if(qi.ParseFromString(val)) {
-      return eValid;
+  bool ok = true;
+
+  for(Uncommitted::iterator i = uncommitted_.begin();
+      i != uncommitted_.end();) {
+    if((*i)->commit()) {
+      (*i)->dequeued();
+      i = uncommitted_.erase(i);
+    } else {
+      ok = false;
+      ++i;
     }
   }
 
-  return eInvalid;
+  if(uncommitted_.empty()) {
+    commit_timer_.stop();
+  } else if(!commit_timer_.is_active()) {
+    commit_timer_.start(config_.write_behind());
+  }
+
+  return ok;
 }
 
-DataStatus Server::read_message(std::string key, Message& msg) {
-  std::string val;
-  leveldb::Status s = db_->Get(leveldb::ReadOptions(), key, &val);
+// Commit just the stores written to since track_writes(), leaving the
+// rest to the window.
+bool Server::commit_written() {
+  bool ok = true;
+
+  for(std::set<WriteBehindStore*>::iterator i = written_.begin();
+      i != written_.end();
+      ++i) {
+    if((*i)->commit()) {
+      (*i)->dequeued();
+      uncommitted_.remove(*i);
+    } else {
+      ok = false;
+    }
+  }
+
+  written_.clear();
+
+  if(uncommitted_.empty()) commit_timer_.stop();
+
+  return ok;
+}
+
+void Server::on_commit(ev::timer& w, int revents) {
+  commit_writes();
+  forget_delivered();
+}
+
+void Server::schedule_readahead(Queue* q) {
+  readahead_.push_back(q);
+  readahead_w_.start();
+}
+
+void Server::cancel_readahead(Queue* q) {
+  readahead_.remove(q);
+  if(readahead_.empty()) readahead_w_.stop();
+}
+
+// One queue per idle callback, so a client that shows up isn't kept
+// waiting behind all of them.
+void Server::on_readahead(ev::idle& w, int revents) {
+  if(readahead_.empty()) {
+    readahead_w_.stop();
+    return;
+  }
 
-  if(s.IsNotFound()) return eMissing;
+  Queue* q = readahead_.front();
+  readahead_.pop_front();
 
-  if(s.ok()) {
-    if(msg.wire().ParseFromString(val)) {
-      return eValid;
+  q->readahead_dequeued();
+  q->fill_readahead();
+
+  if(readahead_.empty()) readahead_w_.stop();
+}
+
+void Server::schedule_flush(Connection* con, Queue* q) {
+  if(!flush_set_.insert(std::make_pair(con, q)).second) return;
+
+  flushes_.push_back(PendingFlush(con, q));
+
+  // Run on the next loop iteration, after whatever I/O is ready.
+  if(!flush_timer_.is_active()) flush_timer_.start(0, 0);
+}
+
+void Server::forget_flushes(Connection* con) {
+  for(Flushes::iterator i = flushes_.begin(); i != flushes_.end();) {
+    if(i->con == con) {
+      flush_set_.erase(std::make_pair(i->con, i->queue));
+      i = flushes_.erase(i);
+    } else {
+      ++i;
     }
   }
+}
 
-  return eInvalid;
+void Server::forget_flushes(Queue* q) {
+  for(Flushes::iterator i = flushes_.begin(); i != flushes_.end();) {
+    if(i->queue == q) {
+      flush_set_.erase(std::make_pair(i->con, i->queue));
+      i = flushes_.erase(i);
+    } else {
+      ++i;
+    }
+  }
+}
+
+// One slice each for the backlogs waiting, ones that still have more
+// schedule themselves again. If there are so many that this iteration
+// runs long, the rest go first next time.
+void Server::on_flush(ev::timer& w, int revents) {
+  Flushes todo;
+  todo.swap(flushes_);
+
+  double start = ev_time();
+
+  while(!todo.empty()) {
+    PendingFlush pf = todo.front();
+    todo.pop_front();
+    flush_set_.erase(std::make_pair(pf.con, pf.queue));
+
+    if(pf.con->active_p()) pf.queue->flush(pf.con);
+
+    if(ev_time() - start >= FLUSH_ITERATION_SECONDS) break;
+  }
+
+  if(!todo.empty()) {
+    flushes_.splice(flushes_.begin(), todo);
+    if(!flush_timer_.is_active()) flush_timer_.start(0, 0);
+  }
 }
 
-bool Server::update_queue(std::string name, wire::Queue& qi,
-                          std::string key, const Message& msg)
+std::string Server::expiry_key(double at, uint64_t idx,
+                              const std::string& queue)
 {
-  leveldb::WriteBatch batch;
-  batch.Put(key, msg.serialize());
-  batch.Put(dname(name), qi.SerializeAsString());
+  char buf[33];
+  snprintf(buf, sizeof(buf), "%016llx%016llx",
+           (unsigned long long)(at * 1000000),
+           (unsigned long long)idx);
+
+  return std::string(HARQ_EXPIRY) + buf + queue;
+}
+
+// Our master expires messages and replicates the erase, so a replica
+// leaves them alone.
+//
+// A durable message also goes in the expiry index. Its key is left
+// there when the message is acked, and deleted when it comes due,
+// rather than costing a write on every ack.
+void Server::expire_later(Queue* q, double at, bool durable, uint64_t idx) {
+  if(replication_->following_p()) return;
+
+  std::string key;
+
+  if(durable) {
+    key = expiry_key(at, idx, q->name());
+
+    if(!storage_->put(key, "")) {
+      std::cerr << "Unable to write expiry for " << q->name()
+                << ", it will be lost on restart\n";
+      key.clear();
+    }
+  }
+
+  if(expiries_.empty()) expiries_.skip_to(now());
+  expiries_.add(at, Expiry(q->serial(), durable, idx, key));
+
+  if(!expire_timer_.is_active()) {
+    expire_timer_.start(TIMER_RESOLUTION, TIMER_RESOLUTION);
+  }
+}
+
+// Gathers up what's due, so each durable queue erases its expired
+// messages in one write.
+struct DueExpiries {
+  std::set<uint64_t> heads;
+  std::map<uint64_t, std::vector<Expiry> > durable;
+
+  DueExpiries()
+    : heads()
+    , durable()
+  {}
+
+  void operator()(const Expiry& e) {
+    if(e.durable) {
+      durable[e.serial].push_back(e);
+    } else {
+      heads.insert(e.serial);
+    }
+  }
+};
+
+// The serial q's timers are made with.
+uint64_t Server::track_queue(Queue* q) {
+  uint64_t serial = next_id();
+  queue_serials_[serial] = q;
+  return serial;
+}
+
+// Like ack timeouts, the timers are left in the wheel and ignored when
+// they fire.
+void Server::forget_queue(uint64_t serial) {
+  queue_serials_.erase(serial);
+}
+
+// Indexed keys are deleted in one write at the end, except for
+// messages left in flight, which still need theirs if we restart
+// before they're acked.
+void Server::on_expire(ev::timer& w, int revents) {
+  DueExpiries due;
+  expiries_.advance(now(), due);
+
+  // Loaded from the index at startup, before we started following.
+  if(replication_->following_p()) {
+    if(expiries_.empty()) expire_timer_.stop();
+    return;
+  }
+
+  for(std::set<uint64_t>::iterator i = due.heads.begin();
+      i != due.heads.end();
+      ++i) {
+    QueueSerials::iterator owner = queue_serials_.find(*i);
+    if(owner == queue_serials_.end()) continue;
+
+    owner->second->expire_head();
+  }
+
+  StorageBatch done;
 
-  leveldb::Status s = db_->Write(leveldb::WriteOptions(), &batch);
+  for(std::map<uint64_t, std::vector<Expiry> >::iterator i = due.durable.begin();
+      i != due.durable.end();
+      ++i) {
+    const std::vector<Expiry>& exps = i->second;
+    QueueSerials::iterator owner = queue_serials_.find(i->first);
+
+    if(owner == queue_serials_.end()) {
+      for(size_t j = 0; j < exps.size(); j++) {
+        if(!exps[j].key.empty()) done.del(exps[j].key);
+      }
+
+      continue;
+    }
+
+    Queue* q = owner->second;
+    std::vector<uint64_t> idxs;
+    idxs.reserve(exps.size());
+
+    for(size_t j = 0; j < exps.size(); j++) {
+      idxs.push_back(exps[j].index);
+    }
+
+    q->expire_durable(idxs);
+
+    for(size_t j = 0; j < exps.size(); j++) {
+      if(exps[j].key.empty() || q->durable_inflight_p(exps[j].index)) continue;
+      done.del(exps[j].key);
+    }
+  }
+
+  if(!done.empty() && !storage_->write(done)) {
+    std::cerr << "Unable to delete expired keys from the expiry index\n";
+  }
 
-  return s.ok();
+  if(expiries_.empty()) expire_timer_.stop();
 }
 
-bool Server::update_queue(std::string name, wire::Queue& qi) {
-  leveldb::WriteBatch batch;
-  batch.Put(dname(name), qi.SerializeAsString());
+// The serial con's ack timers are made with.
+uint64_t Server::track_acks(Connection* con) {
+  uint64_t serial = next_id();
+  ack_owners_[serial] = con;
+  return serial;
+}
+
+void Server::ack_later(uint64_t serial, uint64_t id, double at) {
+  if(ack_timeouts_.empty()) ack_timeouts_.skip_to(now());
+  ack_timeouts_.add(at, AckTimeout(serial, id));
 
-  leveldb::Status s = db_->Write(leveldb::WriteOptions(), &batch);
+  if(!ack_timer_.is_active()) {
+    ack_timer_.start(TIMER_RESOLUTION, TIMER_RESOLUTION);
+  }
+}
 
-  return s.ok();
+// The timers themselves are left in the wheel and ignored when they
+// fire, rather than walking it for them.
+void Server::forget_ack_timeouts(uint64_t serial) {
+  ack_owners_.erase(serial);
 }
 
-bool Server::remove_message(std::string name, wire::Queue& qi, std::string key) {
-  leveldb::WriteBatch batch;
-  batch.Delete(key);
-  batch.Put(dname(name), qi.SerializeAsString());
+struct DueAcks {
+  std::vector<AckTimeout> due;
+
+  DueAcks()
+    : due()
+  {}
+
+  void operator()(const AckTimeout& a) {
+    due.push_back(a);
+  }
+};
+
+// Most of these will have been acked already, the connection ignores
+// those. Ones for a connection that's gone are skipped.
+void Server::on_ack_timeout(ev::timer& w, int revents) {
+  DueAcks da;
+  ack_timeouts_.advance(now(), da);
+
+  for(std::vector<AckTimeout>::iterator i = da.due.begin();
+      i != da.due.end();
+      ++i) {
+    AckOwners::iterator owner = ack_owners_.find(i->serial);
+    if(owner == ack_owners_.end()) continue;
 
-  leveldb::Status s = db_->Write(leveldb::WriteOptions(), &batch);
+    owner->second->ack_timed_out(i->id);
+  }
 
-  return s.ok();
+  if(ack_timeouts_.empty()) ack_timer_.stop();
 }
 
-bool Server::read_queues() {
+std::string Server::schedule_key(double at) {
+  char buf[33];
+  snprintf(buf, sizeof(buf), "%016llx%016llx",
+           (unsigned long long)(at * 1000000),
+           (unsigned long long)next_schedule_++);
+
+  return std::string(HARQ_SCHEDULE) + buf;
+}
+
+// Hold msg back until its not_before time. For a durable queue it's
+// written to the schedule index so it's still due after a restart,
+// and replicated so a replica that takes over has it too.
+void Server::schedule(Queue& q, Message& msg) {
+  double at = msg->not_before();
+  std::string key;
+
+  if(q.durable_p()) {
+    key = schedule_key(at);
+
+    if(storage_->put(key, msg.serialize())) {
+      replication_->scheduled(key, msg);
+    } else {
+      std::cerr << "Unable to write scheduled message for " << q.name()
+                << ", holding it in memory\n";
+      key.clear();
+    }
+  }
+
+  if(schedule_.empty()) schedule_.skip_to(now());
+
+  if(key.empty()) {
+    q.scheduled(msg);
+    schedule_.add(at, Scheduled(msg, key, q.serial()));
+  } else {
+    schedule_.add(at, Scheduled(Message(), key, 0));
+  }
+
+  if(!schedule_timer_.is_active()) {
+    schedule_timer_.start(TIMER_RESOLUTION, TIMER_RESOLUTION);
+  }
+}
+
+// Arm the timers of every durable message in the expiry index. Keys
+// for queues that no longer exist are dropped.
+bool Server::read_expiries() {
+  StorageIterator* iter = storage_->scan(HARQ_EXPIRY);
+  size_t prefix = strlen(HARQ_EXPIRY);
+  StorageBatch stale;
+  unsigned count = 0;
+
+  for(; iter->valid(); iter->next()) {
+    std::string key = iter->key();
+
+    if(key.size() <= prefix + 32) {
+      std::cerr << "Corrupt expiry key '" << key << "'\n";
+      continue;
+    }
+
+    uint64_t us = strtoull(key.substr(prefix, 16).c_str(), 0, 16);
+    uint64_t idx = strtoull(key.substr(prefix + 16, 16).c_str(), 0, 16);
+
+    Queues::iterator q = queues_.find(key.substr(prefix + 32));
+
+    if(q == queues_.end() || !q->second->durable_p()) {
+      stale.del(key);
+      continue;
+    }
+
+    if(expiries_.empty()) expiries_.skip_to(now());
+
+    Expiry e(q->second->serial(), true, idx, key);
+    expiries_.add(us / 1000000.0, e);
+    count++;
+  }
+
+  delete iter;
+
+  if(!stale.empty() && !storage_->write(stale)) {
+    std::cerr << "Unable to drop stale expiry keys\n";
+  }
+
+  if(count > 0) {
+    debugs << "Read " << count << " expiries\n";
+    expire_timer_.start(TIMER_RESOLUTION, TIMER_RESOLUTION);
+  }
+
+  return true;
+}
+
+// Only the keys are needed, the messages are read when they're due.
+bool Server::read_schedule() {
+  StorageIterator* iter = storage_->scan(HARQ_SCHEDULE);
+  size_t prefix = strlen(HARQ_SCHEDULE);
+  unsigned count = 0;
+
+  for(; iter->valid(); iter->next()) {
+    std::string key = iter->key();
+
+    if(key.size() != prefix + 32) {
+      std::cerr << "Corrupt schedule key '" << key << "'\n";
+      continue;
+    }
+
+    uint64_t us = strtoull(key.substr(prefix, 16).c_str(), 0, 16);
+    schedule_.add(us / 1000000.0, Scheduled(Message(), key, 0));
+    count++;
+  }
+
+  delete iter;
+
+  if(count > 0) {
+    debugs << "Read " << count << " scheduled messages\n";
+    schedule_timer_.start(TIMER_RESOLUTION, TIMER_RESOLUTION);
+  }
+
+  return true;
+}
+
+struct DueSchedule {
+  std::vector<Scheduled> due;
+
+  DueSchedule()
+    : due()
+  {}
+
+  void operator()(const Scheduled& s) {
+    due.push_back(s);
+  }
+};
+
+// Deliver what's due. A durable one's schedule entry is only deleted
+// once its delivery is committed, so a crash in between delivers it
+// again rather than losing it. Only the stores these were delivered
+// into are committed for that, the rest are left to the window.
+void Server::on_schedule(ev::timer& w, int revents) {
+  DueSchedule ds;
+  schedule_.advance(now(), ds);
+
+  // Read from the schedule at startup, before we started following.
+  // Our master delivers them and replicates what that does.
+  if(replication_->following_p()) {
+    if(schedule_.empty()) schedule_timer_.stop();
+    return;
+  }
+
+  // Entries held over from a commit that failed wait for the window,
+  // which commits everything.
+  bool held = !delivered_.empty();
+
+  track_writes();
+
+  for(std::vector<Scheduled>::iterator i = ds.due.begin();
+      i != ds.due.end();
+      ++i) {
+    Message msg = i->msg;
+
+    if(i->key.empty()) {
+      QueueSerials::iterator owner = queue_serials_.find(i->serial);
+      if(owner != queue_serials_.end()) owner->second->unscheduled(msg);
+    } else {
+      std::string val;
+      wire::Message wm;
+
+      if(storage_->get(i->key, val) != eValid || !wm.ParseFromString(val)) {
+        std::cerr << "Unable to read scheduled message '" << i->key << "'\n";
+        continue;
+      }
+
+      msg = Message(wm);
+      delivered_.push_back(i->key);
+    }
+
+    msg->clear_not_before();
+
+    if(!deliver(msg)) {
+      debugs << "Dropping scheduled message for missing queue "
+             << msg->destination() << "\n";
+    }
+  }
+
+  if(!held && !delivered_.empty() && commit_written()) drop_delivered();
+
+  if(schedule_.empty()) schedule_timer_.stop();
+}
+
+// Delete the schedule entries of delivered messages. With write-behind
+// the deliveries are only in memory until committed, so that's done
+// first; if it fails the entries stay for on_commit to try again.
+bool Server::forget_delivered() {
+  if(delivered_.empty()) return true;
+  if(!commit_writes()) return false;
+
+  return drop_delivered();
+}
+
+// Delete the schedule entries in delivered_, whose deliveries are
+// already on disk, and tell replicas.
+bool Server::drop_delivered() {
+  StorageBatch done;
+
+  for(std::vector<std::string>::iterator i = delivered_.begin();
+      i != delivered_.end();
+      ++i) {
+    done.del(*i);
+  }
+
+  if(!storage_->write(done)) {
+    std::cerr << "Unable to remove delivered messages from the schedule\n";
+    return false;
+  }
+
+  for(std::vector<std::string>::iterator i = delivered_.begin();
+      i != delivered_.end();
+      ++i) {
+    replication_->unscheduled(*i);
+  }
+
+  delivered_.clear();
+  return true;
+}
+
+// Changes to the schedule from our master. They're only kept on disk,
+// for if we're restarted as a master.
+void Server::apply_schedule(const std::string& key, const Message& msg) {
+  if(!storage_->put(key, msg.serialize())) {
+    std::cerr << "Unable to write replicated scheduled message\n";
+  }
+}
+
+void Server::apply_unschedule(const std::string& key) {
+  if(!storage_->del(key)) {
+    std::cerr << "Unable to remove replicated scheduled message\n";
+  }
+}
+
+void Server::apply_reset_schedule() {
+  StorageIterator* iter = storage_->scan(HARQ_SCHEDULE);
+  StorageBatch batch;
+
+  for(; iter->valid(); iter->next()) {
+    batch.del(iter->key());
+  }
+
+  delete iter;
+
+  if(!batch.empty() && !storage_->write(batch)) {
+    std::cerr << "Unable to reset the schedule\n";
+  }
+}
+
+// The keys of every durable scheduled message, for a replica's
+// bootstrap.
+void Server::schedule_keys(std::deque<std::string>& out) {
+  StorageIterator* iter = storage_->scan(HARQ_SCHEDULE);
+
+  for(; iter->valid(); iter->next()) {
+    out.push_back(iter->key());
+  }
+
+  delete iter;
+}
+
+// Compaction blocks the loop, so each tick only compacts the first
+// queue after the last one that needs it.
+void Server::on_compact(ev::timer& w, int revents) {
+  Queues::iterator start = queues_.upper_bound(compact_cursor_);
+
+  for(Queues::iterator i = start; i != queues_.end(); ++i) {
+    if(i->second->compact_durable()) {
+      compact_cursor_ = i->first;
+      return;
+    }
+  }
+
+  for(Queues::iterator i = queues_.begin(); i != start; ++i) {
+    if(i->second->compact_durable()) {
+      compact_cursor_ = i->first;
+      return;
+    }
+  }
+}
+
+// Spilled transient messages don't survive a restart, so anything
+// left over from the last run is garbage.
+void Server::clear_spill_dir() {
+  DIR* dir = opendir(spill_dir_.c_str());
+  if(!dir) return;
+
+  struct dirent* ent;
+
+  while((ent = readdir(dir)) != 0) {
+    std::string name = ent->d_name;
+    if(name == "." || name == "..") continue;
+
+    std::string path = spill_dir_ + "/" + name;
+    if(unlink(path.c_str()) != 0) {
+      std::cerr << "Unable to remove stale spill file " << path << "\n";
+    }
+  }
+
+  closedir(dir);
+}
+
+DurableStore* Server::open_store(std::string name) {
+  if(warmer_) {
+    DurableStore* store = warmer_->take(name);
+    if(store) return store;
+  }
+
+  return make_store(name);
+}
+
+DurableStore* Server::make_store(std::string name) {
+  DurableStore* store = make_backend_store(name);
+
+  if(config_.write_behind() > 0) {
+    store = new WriteBehindStore(ref(this), name, store);
+  }
+
+  return store;
+}
+
+DurableStore* Server::make_backend_store(std::string name) {
+  if(config_.durable_backend() != "segments") {
+    return new LevelStore(ref(this), name);
+  }
+
+  if(mkdir(segment_dir_.c_str(), 0700) != 0 && errno != EEXIST) {
+    std::cerr << "Unable to create segment directory " << segment_dir_ << "\n";
+  }
+
+  // Queue names can contain anything, so the directory is named by
+  // the hex of the name.
+  std::stringstream ss;
+  ss << segment_dir_ << "/" << std::hex << std::setfill('0');
+
+  for(size_t i = 0; i < name.size(); i++) {
+    ss << std::setw(2) << (unsigned)(unsigned char)name[i];
+  }
+
+  return new SegmentStore(ss.str());
+}
+
+// Open the durable queues' stores in the background, now that we're
+// accepting connections.
+void Server::start_warmup() {
+  // LevelStore reads through the storage engine from the warm-up
+  // thread.
+  if(config_.durable_backend() != "segments" &&
+      !storage_->concurrent_reads_p()) return;
+
+  std::deque<std::string> names;
+
+  for(Queues::iterator i = queues_.begin(); i != queues_.end(); ++i) {
+    if(i->second->durable_p()) names.push_back(i->first);
+  }
+
+  if(names.empty()) return;
+
+  debugs << "Warming up " << names.size() << " durable queues\n";
+
+  warmer_ = new Warmer(ref(this));
+  warmer_->start(names);
+}
+
+std::string Server::spill_path() {
+  if(next_spill_ == 0) {
+    if(mkdir(spill_dir_.c_str(), 0700) != 0 && errno != EEXIST) {
+      std::cerr << "Unable to create spill directory " << spill_dir_ << "\n";
+    }
+  }
+
+  std::stringstream ss;
+  ss << spill_dir_ << "/" << ++next_spill_ << ".spill";
+
+  return ss.str();
+}
+
+bool Server::memory_pressure_p(std::string dest, bool resuming) {
+  size_t limit = config_.memory_limit();
+
+  if(limit == 0 && config_.queue_memory_limit() == 0) return false;
+
+  if(limit > 0) {
+    if(resuming) {
+      if(memory_bytes_ > limit / 4 * 3) return true;
+    } else if(memory_bytes_ >= limit) {
+      return true;
+    }
+  }
+
+  if(optref<Queue> q = queue(dest)) {
+    return q->memory_pressure_p(resuming);
+  }
+
+  return false;
+}
+
+void Server::pause_publisher(Connection* con) {
+  debugs << "Pausing publisher, memory limit reached\n";
+  paused_.push_back(con);
+}
+
+// Called once per loop iteration while anyone is paused. Each
+// publisher is held on the queue it was publishing to, so one full
+// queue doesn't hold up publishers to others.
+void Server::resume_publishers() {
+  for(Connections::iterator i = paused_.begin();
+      i != paused_.end();) {
+    Connection* con = *i;
+
+    if(memory_pressure_p(con->paused_on(), true)) {
+      ++i;
+    } else {
+      debugs << "Resuming publisher\n";
+      i = paused_.erase(i);
+      con->resume_reading();
+    }
+  }
+}
+
+
+DataStatus Server::read_message(std::string key, Message& msg) {
+  std::string val;
+  DataStatus s = storage_->get(key, val);
+
+  if(s != eValid) return s;
+  if(msg.wire().ParseFromString(val)) return eValid;
+
+  return eInvalid;
+}
+
+// Older versions kept every declaration in one !harq.config blob.
+// Move them to their own keys and drop the blob, all in one write.
+bool Server::migrate_config() {
   std::string val;
-  leveldb::Status s = db_->Get(leveldb::ReadOptions(), HARQ_CONFIG, &val);
-  if(s.IsNotFound()) return true;
-  if(!s.ok()) {
+  DataStatus s = storage_->get(HARQ_CONFIG, val);
+  if(s == eMissing) return true;
+  if(s != eValid) {
     std::cerr << "Corrupt harq.config detected!\n";
     return false;
   }
@@ -172,8 +980,41 @@ bool Server::read_queues() {
     return false;
   }
 
+  StorageBatch batch;
+
   for(int i = 0; i < cfg.queues_size(); i++) {
     const wire::QueueDeclaration& decl = cfg.queues(i);
+    batch.put(cname(decl.name()), decl.SerializeAsString());
+  }
+
+  batch.del(HARQ_CONFIG);
+
+  if(!storage_->write(batch)) {
+    std::cerr << "Unable to migrate harq.config!\n";
+    return false;
+  }
+
+  std::cerr << "Migrated " << cfg.queues_size()
+            << " queue declarations out of harq.config\n";
+
+  return true;
+}
+
+bool Server::read_queues() {
+  if(!migrate_config()) return false;
+
+  StorageIterator* iter = storage_->scan(HARQ_CATALOG);
+  bool ok = true;
+
+  for(; iter->valid(); iter->next()) {
+    wire::QueueDeclaration decl;
+
+    if(!decl.ParseFromString(iter->value())) {
+      std::cerr << "Corrupt queue declaration '" << iter->key() << "'\n";
+      ok = false;
+      break;
+    }
+
     Queue::Kind k;
 
     // Don't couple the enum values to the disk values, that's why
@@ -190,36 +1031,39 @@ bool Server::read_queues() {
       break;
     default:
       std::cerr << "Corrupt queue declaration (unknown type " << decl.type() << ")\n";
-      return false;
+      ok = false;
+      break;
     }
 
-    if(!make_queue(decl.name(), k)) {
-      std::cerr << "Unable to make queue '" << decl.name() << "'\n";
-      return false;
-    } else {
+    if(!ok) break;
+
+    catalog_[decl.name()] = decl.type();
+
+    // Nothing is read from disk for the queue here, that happens the
+    // first time it's used or when the warm-up thread gets to it.
+    if(queues_.find(decl.name()) == queues_.end()) {
+      Queue* q = new Queue(ref(this), decl.name(), k);
+      q->set_sync_replicas(decl.sync_replicas());
+      q->set_ttl(decl.ttl());
+      q->set_ack_timeout(decl.ack_timeout());
+      q->set_weight(decl.weight());
+      q->set_durable_count(decl.durable_size());
+      q->set_expiries_indexed(decl.expiries_indexed());
+
+      queues_[decl.name()] = q;
       debugs << "Added queue from config: " << decl.name() << "\n";
     }
   }
 
-  return true;
-}
+  delete iter;
 
-bool Server::add_declaration(std::string name, Queue::Kind k) {
-  std::string val;
-  leveldb::Status s = db_->Get(leveldb::ReadOptions(), HARQ_CONFIG, &val);
-
-  wire::QueueConfiguration cfg;
+  if(ok) ok = read_schedule();
+  if(ok) ok = read_expiries();
 
-  if(s.ok()) {
-    if(!cfg.ParseFromString(val)) {
-      std::cerr << "Corrupt harq.config detected!\n";
-      return false;
-    }
-  } else if(!s.IsNotFound()) {
-    std::cerr << "Corrupt harq.config detected!\n";
-    return false;
-  }
+  return ok;
+}
 
+bool Server::add_declaration(std::string name, Queue::Kind k) {
   wire::QueueDeclaration_Type wk;
 
   switch(k) {
@@ -237,33 +1081,111 @@ bool Server::add_declaration(std::string name, Queue::Kind k) {
     return false;
   }
 
-  bool wrote = false;
+  // Clients re-declare their queues all the time, only write when
+  // something changed.
+  Catalog::iterator i = catalog_.find(name);
+  if(i != catalog_.end() && i->second == wk) return true;
 
-  for(int i = 0; i < cfg.queues_size(); i++) {
-    const wire::QueueDeclaration& decl = cfg.queues(i);
+  wire::QueueDeclaration decl;
+  decl.set_name(name);
+  decl.set_type(wk);
 
-    if(decl.name() == name) {
-      cfg.mutable_queues(i)->set_type(wk);
-      wrote = true;
-      break;
-    }
+  Queues::iterator q = queues_.find(name);
+  if(q != queues_.end()) describe(q->second, decl);
+
+  if(!storage_->put(cname(name), decl.SerializeAsString())) {
+    std::cerr << "Unable to write declaration for " << name << "!\n";
+    return false;
   }
 
-  if(!wrote) {
-    wire::QueueDeclaration* decl = cfg.add_queues();
-    decl->set_name(name);
-    decl->set_type(wk);
+  catalog_[name] = wk;
+
+  return true;
+}
+
+// The options of q that go in its declaration.
+void Server::describe(Queue* q, wire::QueueDeclaration& decl) {
+  if(q->sync_replicas() > 0) decl.set_sync_replicas(q->sync_replicas());
+  if(q->ttl() > 0) decl.set_ttl(q->ttl());
+  if(q->ack_timeout() > 0) decl.set_ack_timeout(q->ack_timeout());
+  if(q->weight() > 1) decl.set_weight(q->weight());
+
+  if(q->kind() == Queue::eDurable) {
+    decl.set_durable_size(q->durable_messages());
+    if(q->expiries_indexed_p()) decl.set_expiries_indexed(true);
+  }
+}
+
+// Keep the size of each durable store that was opened this run in its
+// declaration, for stat to report next time until it's opened again.
+bool Server::save_durable_counts() {
+  StorageBatch batch;
+
+  for(Queues::iterator i = queues_.begin(); i != queues_.end(); ++i) {
+    Queue* q = i->second;
+    if(q->kind() != Queue::eDurable || !q->store_open_p()) continue;
+
+    wire::QueueDeclaration decl;
+    decl.set_name(i->first);
+    decl.set_type(wire::QueueDeclaration::eDurable);
+    describe(q, decl);
+
+    batch.put(cname(i->first), decl.SerializeAsString());
   }
 
-  s = db_->Put(leveldb::WriteOptions(), HARQ_CONFIG, cfg.SerializeAsString());
-  if(!s.ok()) {
-    std::cerr << "Unable to write harq.config!\n";
+  if(batch.empty()) return true;
+
+  if(!storage_->write(batch)) {
+    std::cerr << "Unable to save durable queue sizes\n";
     return false;
   }
 
   return true;
 }
 
+// Write q's declaration again, for something in it that changed.
+bool Server::redeclare(Queue* q) {
+  catalog_.erase(q->name());
+  return add_declaration(q->name(), q->kind());
+}
+
+// Change how many replicas have to have a publish to name before it's
+// confirmed, and keep that with the declaration.
+bool Server::set_sync_replicas(std::string name, unsigned count) {
+  Queues::iterator i = queues_.find(name);
+  if(i == queues_.end()) return false;
+
+  Queue* q = i->second;
+  if(q->kind() == Queue::eEphemeral) return false;
+
+  if(q->sync_replicas() == count) return true;
+
+  q->set_sync_replicas(count);
+
+  // Force the declaration to be written again with the new count.
+  catalog_.erase(name);
+  return add_declaration(name, q->kind());
+}
+
+// Change the options in opts that are set. Ephemeral queues only keep
+// them in memory.
+bool Server::set_queue_options(const wire::QueueOptions& opts) {
+  Queues::iterator i = queues_.find(opts.queue());
+  if(i == queues_.end()) return false;
+
+  Queue* q = i->second;
+  if(q->kind() == Queue::eBroadcast) return false;
+
+  if(opts.has_ttl()) q->set_ttl(opts.ttl());
+  if(opts.has_ack_timeout()) q->set_ack_timeout(opts.ack_timeout());
+  if(opts.has_weight()) q->set_weight(opts.weight());
+
+  if(q->kind() == Queue::eEphemeral) return true;
+
+  catalog_.erase(opts.queue());
+  return add_declaration(opts.queue(), q->kind());
+}
+
 optref<Queue> Server::queue(std::string name) {
   Queues::iterator i = queues_.find(name);
   if(i != queues_.end()) return ref(i->second);
@@ -284,7 +1206,10 @@ bool Server::make_queue(std::string name, Queue::Kind k) {
     ok = i->second->change_kind(k);
   }
 
-  if(ok && k != Queue::eEphemeral) add_declaration(name, k);
+  if(ok && k != Queue::eEphemeral) {
+    add_declaration(name, k);
+    replication_->declared(name, k);
+  }
 
   return ok;
 }
@@ -299,58 +1224,23 @@ void Server::destroy_queue(Queue* q) {
 }
 
 void Server::start() {    
-  if((fd_ = socket(AF_INET, SOCK_STREAM, 0)) == -1) {
-    perror("socket()");
-    exit(1);
-  }
-
-  int flags = 1;
-  setsockopt(fd_, SOL_SOCKET, SO_REUSEADDR, (void *)&flags, sizeof(flags));
-  setsockopt(fd_, SOL_SOCKET, SO_KEEPALIVE, (void *)&flags, sizeof(flags));
-
-  struct linger ling = {0, 0};
-  setsockopt(fd_, SOL_SOCKET, SO_LINGER, (void *)&ling, sizeof(ling));
-
-  /* XXX: Sending single byte chunks in a response body? Perhaps there is a
-   * need to enable the Nagel algorithm dynamically. For now disabling.
-   */
-  setsockopt(fd_, IPPROTO_TCP, TCP_NODELAY, (void *)&flags, sizeof(flags));
-
-  struct sockaddr_in addr;
-
-  /* the memset call clears nonstandard fields in some impementations that
-   * otherwise mess things up.
-   */
-  memset(&addr, 0, sizeof(addr));
+  fd_ = make_listener(hostaddr_, port_);
+  if(fd_ < 0) exit(1);
 
-  addr.sin_family = AF_INET;
-  addr.sin_port = htons(port_);
-
-  if(!hostaddr_.empty()) {
-    addr.sin_addr.s_addr = inet_addr(hostaddr_.c_str());
-    if(addr.sin_addr.s_addr == INADDR_NONE){
-      printf("Bad address(%s) to listen\n",hostaddr_.c_str());
-      exit(1);
-    }
-  } else {
-    addr.sin_addr.s_addr = htonl(INADDR_ANY);
-  }
+  connection_watcher_.set<Server, &Server::on_connection>(this);
+  connection_watcher_.start(fd_, EV_READ);
 
-  if(bind(fd_, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
-    perror("bind()");
-    if(fd_ > 0) close(fd_);
-    exit(1);
+  if(config_.compact_interval() > 0) {
+    compact_timer_.start(config_.compact_interval(),
+                         config_.compact_interval());
   }
 
-  if(listen(fd_, MAX_CONNECTIONS) < 0) {
-    perror("listen()");
-    exit(1);
+  if(config_.metrics_port() > 0) {
+    metrics_ = new Metrics(ref(this));
+    if(!metrics_->start(hostaddr_, config_.metrics_port())) exit(1);
   }
 
-  set_nonblock(fd_);
-
-  connection_watcher_.set<Server, &Server::on_connection>(this);
-  connection_watcher_.start(fd_, EV_READ);
+  start_warmup();
 
   loop_.run(0);
 }
@@ -388,22 +1278,9 @@ void Server::on_connection(ev::io& w, int revents) {
 }
 
 void Server::reserve(std::string dest) {
-  if(replicas_.size() > 0) {
-    wire::ReplicaAction act;
-    act.set_type(wire::ReplicaAction::eReserve);
-    act.set_payload(dest);
-
-    wire::Message msg;
-    msg.set_destination("+replica");
-    msg.set_payload(act.SerializeAsString());
-
-    write_replicas(msg);
-  }
-
   std::string val;
-  leveldb::Status s = db_->Get(read_options_, dname(dest), &val);
 
-  if(s.ok()) {
+  if(storage_->get(dname(dest), val) == eValid) {
     debugs << "Already reserved " << dest << "\n";
     return;
   }
@@ -411,9 +1288,8 @@ void Server::reserve(std::string dest) {
   wire::Queue q;
   q.set_size(0);
 
-  s = db_->Put(write_options_, dname(dest), q.SerializeAsString());
   debugs << "Reserved " << dest << "\n";
-  if(!s.ok()) {
+  if(!storage_->put(dname(dest), q.SerializeAsString())) {
     std::cerr << "Unable to reserve " << dest << "\n";
   }
 }
@@ -424,11 +1300,25 @@ bool Server::deliver(Message& msg) {
   optref<Queue> q = queue(dest);
   if(!q) return false;
 
-  // Send message to taps first.
+  // Taps see it, and its ttl starts, once it's due.
+  if(msg->has_not_before() && msg->not_before() > now()) {
+    schedule(*q, msg);
+    return true;
+  }
+
+  if(msg->has_ttl() && !msg->has_expires()) {
+    msg->set_expires(now() + msg->ttl() / 1000.0);
+  }
+
+  // Send message to taps first. Taps are only watching, so one that
+  // can't keep up just misses messages rather than growing without
+  // bound.
   for(Connections::iterator i = taps_.begin();
       i != taps_.end();)
   {
-    if((*i)->write(msg.wire())) {
+    if((*i)->over_high_water_p()) {
+      ++i;
+    } else if((*i)->write(msg.wire())) {
       ++i;
     } else {
       debugs << "Tap write error (disconnect) while writing to\n";
@@ -438,8 +1328,6 @@ bool Server::deliver(Message& msg) {
 
   q->deliver(msg);
 
-  write_replicas(msg.wire());
-
   return true;
 }
 
@@ -447,6 +1335,7 @@ void Server::bond(Connection* con, const wire::BondRequest& br) {
   if(optref<Queue> q = queue(br.queue())) {
     if(optref<Queue> q2 = queue(br.destination())) {
       q->broadcast_into(q2.ptr());
+      replication_->bonded(br.queue(), br.destination());
     } else {
       con->send_error(br.destination(), "No such queue to bond into");
     }
@@ -455,19 +1344,6 @@ void Server::bond(Connection* con, const wire::BondRequest& br) {
   }
 }
 
-void Server::write_replicas(const wire::Message& msg) {
-  for(Connections::iterator i = replicas_.begin();
-      i != replicas_.end();) 
-  {
-    if((*i)->write(msg)) {
-      ++i;
-    } else {
-      std::cerr << "Replica error (disconnected) while writing to\n";
-      i = replicas_.erase(i);
-    }
-  }
-}
-
 optref<Queue> Server::subscribe(Connection* con, std::string dest) {
   optref<Queue> q = queue(dest);
   if(q.set_p()) {
@@ -485,16 +1361,11 @@ void Server::flush(Connection* con, std::string dest) {
 
 void Server::stat(Connection* con, std::string dest) {
   wire::Stat stat;
-  stat.set_name(dest);
 
   if(optref<Queue> q = queue(dest)) {
-    stat.set_exists(true);
-    stat.set_transient_size(q->queued_messages());
-
-    if(q->durable_p()) {
-      stat.set_durable_size(q->durable_messages());
-    }
+    q->fill_stat(stat);
   } else {
+    stat.set_name(dest);
     stat.set_exists(false);
   }
 
@@ -507,7 +1378,31 @@ void Server::stat(Connection* con, std::string dest) {
   }
 }
 
-void Server::connect_replica(std::string host, int c_port) {
+void Server::stat_all(Connection* con) {
+  wire::StatDump dump;
+
+  for(Queues::iterator i = queues_.begin();
+      i != queues_.end();
+      ++i) {
+    i->second->fill_stat(*dump.add_queues());
+  }
+
+  for(Connections::iterator i = connections_.begin();
+      i != connections_.end();
+      ++i) {
+    (*i)->fill_stat(*dump.add_connections());
+  }
+
+  wire::Message msg;
+  msg.set_destination("+stats");
+  msg.set_payload(dump.SerializeAsString());
+
+  if(!con->write(msg)) {
+    debugs << "Connection closed returning stat information\n";
+  }
+}
+
+Connection* Server::connect_replica(std::string host, int c_port) {
   int s, rv;
   char port[6];  /* strlen("65535"); */
   struct addrinfo hints, *servinfo, *p;
@@ -519,7 +1414,7 @@ void Server::connect_replica(std::string host, int c_port) {
 
   if ((rv = getaddrinfo(host.c_str(), port, &hints, &servinfo)) != 0) {
     printf("Error: %s\n", gai_strerror(rv));
-    return;
+    return 0;
   }
 
   for (p = servinfo; p != NULL; p = p->ai_next) {
@@ -536,7 +1431,7 @@ void Server::connect_replica(std::string host, int c_port) {
 
   if (p == NULL) {
     printf("Can't create socket: %s\n",strerror(errno));
-    return;
+    return 0;
   }
 
 end:
@@ -546,11 +1441,12 @@ end:
 
   if(con == NULL) {
     close(s);
-    return;
+    return 0;
   }
 
   connections_.push_back(con);
 
   con->start_replica();
+  return con;
 }
 
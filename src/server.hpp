@@ -1,18 +1,22 @@
 #ifndef SERVER_HPP
 #define SERVER_HPP
 
+#include <deque>
 #include <vector>
 #include <list>
 #include <string>
 #include <map>
+#include <set>
+#include <utility>
 
 #include <iostream>
 
 #include "ev++.h"
-#include <leveldb/db.h>
 #include "queue.hpp"
+#include "storage.hpp"
 #include "debugs.hpp"
 #include "safe_ref.hpp"
+#include "timer_wheel.hpp"
 
 #include "wire.pb.h"
 #include "option.hpp"
@@ -20,19 +24,100 @@
 class Connection;
 class Message;
 class Config;
+class Metrics;
+class DurableStore;
+class Warmer;
+class Replication;
+class WriteBehindStore;
 
 typedef std::list<Connection*> Connections;
 
+// Seconds per tick of the server's timer wheels.
+#define TIMER_RESOLUTION 0.1
+
+// A message in a queue that might have expired. Transient queues only
+// ever expire from the head, so they don't say which message. The
+// queue is known by its serial, since it may be gone by the time this
+// fires. A durable message's key in the expiry index, if it has one,
+// is deleted once it's been dealt with.
+struct Expiry {
+  uint64_t serial;
+  bool durable;
+  uint64_t index;
+  std::string key;
+
+  Expiry(uint64_t s, bool d, uint64_t i, const std::string& k)
+    : serial(s)
+    , durable(d)
+    , index(i)
+    , key(k)
+  {}
+};
+
+// A delivery that has to be acked by a deadline. The connection is
+// known by its serial rather than a pointer, since it may be gone by
+// the time this fires.
+struct AckTimeout {
+  uint64_t serial;
+  uint64_t id;
+
+  AckTimeout(uint64_t s, uint64_t i)
+    : serial(s)
+    , id(i)
+  {}
+};
+
+// The longest the flush scheduler runs for in one loop iteration.
+#define FLUSH_ITERATION_SECONDS 0.02
+
+// A connection with more of a queue's backlog to be flushed to it.
+struct PendingFlush {
+  Connection* con;
+  Queue* queue;
+
+  PendingFlush(Connection* c, Queue* q)
+    : con(c)
+    , queue(q)
+  {}
+};
+
+// A message held back until its not_before time. Ones for durable
+// queues stay on disk under key until they're due, msg is only used
+// when key is empty. Then it's counted against the memory of the queue
+// with serial until it's released.
+struct Scheduled {
+  Message msg;
+  std::string key;
+  uint64_t serial;
+
+  Scheduled(const Message& m, const std::string& k, uint64_t s)
+    : msg(m)
+    , key(k)
+    , serial(s)
+  {}
+};
+
+// Older versions kept every queue declaration in this one key.
+#define HARQ_CONFIG "!harq.config"
+
+// Each declaration now has its own key, this followed by the name.
+#define HARQ_CATALOG "!harq.queue:"
+
+// Scheduled durable messages, this followed by when they're due and a
+// sequence number, so they scan in the order they're due.
+#define HARQ_SCHEDULE "!harq.schedule:"
+
+// When durable messages expire, this followed by when, the index and
+// the queue name, so they scan in the order they're due. Read at
+// startup so their timers are armed without opening the stores.
+#define HARQ_EXPIRY "!harq.expiry:"
+
 namespace wire {
   class Message;
+  class ReplicaStart;
+  class QueueOptions;
 }
 
-enum DataStatus {
-  eMissing,
-  eValid,
-  eInvalid
-};
-
 class Server {
   Config& config_;
   std::string db_path_;
@@ -40,16 +125,67 @@ class Server {
   int port_;
   int fd_;
 
-  leveldb::Options options_;
-  leveldb::ReadOptions read_options_;
-  leveldb::WriteOptions write_options_;
-
-  leveldb::DB* db_;
+  StorageEngine* storage_;
   ev::dynamic_loop loop_;
   ev::io connection_watcher_;
   ev::sig sigint_watcher_;
   ev::sig sigterm_watcher_;
   ev::check cleanup_watcher_;
+  ev::timer compact_timer_;
+  ev::timer commit_timer_;
+
+  // Write-behind stores with appends waiting for commit_timer_.
+  typedef std::list<WriteBehindStore*> Uncommitted;
+  Uncommitted uncommitted_;
+
+  // Write-behind stores appended to since track_writes(), so a
+  // publisher's confirms only commit the stores its publishes touched.
+  std::set<WriteBehindStore*> written_;
+
+  // Durable writes skipped because the message was erased first.
+  uint64_t elided_writes_;
+
+  // Durable queues waiting to read ahead, done while the loop is idle.
+  ev::idle readahead_w_;
+  std::list<Queue*> readahead_;
+
+  // Backlogs being flushed a slice per loop iteration, so a big one
+  // doesn't hold up everyone else. flush_set_ has the same pairs, for
+  // finding one that's already waiting.
+  typedef std::list<PendingFlush> Flushes;
+  Flushes flushes_;
+  std::set<std::pair<Connection*, Queue*> > flush_set_;
+  ev::timer flush_timer_;
+
+  // Messages with a ttl, checked every tick while there are any.
+  TimerWheel<Expiry> expiries_;
+  ev::timer expire_timer_;
+
+  // Queues by the serial timers name them with. A destroyed queue is
+  // dropped from here, so its timers find nothing when they fire.
+  typedef std::map<uint64_t, Queue*> QueueSerials;
+  QueueSerials queue_serials_;
+
+  // Messages waiting on their not_before time.
+  TimerWheel<Scheduled> schedule_;
+  ev::timer schedule_timer_;
+  uint64_t next_schedule_;
+
+  // Schedule keys of messages that have been delivered, kept until
+  // the deliveries are committed to disk.
+  std::vector<std::string> delivered_;
+
+  // Deliveries waiting on an ack with a deadline, and the connections
+  // they were made to by serial. One that's closed is dropped from
+  // ack_owners_, so its timers find nothing when they fire.
+  TimerWheel<AckTimeout> ack_timeouts_;
+  ev::timer ack_timer_;
+
+  typedef std::map<uint64_t, Connection*> AckOwners;
+  AckOwners ack_owners_;
+
+  // Name of the last queue compacted, the next tick starts after it.
+  std::string compact_cursor_;
 
   Connections connections_;
   Connections replicas_;
@@ -57,34 +193,148 @@ class Server {
 
   Connections closing_connections_;
 
+  // Publishers whose reads are stopped until memory frees up.
+  Connections paused_;
+
+  // Payload bytes held in memory across all queues.
+  size_t memory_bytes_;
+
+  std::string spill_dir_;
+  uint64_t next_spill_;
+
+  std::string segment_dir_;
+
   uint64_t next_id_;
 
+public:
   typedef std::map<std::string, Queue*> Queues;
+
+private:
   Queues queues_;
 
+  // What's been declared on disk, so re-declaring doesn't have to
+  // write anything.
+  typedef std::map<std::string, wire::QueueDeclaration_Type> Catalog;
+  Catalog catalog_;
+
+  Metrics* metrics_;
+  Warmer* warmer_;
+  Replication* replication_;
+
 public:
 
   Config& config() {
     return config_;
   }
 
-  leveldb::DB* db() {
-    return db_;
+  StorageEngine& storage() {
+    return *storage_;
+  }
+
+  Queues& queues() {
+    return queues_;
+  }
+
+  Connections& connections() {
+    return connections_;
+  }
+
+  Connections& replicas() {
+    return replicas_;
+  }
+
+  Replication& replication() {
+    return *replication_;
+  }
+
+  Connections& taps() {
+    return taps_;
   }
 
   ev::dynamic_loop& loop() {
     return loop_;
   }
 
-  void remove_connection(Connection* con) {
-    connections_.remove(con);
-    closing_connections_.push_back(con);
+  double now() {
+    return loop_.now();
+  }
+
+  void remove_connection(Connection* con);
+
+  void add_memory(size_t bytes) {
+    memory_bytes_ += bytes;
+  }
+
+  void sub_memory(size_t bytes) {
+    memory_bytes_ -= bytes;
+  }
+
+  size_t memory_bytes() {
+    return memory_bytes_;
+  }
+
+  Connections& paused() {
+    return paused_;
+  }
+
+  // open_store is for the loop, it checks with the warm-up thread
+  // first. make_store is safe to call from any thread.
+  DurableStore* open_store(std::string name);
+  DurableStore* make_store(std::string name);
+  DurableStore* make_backend_store(std::string name);
+  void start_warmup();
+
+  void schedule_commit(WriteBehindStore* store);
+  void forget_commit(WriteBehindStore* store);
+  bool commit_writes();
+
+  void track_writes() {
+    written_.clear();
+  }
+
+  void wrote(WriteBehindStore* store) {
+    written_.insert(store);
+  }
+
+  bool commit_written();
+
+  void schedule_readahead(Queue* q);
+  void cancel_readahead(Queue* q);
+
+  void schedule_flush(Connection* con, Queue* q);
+  void forget_flushes(Connection* con);
+  void forget_flushes(Queue* q);
+
+  uint64_t track_queue(Queue* q);
+  void expire_later(Queue* q, double at, bool durable, uint64_t idx);
+  void forget_queue(uint64_t serial);
+
+  uint64_t track_acks(Connection* con);
+  void ack_later(uint64_t serial, uint64_t id, double at);
+  void forget_ack_timeouts(uint64_t serial);
+
+  size_t scheduled_messages() {
+    return schedule_.size();
+  }
+
+  void elided_write() {
+    elided_writes_++;
   }
 
-  void add_replica(Connection* con) {
-    replicas_.push_back(con);
+  uint64_t elided_writes() {
+    return elided_writes_;
   }
 
+  std::string spill_path();
+  void clear_spill_dir();
+
+  bool memory_pressure_p(std::string dest, bool resuming=false);
+  void pause_publisher(Connection* con);
+  void resume_publishers();
+
+  void add_replica(Connection* con, const wire::ReplicaStart& start);
+  bool replica_p(Connection* con);
+
   void add_tap(Connection* con) {
     taps_.push_back(con);
   }
@@ -104,10 +354,24 @@ public:
     return std::string("-") + queue;
   }
 
+  std::string cname(std::string queue) {
+    return std::string(HARQ_CATALOG) + queue;
+  }
+
+  bool migrate_config();
   bool read_queues();
+  bool read_schedule();
+  bool read_expiries();
+  bool forget_delivered();
+  bool drop_delivered();
 
   bool make_queue(std::string name, Queue::Kind k);
   bool add_declaration(std::string name, Queue::Kind k);
+  void describe(Queue* q, wire::QueueDeclaration& decl);
+  bool save_durable_counts();
+  bool redeclare(Queue* q);
+  bool set_sync_replicas(std::string name, unsigned count);
+  bool set_queue_options(const wire::QueueOptions& opts);
 
   void destroy_queue(Queue* q);
 
@@ -120,27 +384,34 @@ public:
 
   void on_signal(ev::sig& w, int revents);
   void cleanup(ev::check& w, int revents);
+  void on_compact(ev::timer& w, int revents);
+  void on_commit(ev::timer& w, int revents);
+  void on_readahead(ev::idle& w, int revents);
+  void on_flush(ev::timer& w, int revents);
+  void on_expire(ev::timer& w, int revents);
+  void on_schedule(ev::timer& w, int revents);
+  void on_ack_timeout(ev::timer& w, int revents);
 
   void reserve(std::string dest);
   bool deliver(Message& msg);
+  void schedule(Queue& q, Message& msg);
+  std::string schedule_key(double at);
+  void schedule_keys(std::deque<std::string>& out);
+
+  void apply_schedule(const std::string& key, const Message& msg);
+  void apply_unschedule(const std::string& key);
+  void apply_reset_schedule();
+  std::string expiry_key(double at, uint64_t idx, const std::string& queue);
 
   optref<Queue> subscribe(Connection* con, std::string dest);
   void flush(Connection* con, std::string dest);
 
   void stat(Connection* con, std::string name);
-  void connect_replica(std::string host, int port);
+  void stat_all(Connection* con);
+  Connection* connect_replica(std::string host, int port);
 
-  DataStatus read_queue(std::string name, wire::Queue& qi);
   DataStatus read_message(std::string key, Message& msg);
 
-  bool update_queue(std::string name, wire::Queue& qi,
-                          std::string key, const Message& msg);
-  bool update_queue(std::string name, wire::Queue& qi);
-
-  bool remove_message(std::string name, wire::Queue& qi, std::string key);
-
-  void write_replicas(const wire::Message& msg);
-
   void bond(Connection* con, const wire::BondRequest& br);
 };
 
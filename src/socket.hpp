@@ -30,6 +30,10 @@ public:
   WriteStatus flush() {
     return writes_.flush(fd);
   }
+
+  size_t write_backlog() {
+    return writes_.bytes();
+  }
 };
 
 #endif
@@ -0,0 +1,341 @@
+#include "spill.hpp"
+#include "debugs.hpp"
+
+#include "wire.pb.h"
+
+#include <iostream>
+#include <sstream>
+
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+// Each record is a 4 byte length, the 8 byte stamp and then the
+// serialized wire::Message.
+#define RECORD_HEADER 12
+
+#define CHUNK_SIZE (64 * 1024)
+
+// Past this, appends start a new segment file.
+#define SPILL_SEGMENT_SIZE (4 * 1024 * 1024)
+
+SpillFile::SpillFile(std::string path)
+  : path_(path)
+  , next_segment_(0)
+  , segments_()
+  , read_pos_(0)
+  , count_(0)
+  , wbuf_()
+  , wbuf_count_(0)
+  , rbuf_()
+  , rbuf_pos_(0)
+{}
+
+SpillFile::~SpillFile() {
+  for(std::deque<Segment>::iterator i = segments_.begin();
+      i != segments_.end();
+      ++i) {
+    close(i->fd);
+    unlink(i->path.c_str());
+  }
+}
+
+bool SpillFile::open() {
+  return add_segment();
+}
+
+bool SpillFile::add_segment() {
+  std::stringstream ss;
+  ss << path_ << "." << next_segment_++;
+
+  Segment seg;
+  seg.path = ss.str();
+  seg.fd = ::open(seg.path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+  seg.size = 0;
+  seg.count = 0;
+
+  if(seg.fd < 0) {
+    std::cerr << "Unable to open spill file " << seg.path
+              << " (" << strerror(errno) << ")\n";
+    return false;
+  }
+
+  segments_.push_back(seg);
+  return true;
+}
+
+// Everything in the front segment has been read back, or it's being
+// given up on, so it goes.
+void SpillFile::drop_front() {
+  Segment& seg = segments_.front();
+
+  close(seg.fd);
+  unlink(seg.path.c_str());
+
+  debugs << "Spill segment " << seg.path << " drained\n";
+
+  segments_.pop_front();
+
+  read_pos_ = 0;
+  rbuf_.clear();
+  rbuf_pos_ = 0;
+}
+
+bool SpillFile::append(const Message& msg) {
+  std::string data;
+
+  if(!msg->SerializeToString(&data)) {
+    std::cerr << "Error serializing message to spill\n";
+    return false;
+  }
+
+  uint32_t len = data.size();
+  double stamp = msg.stamp();
+
+  char header[RECORD_HEADER];
+  memcpy(header, &len, 4);
+  memcpy(header + 4, &stamp, 8);
+
+  wbuf_.append(header, RECORD_HEADER);
+  wbuf_.append(data);
+
+  wbuf_count_++;
+  count_++;
+
+  if(wbuf_.size() >= CHUNK_SIZE) return flush_writes();
+
+  return true;
+}
+
+// Write out wbuf_ to the last segment, starting a new one first if
+// it's full. Either all of it is written or none of it is, so records
+// never straddle segments or end up half written.
+bool SpillFile::flush_writes() {
+  if(wbuf_.empty()) return true;
+
+  if(segments_.empty() || segments_.back().size >= SPILL_SEGMENT_SIZE) {
+    if(!add_segment() && segments_.empty()) return false;
+  }
+
+  Segment& seg = segments_.back();
+  size_t done = 0;
+
+  while(done < wbuf_.size()) {
+    ssize_t r = pwrite(seg.fd, wbuf_.data() + done, wbuf_.size() - done,
+                       seg.size + done);
+
+    if(r < 0) {
+      if(errno == EINTR) continue;
+
+      std::cerr << "Error writing spill file " << seg.path
+                << " (" << strerror(errno) << ")\n";
+
+      if(ftruncate(seg.fd, seg.size) != 0) {
+        std::cerr << "Unable to truncate spill file " << seg.path << "\n";
+      }
+
+      return false;
+    }
+
+    done += r;
+  }
+
+  seg.size += done;
+  seg.count += wbuf_count_;
+
+  wbuf_.clear();
+  wbuf_count_ = 0;
+
+  return true;
+}
+
+// Make sure there are at least need bytes unread in rbuf_, out of the
+// front segment.
+bool SpillFile::fill(size_t need) {
+  Segment& seg = segments_.front();
+
+  while(rbuf_.size() - rbuf_pos_ < need) {
+    // Drop what we've already consumed.
+    rbuf_.erase(0, rbuf_pos_);
+    rbuf_pos_ = 0;
+
+    // A record that runs past what was written is corrupt.
+    if(read_pos_ >= seg.size) return false;
+
+    size_t want = need > CHUNK_SIZE ? need : CHUNK_SIZE;
+    if((off_t)want > seg.size - read_pos_) want = seg.size - read_pos_;
+
+    size_t start = rbuf_.size();
+
+    rbuf_.resize(start + want);
+
+    ssize_t r = pread(seg.fd, &rbuf_[start], want, read_pos_);
+
+    if(r < 0) {
+      rbuf_.resize(start);
+      if(errno == EINTR) continue;
+
+      std::cerr << "Error reading spill file " << seg.path
+                << " (" << strerror(errno) << ")\n";
+      return false;
+    }
+
+    rbuf_.resize(start + r);
+    read_pos_ += r;
+
+    if(r == 0) return false;
+  }
+
+  return true;
+}
+
+bool SpillFile::read_record(Message& msg) {
+  if(!fill(RECORD_HEADER)) return false;
+
+  uint32_t len;
+  double stamp;
+
+  memcpy(&len, rbuf_.data() + rbuf_pos_, 4);
+  memcpy(&stamp, rbuf_.data() + rbuf_pos_ + 4, 8);
+
+  if((off_t)len > segments_.front().size) return false;
+  if(!fill(RECORD_HEADER + len)) return false;
+
+  if(!msg.wire().ParseFromArray(rbuf_.data() + rbuf_pos_ + RECORD_HEADER,
+                                len)) {
+    std::cerr << "Corrupt message in spill file "
+              << segments_.front().path << "\n";
+    return false;
+  }
+
+  msg.set_stamp(stamp);
+
+  rbuf_pos_ += RECORD_HEADER + len;
+  return true;
+}
+
+// Read the next message, skipping over any segment that can't be read
+// (and the messages in it). Returns false once there's nothing left
+// that can be read.
+bool SpillFile::read(Message& msg) {
+  while(count_ > 0) {
+    // The rest might only be in wbuf_ so far.
+    if(segments_.empty() ||
+       (segments_.size() == 1 && segments_.front().count == 0)) {
+      if(!flush_writes()) return false;
+    }
+
+    while(segments_.size() > 1 && segments_.front().count == 0) {
+      drop_front();
+    }
+
+    if(segments_.empty() || segments_.front().count == 0) return false;
+
+    if(read_record(msg)) {
+      segments_.front().count--;
+      count_--;
+
+      if(count_ == 0) reset();
+
+      return true;
+    }
+
+    Segment& seg = segments_.front();
+
+    std::cerr << "Unable to read spill file " << seg.path
+              << ", dropping " << seg.count << " messages\n";
+
+    count_ -= seg.count;
+    drop_front();
+  }
+
+  reset();
+  return false;
+}
+
+bool SpillFile::peek_all(std::vector<Message>& out) {
+  if(!flush_writes()) return false;
+
+  // What's already been pulled into rbuf_, then the rest of the front
+  // segment after it and every segment after that.
+  std::string data(rbuf_, rbuf_pos_);
+
+  for(size_t s = 0; s < segments_.size(); s++) {
+    const Segment& seg = segments_[s];
+    off_t pos = s == 0 ? read_pos_ : 0;
+
+    while(pos < seg.size) {
+      size_t start = data.size();
+      data.resize(start + (seg.size - pos));
+
+      ssize_t r = pread(seg.fd, &data[start], seg.size - pos, pos);
+
+      if(r < 0) {
+        data.resize(start);
+        if(errno == EINTR) continue;
+
+        std::cerr << "Error reading spill file " << seg.path
+                  << " (" << strerror(errno) << ")\n";
+        return false;
+      }
+
+      if(r == 0) break;
+
+      data.resize(start + r);
+      pos += r;
+    }
+  }
+
+  size_t at = 0;
+
+  for(size_t i = 0; i < count_; i++) {
+    uint32_t len;
+    double stamp;
+
+    if(at + RECORD_HEADER > data.size()) return false;
+
+    memcpy(&len, data.data() + at, 4);
+    memcpy(&stamp, data.data() + at + 4, 8);
+
+    if(at + RECORD_HEADER + len > data.size()) return false;
+
+    Message msg;
+
+    if(!msg.wire().ParseFromArray(data.data() + at + RECORD_HEADER, len)) {
+      std::cerr << "Corrupt message in spill file " << path_ << "\n";
+      return false;
+    }
+
+    msg.set_stamp(stamp);
+    out.push_back(msg);
+
+    at += RECORD_HEADER + len;
+  }
+
+  return true;
+}
+
+// Everything written has been read back, so start over at the front
+// of the last segment rather than leaving the old ones around.
+void SpillFile::reset() {
+  while(segments_.size() > 1) drop_front();
+
+  if(!segments_.empty()) {
+    Segment& seg = segments_.front();
+
+    if(ftruncate(seg.fd, 0) != 0) {
+      std::cerr << "Unable to truncate spill file " << seg.path << "\n";
+    }
+
+    seg.size = 0;
+    seg.count = 0;
+  }
+
+  read_pos_ = 0;
+
+  rbuf_.clear();
+  rbuf_pos_ = 0;
+
+  debugs << "Spill file " << path_ << " drained\n";
+}
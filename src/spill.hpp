@@ -0,0 +1,97 @@
+#ifndef SPILL_HPP
+#define SPILL_HPP
+
+#include <deque>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+#include <sys/types.h>
+
+#include "message.hpp"
+
+// The tail of a transient queue that didn't fit in the queue's memory
+// budget, kept on disk. Messages are appended at the end and read back
+// in order from the front, so both sides are sequential IO.
+//
+// The messages are spread over segment files of about
+// SPILL_SEGMENT_SIZE bytes each. Appends go to the last segment, and
+// each one is unlinked as soon as everything in it has been read back,
+// so a consumer that never quite catches up doesn't leave an ever
+// growing file behind. A segment that can't be read loses only the
+// messages in it.
+//
+// Nothing here survives a restart, the segments are unlinked when the
+// SpillFile is destroyed.
+class SpillFile {
+  struct Segment {
+    std::string path;
+    int fd;
+
+    // Bytes written, and records in them not yet read back.
+    off_t size;
+    size_t count;
+
+    Segment()
+      : path()
+      , fd(-1)
+      , size(0)
+      , count(0)
+    {}
+  };
+
+  std::string path_;
+  unsigned next_segment_;
+
+  // Read from the front, written at the back.
+  std::deque<Segment> segments_;
+
+  // How much of the front segment has been pulled into rbuf_.
+  off_t read_pos_;
+
+  // Messages written but not yet read back, including ones still in
+  // wbuf_.
+  size_t count_;
+
+  // Appends are collected here and written in large chunks.
+  std::string wbuf_;
+  size_t wbuf_count_;
+
+  // Reads come out of here, refilled from read_pos_.
+  std::string rbuf_;
+  size_t rbuf_pos_;
+
+  // Not copyable.
+  SpillFile(const SpillFile&);
+  SpillFile& operator=(const SpillFile&);
+
+public:
+  SpillFile(std::string path);
+  ~SpillFile();
+
+  bool open();
+
+  size_t size() {
+    return count_;
+  }
+
+  bool empty_p() {
+    return count_ == 0;
+  }
+
+  bool append(const Message& msg);
+  bool read(Message& msg);
+
+  // Read every message not yet read into out, without consuming them.
+  bool peek_all(std::vector<Message>& out);
+
+private:
+  bool add_segment();
+  void drop_front();
+  bool flush_writes();
+  bool fill(size_t need);
+  bool read_record(Message& msg);
+  void reset();
+};
+
+#endif
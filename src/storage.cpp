@@ -0,0 +1,18 @@
+#include "storage.hpp"
+#include "level_engine.hpp"
+#include "memory_engine.hpp"
+#include "config.hpp"
+
+StorageEngine* make_storage_engine(Config& cfg, std::string path) {
+  std::string name = cfg.storage_engine();
+
+  if(name == "leveldb") {
+    LevelEngine* engine = new LevelEngine(path);
+    engine->tune(cfg);
+    return engine;
+  }
+
+  if(name == "memory") return new MemoryEngine();
+
+  return 0;
+}
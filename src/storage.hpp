@@ -0,0 +1,157 @@
+#ifndef STORAGE_HPP
+#define STORAGE_HPP
+
+#include <string>
+#include <vector>
+
+enum DataStatus {
+  eMissing,
+  eValid,
+  eInvalid
+};
+
+// A set of puts and deletes applied all at once.
+class StorageBatch {
+public:
+  struct Op {
+    bool del;
+    std::string key;
+    std::string value;
+
+    Op()
+      : del(false)
+      , key()
+      , value()
+    {}
+  };
+
+  typedef std::vector<Op> Ops;
+
+private:
+  Ops ops_;
+
+public:
+  StorageBatch()
+    : ops_()
+  {}
+
+  void put(const std::string& key, const std::string& value) {
+    Op op;
+    op.del = false;
+    op.key = key;
+    op.value = value;
+    ops_.push_back(op);
+  }
+
+  void del(const std::string& key) {
+    Op op;
+    op.del = true;
+    op.key = key;
+    ops_.push_back(op);
+  }
+
+  const Ops& ops() const {
+    return ops_;
+  }
+
+  bool empty() const {
+    return ops_.empty();
+  }
+};
+
+// A consistent view of the store at one point in time. Only the
+// engine that made it knows what's inside.
+class StorageSnapshot {
+public:
+  virtual ~StorageSnapshot() {}
+};
+
+// Walks the keys starting with a prefix, in order.
+class StorageIterator {
+public:
+  virtual ~StorageIterator() {}
+
+  virtual bool valid() = 0;
+  virtual void next() = 0;
+
+  virtual std::string key() = 0;
+  virtual std::string value() = 0;
+};
+
+// One number an engine wants to report, eg. as a metric sample.
+struct StorageStat {
+  std::string name;
+  std::string help;
+  std::string labels;
+  double value;
+
+  StorageStat()
+    : name()
+    , help()
+    , labels()
+    , value(0)
+  {}
+};
+
+typedef std::vector<StorageStat> StorageStats;
+
+// The key/value store everything durable is kept in: the queue
+// declarations, durable queue indexes and, with LevelStore, the
+// messages themselves.
+//
+// Implementations:
+//   LevelEngine  - LevelDB on disk.
+//   MemoryEngine - a std::map, nothing survives a restart.
+//
+class StorageEngine {
+public:
+  virtual ~StorageEngine() {}
+
+  virtual std::string name() = 0;
+
+  // Returns false and fills in error if the store can't be used.
+  virtual bool open(std::string& error) = 0;
+
+  virtual DataStatus get(const std::string& key, std::string& value,
+                         const StorageSnapshot* snap = 0) = 0;
+
+  virtual bool write(const StorageBatch& batch) = 0;
+
+  bool put(const std::string& key, const std::string& value) {
+    StorageBatch batch;
+    batch.put(key, value);
+    return write(batch);
+  }
+
+  bool del(const std::string& key) {
+    StorageBatch batch;
+    batch.del(key);
+    return write(batch);
+  }
+
+  // The caller deletes the iterator, before releasing snap.
+  virtual StorageIterator* scan(const std::string& prefix,
+                                const StorageSnapshot* snap = 0) = 0;
+
+  virtual const StorageSnapshot* snapshot() = 0;
+  virtual void release(const StorageSnapshot* snap) = 0;
+
+  // Reclaim space held by deleted keys in [start, limit). Blocks until
+  // it's done.
+  virtual void compact(const std::string& start, const std::string& limit) = 0;
+
+  // Whether get() can be called from another thread while the loop
+  // is writing.
+  virtual bool concurrent_reads_p() = 0;
+
+  // Numbers worth exporting, plus free form text that isn't.
+  virtual void stats(StorageStats& out, std::string& detail) = 0;
+};
+
+class Config;
+
+// Makes the engine named by cfg.storage_engine(), set up with the
+// tuning in cfg. Returns 0 for an unknown name.
+StorageEngine* make_storage_engine(Config& cfg, std::string path);
+
+#endif
@@ -0,0 +1,150 @@
+#ifndef TIMER_WHEEL_HPP
+#define TIMER_WHEEL_HPP
+
+#include <vector>
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// A hierarchical timing wheel. Time is cut into ticks of a fixed
+// resolution and each level is a ring of slots, the first covering one
+// tick per slot and each level after that covering a whole turn of the
+// one before it per slot. Adding a timer is a push onto one slot's
+// vector, and each tick only looks at one slot, so both are O(1) no
+// matter how many timers are pending. When a level comes round to its
+// start, the next slot up is emptied into the levels below.
+//
+// Timers can't be cancelled. Whatever fires should check that what it
+// was for still applies.
+template <typename T, int BITS = 8, int LEVELS = 4>
+class TimerWheel {
+  enum { SLOTS = 1 << BITS, MASK = SLOTS - 1 };
+
+  struct Entry {
+    uint64_t tick;
+    T val;
+
+    Entry(uint64_t t, const T& v)
+      : tick(t)
+      , val(v)
+    {}
+  };
+
+  typedef std::vector<Entry> Slot;
+
+  double resolution_;
+  Slot slots_[LEVELS][SLOTS];
+
+  // The last tick that's been run.
+  uint64_t now_;
+  size_t size_;
+
+  // Not copyable.
+  TimerWheel(const TimerWheel&);
+  TimerWheel& operator=(const TimerWheel&);
+
+  // Anything due before first goes in first's slot.
+  void place(const Entry& e, uint64_t first) {
+    uint64_t tick = e.tick > first ? e.tick : first;
+    uint64_t delta = tick - now_;
+
+    int level = 0;
+    while(level < LEVELS - 1 && delta >= ((uint64_t)1 << (BITS * (level + 1)))) {
+      level++;
+    }
+
+    // Past the top level, park it in the furthest slot and let it
+    // cascade back round until it's in range.
+    if(level == LEVELS - 1 &&
+       delta >= ((uint64_t)1 << (BITS * LEVELS))) {
+      tick = now_ + ((uint64_t)MASK << (BITS * level));
+    }
+
+    slots_[level][(tick >> (BITS * level)) & MASK].push_back(e);
+  }
+
+  // Move everything in level's current slot down a level.
+  void cascade(int level) {
+    Slot slot;
+    slot.swap(slots_[level][(now_ >> (BITS * level)) & MASK]);
+
+    // This runs just before the current tick's slot fires, so what's
+    // due now can still go in it.
+    for(typename Slot::iterator i = slot.begin(); i != slot.end(); ++i) {
+      place(*i, now_);
+    }
+  }
+
+public:
+  TimerWheel(double resolution, double now)
+    : resolution_(resolution)
+    , now_((uint64_t)floor(now / resolution))
+    , size_(0)
+  {}
+
+  double resolution() {
+    return resolution_;
+  }
+
+  size_t size() {
+    return size_;
+  }
+
+  bool empty() {
+    return size_ == 0;
+  }
+
+  uint64_t tick_of(double when) {
+    return (uint64_t)ceil(when / resolution_);
+  }
+
+  // Catch an empty wheel up to now, so the next add doesn't leave
+  // advance every tick in between to walk.
+  void skip_to(double now) {
+    uint64_t target = (uint64_t)floor(now / resolution_);
+    if(size_ == 0 && target > now_) now_ = target;
+  }
+
+  // Fire val once the time passes when.
+  void add(double when, const T& val) {
+    place(Entry(tick_of(when), val), now_ + 1);
+    size_++;
+  }
+
+  // Run every tick up to now, calling fire(val) for each timer that's
+  // due. fire can add new timers.
+  template <typename F>
+  void advance(double now, F& fire) {
+    uint64_t target = (uint64_t)floor(now / resolution_);
+
+    while(now_ < target && size_ > 0) {
+      now_++;
+
+      for(int level = LEVELS - 1; level > 0; level--) {
+        bool turned = true;
+
+        for(int below = 0; below < level; below++) {
+          if(((now_ >> (BITS * below)) & MASK) != 0) {
+            turned = false;
+            break;
+          }
+        }
+
+        if(turned) cascade(level);
+      }
+
+      Slot due;
+      due.swap(slots_[0][now_ & MASK]);
+
+      for(typename Slot::iterator i = due.begin(); i != due.end(); ++i) {
+        size_--;
+        fire(i->val);
+      }
+    }
+
+    if(target > now_) now_ = target;
+  }
+};
+
+#endif
@@ -10,7 +10,11 @@
 #include <fcntl.h>
 #include <sys/stat.h>
 #include <sys/socket.h>
+#include <netinet/tcp.h> /* TCP_NODELAY */
+#include <netinet/in.h>  /* inet_ntoa */
+#include <arpa/inet.h>   /* inet_ntoa */
 
+#include "harq.hpp"
 #include "util.hpp"
 #include "server.hpp"
 
@@ -20,6 +24,66 @@ void set_nonblock(int fd) {
     assert(0 <= r && "Setting socket non-block failed!");
 }
 
+// Returns a non-blocking fd listening on hostaddr:port, or -1 if
+// something went wrong (which has already been reported).
+int make_listener(std::string hostaddr, int port) {
+    int fd;
+
+    if((fd = socket(AF_INET, SOCK_STREAM, 0)) == -1) {
+        perror("socket()");
+        return -1;
+    }
+
+    int flags = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, (void *)&flags, sizeof(flags));
+    setsockopt(fd, SOL_SOCKET, SO_KEEPALIVE, (void *)&flags, sizeof(flags));
+
+    struct linger ling = {0, 0};
+    setsockopt(fd, SOL_SOCKET, SO_LINGER, (void *)&ling, sizeof(ling));
+
+    /* XXX: Sending single byte chunks in a response body? Perhaps there is a
+     * need to enable the Nagel algorithm dynamically. For now disabling.
+     */
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, (void *)&flags, sizeof(flags));
+
+    struct sockaddr_in addr;
+
+    /* the memset call clears nonstandard fields in some impementations that
+     * otherwise mess things up.
+     */
+    memset(&addr, 0, sizeof(addr));
+
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+
+    if(!hostaddr.empty()) {
+        addr.sin_addr.s_addr = inet_addr(hostaddr.c_str());
+        if(addr.sin_addr.s_addr == INADDR_NONE){
+            printf("Bad address(%s) to listen\n",hostaddr.c_str());
+            close(fd);
+            return -1;
+        }
+    } else {
+        addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    }
+
+    if(bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        perror("bind()");
+        close(fd);
+        return -1;
+    }
+
+    if(listen(fd, MAX_CONNECTIONS) < 0) {
+        perror("listen()");
+        close(fd);
+        return -1;
+    }
+
+    set_nonblock(fd);
+
+    return fd;
+}
+
 int daemon_init(void) { 
     pid_t pid;
     if((pid = fork()) < 0) {
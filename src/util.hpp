@@ -1,8 +1,12 @@
 #ifndef UTIL_HPP
 #define UTIL_HPP
 
+#include <string>
+
 void set_nonblock(int fd);
 
+int make_listener(std::string hostaddr, int port);
+
 int daemon_init(void);
 
 void sig_term(int signo);
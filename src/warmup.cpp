@@ -0,0 +1,133 @@
+#include "warmup.hpp"
+#include "server.hpp"
+#include "durable_store.hpp"
+#include "debugs.hpp"
+
+#include <iostream>
+
+Warmer::Warmer(Server& s)
+  : server_(s)
+  , thread_()
+  , running_(false)
+  , lock_()
+  , cond_()
+  , pending_()
+  , skip_()
+  , working_()
+  , busy_(false)
+  , stop_(false)
+  , ready_()
+  , async_w_(s.loop())
+{
+  pthread_mutex_init(&lock_, 0);
+  pthread_cond_init(&cond_, 0);
+
+  async_w_.set<Warmer, &Warmer::on_async>(this);
+}
+
+Warmer::~Warmer() {
+  if(running_) {
+    pthread_mutex_lock(&lock_);
+    stop_ = true;
+    pthread_mutex_unlock(&lock_);
+
+    pthread_join(thread_, 0);
+  }
+
+  for(Ready::iterator i = ready_.begin(); i != ready_.end(); ++i) {
+    delete i->second;
+  }
+
+  pthread_cond_destroy(&cond_);
+  pthread_mutex_destroy(&lock_);
+}
+
+bool Warmer::start(const std::deque<std::string>& names) {
+  pending_ = names;
+
+  async_w_.start();
+
+  if(pthread_create(&thread_, 0, &Warmer::run_thread, this) != 0) {
+    std::cerr << "Unable to start warm-up thread, queues will load on first use\n";
+    pending_.clear();
+    return false;
+  }
+
+  running_ = true;
+  return true;
+}
+
+void* Warmer::run_thread(void* arg) {
+  static_cast<Warmer*>(arg)->run();
+  return 0;
+}
+
+void Warmer::run() {
+  pthread_mutex_lock(&lock_);
+
+  while(!stop_ && !pending_.empty()) {
+    std::string name = pending_.front();
+    pending_.pop_front();
+
+    // Already opened by the loop.
+    if(skip_.erase(name) > 0) continue;
+
+    working_ = name;
+    busy_ = true;
+
+    pthread_mutex_unlock(&lock_);
+
+    DurableStore* store = server_.make_store(name);
+    store->warm();
+
+    pthread_mutex_lock(&lock_);
+
+    busy_ = false;
+    ready_[name] = store;
+
+    pthread_cond_broadcast(&cond_);
+
+    async_w_.send();
+  }
+
+  pthread_mutex_unlock(&lock_);
+
+  debugs << "Warm-up finished\n";
+}
+
+DurableStore* Warmer::take(std::string name) {
+  DurableStore* store = 0;
+
+  pthread_mutex_lock(&lock_);
+
+  while(busy_ && working_ == name) {
+    pthread_cond_wait(&cond_, &lock_);
+  }
+
+  Ready::iterator i = ready_.find(name);
+
+  if(i != ready_.end()) {
+    store = i->second;
+    ready_.erase(i);
+  } else if(!pending_.empty()) {
+    skip_.insert(name);
+  }
+
+  pthread_mutex_unlock(&lock_);
+
+  return store;
+}
+
+void Warmer::on_async(ev::async& w, int revents) {
+  Ready ready;
+
+  pthread_mutex_lock(&lock_);
+  ready.swap(ready_);
+  pthread_mutex_unlock(&lock_);
+
+  for(Ready::iterator i = ready.begin(); i != ready.end(); ++i) {
+    optref<Queue> q = server_.queue(i->first);
+
+    if(!q || !q->adopt_store(i->second)) delete i->second;
+  }
+}
@@ -0,0 +1,66 @@
+#ifndef WARMUP_HPP
+#define WARMUP_HPP
+
+#include <deque>
+#include <map>
+#include <set>
+#include <string>
+
+#include <pthread.h>
+
+#include <ev++.h>
+
+class Server;
+class DurableStore;
+
+// Opens the stores of durable queues on a background thread after
+// startup, so the listener can start right away and queues aren't
+// all read in before anyone can connect.
+//
+// Each finished store is handed back to the loop, which gives it to
+// its queue. A queue that's used before its turn takes its store
+// straight from here (waiting if it's being opened right that moment)
+// or opens it itself, so a store is only ever opened once.
+class Warmer {
+  Server& server_;
+
+  pthread_t thread_;
+  bool running_;
+
+  pthread_mutex_t lock_;
+  pthread_cond_t cond_;
+
+  // Everything below is protected by lock_.
+  std::deque<std::string> pending_;
+  std::set<std::string> skip_;
+  std::string working_;
+  bool busy_;
+  bool stop_;
+
+  typedef std::map<std::string, DurableStore*> Ready;
+  Ready ready_;
+
+  ev::async async_w_;
+
+  // Not copyable.
+  Warmer(const Warmer&);
+  Warmer& operator=(const Warmer&);
+
+public:
+  Warmer(Server& s);
+  ~Warmer();
+
+  bool start(const std::deque<std::string>& names);
+
+  // The store for name if it's been opened, otherwise 0 and the caller
+  // should open it.
+  DurableStore* take(std::string name);
+
+  void on_async(ev::async& w, int revents);
+
+private:
+  static void* run_thread(void* arg);
+  void run();
+};
+
+#endif
@@ -1,3600 +1,8171 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: wire.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "wire.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace wire {
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace {
-
-const ::google::protobuf::Descriptor* Message_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Message_reflection_ = NULL;
-const ::google::protobuf::Descriptor* Action_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Action_reflection_ = NULL;
-const ::google::protobuf::Descriptor* BondRequest_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  BondRequest_reflection_ = NULL;
-const ::google::protobuf::Descriptor* ConnectionConfigure_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  ConnectionConfigure_reflection_ = NULL;
-const ::google::protobuf::Descriptor* MessageRange_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  MessageRange_reflection_ = NULL;
-const ::google::protobuf::Descriptor* Queue_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Queue_reflection_ = NULL;
-const ::google::protobuf::Descriptor* Stat_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Stat_reflection_ = NULL;
-const ::google::protobuf::Descriptor* ReplicaAction_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  ReplicaAction_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* ReplicaAction_Type_descriptor_ = NULL;
-const ::google::protobuf::Descriptor* QueueError_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  QueueError_reflection_ = NULL;
-const ::google::protobuf::Descriptor* QueueDeclaration_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  QueueDeclaration_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* QueueDeclaration_Type_descriptor_ = NULL;
-const ::google::protobuf::Descriptor* QueueConfiguration_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  QueueConfiguration_reflection_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_wire_2eproto() {
-  protobuf_AddDesc_wire_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "wire.proto");
-  GOOGLE_CHECK(file != NULL);
-  Message_descriptor_ = file->message_type(0);
-  static const int Message_offsets_[5] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Message, destination_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Message, payload_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Message, id_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Message, flags_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Message, confirm_id_),
+namespace wire {
+PROTOBUF_CONSTEXPR Message::Message(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.destination_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.payload_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/uint64_t{0u}
+  , /*decltype(_impl_.confirm_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.flags_)*/0u
+  , /*decltype(_impl_.ttl_)*/0u
+  , /*decltype(_impl_.expires_)*/0
+  , /*decltype(_impl_.not_before_)*/0
+  , /*decltype(_impl_.redeliveries_)*/0u} {}
+struct MessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MessageDefaultTypeInternal() {}
+  union {
+    Message _instance;
   };
-  Message_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Message_descriptor_,
-      Message::default_instance_,
-      Message_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Message, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Message, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Message));
-  Action_descriptor_ = file->message_type(1);
-  static const int Action_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Action, type_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Action, payload_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Action, id_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MessageDefaultTypeInternal _Message_default_instance_;
+PROTOBUF_CONSTEXPR Action::Action(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.payload_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/uint64_t{0u}
+  , /*decltype(_impl_.type_)*/0} {}
+struct ActionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ActionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ActionDefaultTypeInternal() {}
+  union {
+    Action _instance;
   };
-  Action_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Action_descriptor_,
-      Action::default_instance_,
-      Action_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Action, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Action, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Action));
-  BondRequest_descriptor_ = file->message_type(2);
-  static const int BondRequest_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BondRequest, queue_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BondRequest, destination_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ActionDefaultTypeInternal _Action_default_instance_;
+PROTOBUF_CONSTEXPR ConfirmRange::ConfirmRange(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.first_)*/uint64_t{0u}
+  , /*decltype(_impl_.count_)*/uint64_t{0u}} {}
+struct ConfirmRangeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ConfirmRangeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ConfirmRangeDefaultTypeInternal() {}
+  union {
+    ConfirmRange _instance;
   };
-  BondRequest_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      BondRequest_descriptor_,
-      BondRequest::default_instance_,
-      BondRequest_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BondRequest, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BondRequest, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(BondRequest));
-  ConnectionConfigure_descriptor_ = file->message_type(3);
-  static const int ConnectionConfigure_offsets_[4] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ConnectionConfigure, tap_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ConnectionConfigure, ack_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ConnectionConfigure, confirm_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ConnectionConfigure, inflight_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConfirmRangeDefaultTypeInternal _ConfirmRange_default_instance_;
+PROTOBUF_CONSTEXPR Confirms::Confirms(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ranges_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ConfirmsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ConfirmsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ConfirmsDefaultTypeInternal() {}
+  union {
+    Confirms _instance;
   };
-  ConnectionConfigure_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      ConnectionConfigure_descriptor_,
-      ConnectionConfigure::default_instance_,
-      ConnectionConfigure_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ConnectionConfigure, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ConnectionConfigure, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(ConnectionConfigure));
-  MessageRange_descriptor_ = file->message_type(4);
-  static const int MessageRange_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MessageRange, start_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MessageRange, count_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConfirmsDefaultTypeInternal _Confirms_default_instance_;
+PROTOBUF_CONSTEXPR BondRequest::BondRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.queue_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.destination_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct BondRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BondRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BondRequestDefaultTypeInternal() {}
+  union {
+    BondRequest _instance;
   };
-  MessageRange_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      MessageRange_descriptor_,
-      MessageRange::default_instance_,
-      MessageRange_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MessageRange, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MessageRange, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(MessageRange));
-  Queue_descriptor_ = file->message_type(5);
-  static const int Queue_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Queue, size_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Queue, ranges_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BondRequestDefaultTypeInternal _BondRequest_default_instance_;
+PROTOBUF_CONSTEXPR ConnectionConfigure::ConnectionConfigure(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.tap_)*/false
+  , /*decltype(_impl_.ack_)*/false
+  , /*decltype(_impl_.confirm_)*/false
+  , /*decltype(_impl_.coalesce_confirms_)*/false
+  , /*decltype(_impl_.inflight_)*/0u
+  , /*decltype(_impl_.write_high_water_)*/0u
+  , /*decltype(_impl_.write_low_water_)*/0u
+  , /*decltype(_impl_.batch_messages_)*/0u
+  , /*decltype(_impl_.batch_bytes_)*/0u} {}
+struct ConnectionConfigureDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ConnectionConfigureDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ConnectionConfigureDefaultTypeInternal() {}
+  union {
+    ConnectionConfigure _instance;
   };
-  Queue_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Queue_descriptor_,
-      Queue::default_instance_,
-      Queue_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Queue, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Queue, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Queue));
-  Stat_descriptor_ = file->message_type(6);
-  static const int Stat_offsets_[4] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stat, name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stat, exists_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stat, transient_size_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stat, durable_size_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConnectionConfigureDefaultTypeInternal _ConnectionConfigure_default_instance_;
+PROTOBUF_CONSTEXPR MessageBatch::MessageBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.messages_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MessageBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MessageBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MessageBatchDefaultTypeInternal() {}
+  union {
+    MessageBatch _instance;
   };
-  Stat_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Stat_descriptor_,
-      Stat::default_instance_,
-      Stat_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stat, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stat, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Stat));
-  ReplicaAction_descriptor_ = file->message_type(7);
-  static const int ReplicaAction_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReplicaAction, type_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReplicaAction, payload_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MessageBatchDefaultTypeInternal _MessageBatch_default_instance_;
+PROTOBUF_CONSTEXPR MessageRange::MessageRange(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.start_)*/uint64_t{0u}
+  , /*decltype(_impl_.count_)*/uint64_t{0u}} {}
+struct MessageRangeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MessageRangeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MessageRangeDefaultTypeInternal() {}
+  union {
+    MessageRange _instance;
   };
-  ReplicaAction_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      ReplicaAction_descriptor_,
-      ReplicaAction::default_instance_,
-      ReplicaAction_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReplicaAction, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReplicaAction, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(ReplicaAction));
-  ReplicaAction_Type_descriptor_ = ReplicaAction_descriptor_->enum_type(0);
-  QueueError_descriptor_ = file->message_type(8);
-  static const int QueueError_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(QueueError, queue_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(QueueError, error_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MessageRangeDefaultTypeInternal _MessageRange_default_instance_;
+PROTOBUF_CONSTEXPR Queue::Queue(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.ranges_)*/{}
+  , /*decltype(_impl_.next_index_)*/uint64_t{0u}
+  , /*decltype(_impl_.size_)*/0} {}
+struct QueueDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR QueueDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~QueueDefaultTypeInternal() {}
+  union {
+    Queue _instance;
   };
-  QueueError_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      QueueError_descriptor_,
-      QueueError::default_instance_,
-      QueueError_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(QueueError, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(QueueError, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(QueueError));
-  QueueDeclaration_descriptor_ = file->message_type(9);
-  static const int QueueDeclaration_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(QueueDeclaration, name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(QueueDeclaration, type_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 QueueDefaultTypeInternal _Queue_default_instance_;
+PROTOBUF_CONSTEXPR Stat::Stat(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.exists_)*/false
+  , /*decltype(_impl_.transient_size_)*/0u
+  , /*decltype(_impl_.enqueued_)*/uint64_t{0u}
+  , /*decltype(_impl_.dequeued_)*/uint64_t{0u}
+  , /*decltype(_impl_.acked_)*/uint64_t{0u}
+  , /*decltype(_impl_.redelivered_)*/uint64_t{0u}
+  , /*decltype(_impl_.bytes_in_)*/uint64_t{0u}
+  , /*decltype(_impl_.durable_size_)*/0u
+  , /*decltype(_impl_.subscribers_)*/0u
+  , /*decltype(_impl_.bytes_out_)*/uint64_t{0u}
+  , /*decltype(_impl_.enqueue_rate_)*/0
+  , /*decltype(_impl_.dequeue_rate_)*/0
+  , /*decltype(_impl_.ack_rate_)*/0
+  , /*decltype(_impl_.redelivery_rate_)*/0
+  , /*decltype(_impl_.oldest_age_)*/0
+  , /*decltype(_impl_.write_backlog_)*/uint64_t{0u}
+  , /*decltype(_impl_.inflight_)*/0u
+  , /*decltype(_impl_.spilled_size_)*/0u
+  , /*decltype(_impl_.memory_bytes_)*/uint64_t{0u}
+  , /*decltype(_impl_.expired_)*/uint64_t{0u}
+  , /*decltype(_impl_.scheduled_size_)*/0u} {}
+struct StatDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StatDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StatDefaultTypeInternal() {}
+  union {
+    Stat _instance;
   };
-  QueueDeclaration_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      QueueDeclaration_descriptor_,
-      QueueDeclaration::default_instance_,
-      QueueDeclaration_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(QueueDeclaration, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(QueueDeclaration, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(QueueDeclaration));
-  QueueDeclaration_Type_descriptor_ = QueueDeclaration_descriptor_->enum_type(0);
-  QueueConfiguration_descriptor_ = file->message_type(10);
-  static const int QueueConfiguration_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(QueueConfiguration, queues_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatDefaultTypeInternal _Stat_default_instance_;
+PROTOBUF_CONSTEXPR ConnectionStat::ConnectionStat(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.fd_)*/0
+  , /*decltype(_impl_.subscriptions_)*/0u
+  , /*decltype(_impl_.inflight_)*/0u
+  , /*decltype(_impl_.inflight_max_)*/0u
+  , /*decltype(_impl_.write_backlog_)*/uint64_t{0u}
+  , /*decltype(_impl_.ack_)*/false
+  , /*decltype(_impl_.tap_)*/false
+  , /*decltype(_impl_.replica_)*/false} {}
+struct ConnectionStatDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ConnectionStatDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ConnectionStatDefaultTypeInternal() {}
+  union {
+    ConnectionStat _instance;
   };
-  QueueConfiguration_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      QueueConfiguration_descriptor_,
-      QueueConfiguration::default_instance_,
-      QueueConfiguration_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(QueueConfiguration, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(QueueConfiguration, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(QueueConfiguration));
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_wire_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Message_descriptor_, &Message::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Action_descriptor_, &Action::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    BondRequest_descriptor_, &BondRequest::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    ConnectionConfigure_descriptor_, &ConnectionConfigure::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    MessageRange_descriptor_, &MessageRange::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Queue_descriptor_, &Queue::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Stat_descriptor_, &Stat::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    ReplicaAction_descriptor_, &ReplicaAction::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    QueueError_descriptor_, &QueueError::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    QueueDeclaration_descriptor_, &QueueDeclaration::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    QueueConfiguration_descriptor_, &QueueConfiguration::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_wire_2eproto() {
-  delete Message::default_instance_;
-  delete Message_reflection_;
-  delete Action::default_instance_;
-  delete Action_reflection_;
-  delete BondRequest::default_instance_;
-  delete BondRequest_reflection_;
-  delete ConnectionConfigure::default_instance_;
-  delete ConnectionConfigure_reflection_;
-  delete MessageRange::default_instance_;
-  delete MessageRange_reflection_;
-  delete Queue::default_instance_;
-  delete Queue_reflection_;
-  delete Stat::default_instance_;
-  delete Stat_reflection_;
-  delete ReplicaAction::default_instance_;
-  delete ReplicaAction_reflection_;
-  delete QueueError::default_instance_;
-  delete QueueError_reflection_;
-  delete QueueDeclaration::default_instance_;
-  delete QueueDeclaration_reflection_;
-  delete QueueConfiguration::default_instance_;
-  delete QueueConfiguration_reflection_;
-}
-
-void protobuf_AddDesc_wire_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\nwire.proto\022\004wire\"^\n\007Message\022\023\n\013destina"
-    "tion\030\001 \002(\t\022\017\n\007payload\030\002 \002(\014\022\n\n\002id\030\003 \001(\004\022"
-    "\r\n\005flags\030\004 \001(\r\022\022\n\nconfirm_id\030\005 \001(\004\"3\n\006Ac"
-    "tion\022\014\n\004type\030\001 \002(\005\022\017\n\007payload\030\002 \001(\t\022\n\n\002i"
-    "d\030\003 \001(\004\"1\n\013BondRequest\022\r\n\005queue\030\001 \002(\t\022\023\n"
-    "\013destination\030\002 \002(\t\"R\n\023ConnectionConfigur"
-    "e\022\013\n\003tap\030\001 \001(\010\022\013\n\003ack\030\002 \001(\010\022\017\n\007confirm\030\003"
-    " \001(\010\022\020\n\010inflight\030\004 \001(\r\",\n\014MessageRange\022\r"
-    "\n\005start\030\001 \002(\005\022\r\n\005count\030\002 \002(\005\"9\n\005Queue\022\014\n"
-    "\004size\030\001 \002(\005\022\"\n\006ranges\030\002 \003(\0132\022.wire.Messa"
-    "geRange\"R\n\004Stat\022\014\n\004name\030\001 \002(\t\022\016\n\006exists\030"
-    "\002 \002(\010\022\026\n\016transient_size\030\003 \001(\r\022\024\n\014durable"
-    "_size\030\004 \001(\r\"j\n\rReplicaAction\022&\n\004type\030\001 \002"
-    "(\0162\030.wire.ReplicaAction.Type\022\017\n\007payload\030"
-    "\002 \001(\014\" \n\004Type\022\n\n\006eStart\020\000\022\014\n\010eReserve\020\001\""
-    "*\n\nQueueError\022\r\n\005queue\030\001 \002(\t\022\r\n\005error\030\002 "
-    "\001(\t\"\201\001\n\020QueueDeclaration\022\014\n\004name\030\001 \002(\t\022)"
-    "\n\004type\030\002 \002(\0162\033.wire.QueueDeclaration.Typ"
-    "e\"4\n\004Type\022\016\n\neBroadcast\020\000\022\016\n\neTransient\020"
-    "\001\022\014\n\010eDurable\020\002\"<\n\022QueueConfiguration\022&\n"
-    "\006queues\030\001 \003(\0132\026.wire.QueueDeclaration", 837);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "wire.proto", &protobuf_RegisterTypes);
-  Message::default_instance_ = new Message();
-  Action::default_instance_ = new Action();
-  BondRequest::default_instance_ = new BondRequest();
-  ConnectionConfigure::default_instance_ = new ConnectionConfigure();
-  MessageRange::default_instance_ = new MessageRange();
-  Queue::default_instance_ = new Queue();
-  Stat::default_instance_ = new Stat();
-  ReplicaAction::default_instance_ = new ReplicaAction();
-  QueueError::default_instance_ = new QueueError();
-  QueueDeclaration::default_instance_ = new QueueDeclaration();
-  QueueConfiguration::default_instance_ = new QueueConfiguration();
-  Message::default_instance_->InitAsDefaultInstance();
-  Action::default_instance_->InitAsDefaultInstance();
-  BondRequest::default_instance_->InitAsDefaultInstance();
-  ConnectionConfigure::default_instance_->InitAsDefaultInstance();
-  MessageRange::default_instance_->InitAsDefaultInstance();
-  Queue::default_instance_->InitAsDefaultInstance();
-  Stat::default_instance_->InitAsDefaultInstance();
-  ReplicaAction::default_instance_->InitAsDefaultInstance();
-  QueueError::default_instance_->InitAsDefaultInstance();
-  QueueDeclaration::default_instance_->InitAsDefaultInstance();
-  QueueConfiguration::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_wire_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_wire_2eproto {
-  StaticDescriptorInitializer_wire_2eproto() {
-    protobuf_AddDesc_wire_2eproto();
-  }
-} static_descriptor_initializer_wire_2eproto_;
-
-// ===================================================================
-
-#ifndef _MSC_VER
-const int Message::kDestinationFieldNumber;
-const int Message::kPayloadFieldNumber;
-const int Message::kIdFieldNumber;
-const int Message::kFlagsFieldNumber;
-const int Message::kConfirmIdFieldNumber;
-#endif  // !_MSC_VER
-
-Message::Message()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConnectionStatDefaultTypeInternal _ConnectionStat_default_instance_;
+PROTOBUF_CONSTEXPR StatDump::StatDump(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.queues_)*/{}
+  , /*decltype(_impl_.connections_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StatDumpDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StatDumpDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StatDumpDefaultTypeInternal() {}
+  union {
+    StatDump _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatDumpDefaultTypeInternal _StatDump_default_instance_;
+PROTOBUF_CONSTEXPR ReplicaAction::ReplicaAction(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.payload_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.compressed_)*/false
+  , /*decltype(_impl_.lsn_)*/uint64_t{0u}} {}
+struct ReplicaActionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplicaActionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplicaActionDefaultTypeInternal() {}
+  union {
+    ReplicaAction _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplicaActionDefaultTypeInternal _ReplicaAction_default_instance_;
+PROTOBUF_CONSTEXPR ReplicaBatch::ReplicaBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReplicaBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplicaBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplicaBatchDefaultTypeInternal() {}
+  union {
+    ReplicaBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplicaBatchDefaultTypeInternal _ReplicaBatch_default_instance_;
+PROTOBUF_CONSTEXPR ReplicaEntry::ReplicaEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.messages_)*/{}
+  , /*decltype(_impl_.queue_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.destination_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.message_)*/nullptr
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.kind_)*/0
+  , /*decltype(_impl_.index_)*/uint64_t{0u}
+  , /*decltype(_impl_.lsn_)*/uint64_t{0u}
+  , /*decltype(_impl_.epoch_)*/uint64_t{0u}
+  , /*decltype(_impl_.count_)*/0u} {}
+struct ReplicaEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplicaEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplicaEntryDefaultTypeInternal() {}
+  union {
+    ReplicaEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplicaEntryDefaultTypeInternal _ReplicaEntry_default_instance_;
+PROTOBUF_CONSTEXPR ReplicaStart::ReplicaStart(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.epoch_)*/uint64_t{0u}
+  , /*decltype(_impl_.lsn_)*/uint64_t{0u}} {}
+struct ReplicaStartDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplicaStartDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplicaStartDefaultTypeInternal() {}
+  union {
+    ReplicaStart _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplicaStartDefaultTypeInternal _ReplicaStart_default_instance_;
+PROTOBUF_CONSTEXPR QueueError::QueueError(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.queue_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct QueueErrorDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR QueueErrorDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~QueueErrorDefaultTypeInternal() {}
+  union {
+    QueueError _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 QueueErrorDefaultTypeInternal _QueueError_default_instance_;
+PROTOBUF_CONSTEXPR QueueDeclaration::QueueDeclaration(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.sync_replicas_)*/0u
+  , /*decltype(_impl_.ttl_)*/0u
+  , /*decltype(_impl_.ack_timeout_)*/0u
+  , /*decltype(_impl_.durable_size_)*/uint64_t{0u}
+  , /*decltype(_impl_.weight_)*/0u
+  , /*decltype(_impl_.expiries_indexed_)*/false} {}
+struct QueueDeclarationDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR QueueDeclarationDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~QueueDeclarationDefaultTypeInternal() {}
+  union {
+    QueueDeclaration _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 QueueDeclarationDefaultTypeInternal _QueueDeclaration_default_instance_;
+PROTOBUF_CONSTEXPR QueueReplication::QueueReplication(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.queue_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sync_replicas_)*/0u} {}
+struct QueueReplicationDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR QueueReplicationDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~QueueReplicationDefaultTypeInternal() {}
+  union {
+    QueueReplication _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 QueueReplicationDefaultTypeInternal _QueueReplication_default_instance_;
+PROTOBUF_CONSTEXPR QueueOptions::QueueOptions(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.queue_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ttl_)*/0u
+  , /*decltype(_impl_.ack_timeout_)*/0u
+  , /*decltype(_impl_.weight_)*/0u} {}
+struct QueueOptionsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR QueueOptionsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~QueueOptionsDefaultTypeInternal() {}
+  union {
+    QueueOptions _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 QueueOptionsDefaultTypeInternal _QueueOptions_default_instance_;
+PROTOBUF_CONSTEXPR QueueConfiguration::QueueConfiguration(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.queues_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct QueueConfigurationDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR QueueConfigurationDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~QueueConfigurationDefaultTypeInternal() {}
+  union {
+    QueueConfiguration _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 QueueConfigurationDefaultTypeInternal _QueueConfiguration_default_instance_;
+}  // namespace wire
+static ::_pb::Metadata file_level_metadata_wire_2eproto[21];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_wire_2eproto[3];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_wire_2eproto = nullptr;
+
+const uint32_t TableStruct_wire_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::wire::Message, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::wire::Message, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::wire::Message, _impl_.destination_),
+  PROTOBUF_FIELD_OFFSET(::wire::Message, _impl_.payload_),
+  PROTOBUF_FIELD_OFFSET(::wire::Message, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::wire::Message, _impl_.flags_),
+  PROTOBUF_FIELD_OFFSET(::wire::Message, _impl_.confirm_id_),
+  PROTOBUF_FIELD_OFFSET(::wire::Message, _impl_.ttl_),
+  PROTOBUF_FIELD_OFFSET(::wire::Message, _impl_.expires_),
+  PROTOBUF_FIELD_OFFSET(::wire::Message, _impl_.not_before_),
+  PROTOBUF_FIELD_OFFSET(::wire::Message, _impl_.redeliveries_),
+  0,
+  1,
+  2,
+  4,
+  3,
+  5,
+  6,
+  7,
+  8,
+  PROTOBUF_FIELD_OFFSET(::wire::Action, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::wire::Action, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::wire::Action, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::wire::Action, _impl_.payload_),
+  PROTOBUF_FIELD_OFFSET(::wire::Action, _impl_.id_),
+  2,
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::wire::ConfirmRange, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::wire::ConfirmRange, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::wire::ConfirmRange, _impl_.first_),
+  PROTOBUF_FIELD_OFFSET(::wire::ConfirmRange, _impl_.count_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::wire::Confirms, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::wire::Confirms, _impl_.ranges_),
+  PROTOBUF_FIELD_OFFSET(::wire::BondRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::wire::BondRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::wire::BondRequest, _impl_.queue_),
+  PROTOBUF_FIELD_OFFSET(::wire::BondRequest, _impl_.destination_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::wire::ConnectionConfigure, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::wire::ConnectionConfigure, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::wire::ConnectionConfigure, _impl_.tap_),
+  PROTOBUF_FIELD_OFFSET(::wire::ConnectionConfigure, _impl_.ack_),
+  PROTOBUF_FIELD_OFFSET(::wire::ConnectionConfigure, _impl_.confirm_),
+  PROTOBUF_FIELD_OFFSET(::wire::ConnectionConfigure, _impl_.inflight_),
+  PROTOBUF_FIELD_OFFSET(::wire::ConnectionConfigure, _impl_.write_high_water_),
+  PROTOBUF_FIELD_OFFSET(::wire::ConnectionConfigure, _impl_.write_low_water_),
+  PROTOBUF_FIELD_OFFSET(::wire::ConnectionConfigure, _impl_.batch_messages_),
+  PROTOBUF_FIELD_OFFSET(::wire::ConnectionConfigure, _impl_.batch_bytes_),
+  PROTOBUF_FIELD_OFFSET(::wire::ConnectionConfigure, _impl_.coalesce_confirms_),
+  0,
+  1,
+  2,
+  4,
+  5,
+  6,
+  7,
+  8,
+  3,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::wire::MessageBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::wire::MessageBatch, _impl_.messages_),
+  PROTOBUF_FIELD_OFFSET(::wire::MessageRange, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::wire::MessageRange, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::wire::MessageRange, _impl_.start_),
+  PROTOBUF_FIELD_OFFSET(::wire::MessageRange, _impl_.count_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::wire::Queue, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::wire::Queue, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::wire::Queue, _impl_.size_),
+  PROTOBUF_FIELD_OFFSET(::wire::Queue, _impl_.ranges_),
+  PROTOBUF_FIELD_OFFSET(::wire::Queue, _impl_.next_index_),
+  1,
+  ~0u,
+  0,
+  PROTOBUF_FIELD_OFFSET(::wire::Stat, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::wire::Stat, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::wire::Stat, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::wire::Stat, _impl_.exists_),
+  PROTOBUF_FIELD_OFFSET(::wire::Stat, _impl_.transient_size_),
+  PROTOBUF_FIELD_OFFSET(::wire::Stat, _impl_.durable_size_),
+  PROTOBUF_FIELD_OFFSET(::wire::Stat, _impl_.enqueued_),
+  PROTOBUF_FIELD_OFFSET(::wire::Stat, _impl_.dequeued_),
+  PROTOBUF_FIELD_OFFSET(::wire::Stat, _impl_.acked_),
+  PROTOBUF_FIELD_OFFSET(::wire::Stat, _impl_.redelivered_),
+  PROTOBUF_FIELD_OFFSET(::wire::Stat, _impl_.bytes_in_),
+  PROTOBUF_FIELD_OFFSET(::wire::Stat, _impl_.bytes_out_),
+  PROTOBUF_FIELD_OFFSET(::wire::Stat, _impl_.enqueue_rate_),
+  PROTOBUF_FIELD_OFFSET(::wire::Stat, _impl_.dequeue_rate_),
+  PROTOBUF_FIELD_OFFSET(::wire::Stat, _impl_.ack_rate_),
+  PROTOBUF_FIELD_OFFSET(::wire::Stat, _impl_.redelivery_rate_),
+  PROTOBUF_FIELD_OFFSET(::wire::Stat, _impl_.subscribers_),
+  PROTOBUF_FIELD_OFFSET(::wire::Stat, _impl_.inflight_),
+  PROTOBUF_FIELD_OFFSET(::wire::Stat, _impl_.oldest_age_),
+  PROTOBUF_FIELD_OFFSET(::wire::Stat, _impl_.write_backlog_),
+  PROTOBUF_FIELD_OFFSET(::wire::Stat, _impl_.memory_bytes_),
+  PROTOBUF_FIELD_OFFSET(::wire::Stat, _impl_.spilled_size_),
+  PROTOBUF_FIELD_OFFSET(::wire::Stat, _impl_.expired_),
+  PROTOBUF_FIELD_OFFSET(::wire::Stat, _impl_.scheduled_size_),
+  0,
+  1,
+  2,
+  8,
+  3,
+  4,
+  5,
+  6,
+  7,
+  10,
+  11,
+  12,
+  13,
+  14,
+  9,
+  17,
+  15,
+  16,
+  19,
+  18,
+  20,
+  21,
+  PROTOBUF_FIELD_OFFSET(::wire::ConnectionStat, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::wire::ConnectionStat, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::wire::ConnectionStat, _impl_.fd_),
+  PROTOBUF_FIELD_OFFSET(::wire::ConnectionStat, _impl_.subscriptions_),
+  PROTOBUF_FIELD_OFFSET(::wire::ConnectionStat, _impl_.inflight_),
+  PROTOBUF_FIELD_OFFSET(::wire::ConnectionStat, _impl_.inflight_max_),
+  PROTOBUF_FIELD_OFFSET(::wire::ConnectionStat, _impl_.write_backlog_),
+  PROTOBUF_FIELD_OFFSET(::wire::ConnectionStat, _impl_.ack_),
+  PROTOBUF_FIELD_OFFSET(::wire::ConnectionStat, _impl_.tap_),
+  PROTOBUF_FIELD_OFFSET(::wire::ConnectionStat, _impl_.replica_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::wire::StatDump, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::wire::StatDump, _impl_.queues_),
+  PROTOBUF_FIELD_OFFSET(::wire::StatDump, _impl_.connections_),
+  PROTOBUF_FIELD_OFFSET(::wire::ReplicaAction, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::wire::ReplicaAction, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::wire::ReplicaAction, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::wire::ReplicaAction, _impl_.payload_),
+  PROTOBUF_FIELD_OFFSET(::wire::ReplicaAction, _impl_.compressed_),
+  PROTOBUF_FIELD_OFFSET(::wire::ReplicaAction, _impl_.lsn_),
+  1,
+  0,
+  2,
+  3,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::wire::ReplicaBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::wire::ReplicaBatch, _impl_.entries_),
+  PROTOBUF_FIELD_OFFSET(::wire::ReplicaEntry, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::wire::ReplicaEntry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::wire::ReplicaEntry, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::wire::ReplicaEntry, _impl_.queue_),
+  PROTOBUF_FIELD_OFFSET(::wire::ReplicaEntry, _impl_.kind_),
+  PROTOBUF_FIELD_OFFSET(::wire::ReplicaEntry, _impl_.destination_),
+  PROTOBUF_FIELD_OFFSET(::wire::ReplicaEntry, _impl_.index_),
+  PROTOBUF_FIELD_OFFSET(::wire::ReplicaEntry, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::wire::ReplicaEntry, _impl_.message_),
+  PROTOBUF_FIELD_OFFSET(::wire::ReplicaEntry, _impl_.lsn_),
+  PROTOBUF_FIELD_OFFSET(::wire::ReplicaEntry, _impl_.epoch_),
+  PROTOBUF_FIELD_OFFSET(::wire::ReplicaEntry, _impl_.messages_),
+  PROTOBUF_FIELD_OFFSET(::wire::ReplicaEntry, _impl_.key_),
+  4,
+  0,
+  5,
+  1,
+  6,
+  9,
+  3,
+  7,
+  8,
+  ~0u,
+  2,
+  PROTOBUF_FIELD_OFFSET(::wire::ReplicaStart, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::wire::ReplicaStart, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::wire::ReplicaStart, _impl_.epoch_),
+  PROTOBUF_FIELD_OFFSET(::wire::ReplicaStart, _impl_.lsn_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::wire::QueueError, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::wire::QueueError, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::wire::QueueError, _impl_.queue_),
+  PROTOBUF_FIELD_OFFSET(::wire::QueueError, _impl_.error_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::wire::QueueDeclaration, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::wire::QueueDeclaration, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::wire::QueueDeclaration, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::wire::QueueDeclaration, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::wire::QueueDeclaration, _impl_.sync_replicas_),
+  PROTOBUF_FIELD_OFFSET(::wire::QueueDeclaration, _impl_.ttl_),
+  PROTOBUF_FIELD_OFFSET(::wire::QueueDeclaration, _impl_.ack_timeout_),
+  PROTOBUF_FIELD_OFFSET(::wire::QueueDeclaration, _impl_.weight_),
+  PROTOBUF_FIELD_OFFSET(::wire::QueueDeclaration, _impl_.durable_size_),
+  PROTOBUF_FIELD_OFFSET(::wire::QueueDeclaration, _impl_.expiries_indexed_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  6,
+  5,
+  7,
+  PROTOBUF_FIELD_OFFSET(::wire::QueueReplication, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::wire::QueueReplication, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::wire::QueueReplication, _impl_.queue_),
+  PROTOBUF_FIELD_OFFSET(::wire::QueueReplication, _impl_.sync_replicas_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::wire::QueueOptions, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::wire::QueueOptions, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::wire::QueueOptions, _impl_.queue_),
+  PROTOBUF_FIELD_OFFSET(::wire::QueueOptions, _impl_.ttl_),
+  PROTOBUF_FIELD_OFFSET(::wire::QueueOptions, _impl_.ack_timeout_),
+  PROTOBUF_FIELD_OFFSET(::wire::QueueOptions, _impl_.weight_),
+  0,
+  1,
+  2,
+  3,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::wire::QueueConfiguration, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::wire::QueueConfiguration, _impl_.queues_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 15, -1, sizeof(::wire::Message)},
+  { 24, 33, -1, sizeof(::wire::Action)},
+  { 36, 44, -1, sizeof(::wire::ConfirmRange)},
+  { 46, -1, -1, sizeof(::wire::Confirms)},
+  { 53, 61, -1, sizeof(::wire::BondRequest)},
+  { 63, 78, -1, sizeof(::wire::ConnectionConfigure)},
+  { 87, -1, -1, sizeof(::wire::MessageBatch)},
+  { 94, 102, -1, sizeof(::wire::MessageRange)},
+  { 104, 113, -1, sizeof(::wire::Queue)},
+  { 116, 144, -1, sizeof(::wire::Stat)},
+  { 166, 180, -1, sizeof(::wire::ConnectionStat)},
+  { 188, -1, -1, sizeof(::wire::StatDump)},
+  { 196, 206, -1, sizeof(::wire::ReplicaAction)},
+  { 210, -1, -1, sizeof(::wire::ReplicaBatch)},
+  { 217, 234, -1, sizeof(::wire::ReplicaEntry)},
+  { 245, 253, -1, sizeof(::wire::ReplicaStart)},
+  { 255, 263, -1, sizeof(::wire::QueueError)},
+  { 265, 279, -1, sizeof(::wire::QueueDeclaration)},
+  { 287, 295, -1, sizeof(::wire::QueueReplication)},
+  { 297, 307, -1, sizeof(::wire::QueueOptions)},
+  { 311, -1, -1, sizeof(::wire::QueueConfiguration)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::wire::_Message_default_instance_._instance,
+  &::wire::_Action_default_instance_._instance,
+  &::wire::_ConfirmRange_default_instance_._instance,
+  &::wire::_Confirms_default_instance_._instance,
+  &::wire::_BondRequest_default_instance_._instance,
+  &::wire::_ConnectionConfigure_default_instance_._instance,
+  &::wire::_MessageBatch_default_instance_._instance,
+  &::wire::_MessageRange_default_instance_._instance,
+  &::wire::_Queue_default_instance_._instance,
+  &::wire::_Stat_default_instance_._instance,
+  &::wire::_ConnectionStat_default_instance_._instance,
+  &::wire::_StatDump_default_instance_._instance,
+  &::wire::_ReplicaAction_default_instance_._instance,
+  &::wire::_ReplicaBatch_default_instance_._instance,
+  &::wire::_ReplicaEntry_default_instance_._instance,
+  &::wire::_ReplicaStart_default_instance_._instance,
+  &::wire::_QueueError_default_instance_._instance,
+  &::wire::_QueueDeclaration_default_instance_._instance,
+  &::wire::_QueueReplication_default_instance_._instance,
+  &::wire::_QueueOptions_default_instance_._instance,
+  &::wire::_QueueConfiguration_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_wire_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\nwire.proto\022\004wire\"\246\001\n\007Message\022\023\n\013destin"
+  "ation\030\001 \002(\t\022\017\n\007payload\030\002 \002(\014\022\n\n\002id\030\003 \001(\004"
+  "\022\r\n\005flags\030\004 \001(\r\022\022\n\nconfirm_id\030\005 \001(\004\022\013\n\003t"
+  "tl\030\006 \001(\r\022\017\n\007expires\030\007 \001(\001\022\022\n\nnot_before\030"
+  "\010 \001(\001\022\024\n\014redeliveries\030\t \001(\r\"3\n\006Action\022\014\n"
+  "\004type\030\001 \002(\005\022\017\n\007payload\030\002 \001(\t\022\n\n\002id\030\003 \001(\004"
+  "\",\n\014ConfirmRange\022\r\n\005first\030\001 \002(\004\022\r\n\005count"
+  "\030\002 \002(\004\".\n\010Confirms\022\"\n\006ranges\030\001 \003(\0132\022.wir"
+  "e.ConfirmRange\"1\n\013BondRequest\022\r\n\005queue\030\001"
+  " \002(\t\022\023\n\013destination\030\002 \002(\t\"\315\001\n\023Connection"
+  "Configure\022\013\n\003tap\030\001 \001(\010\022\013\n\003ack\030\002 \001(\010\022\017\n\007c"
+  "onfirm\030\003 \001(\010\022\020\n\010inflight\030\004 \001(\r\022\030\n\020write_"
+  "high_water\030\005 \001(\r\022\027\n\017write_low_water\030\006 \001("
+  "\r\022\026\n\016batch_messages\030\007 \001(\r\022\023\n\013batch_bytes"
+  "\030\010 \001(\r\022\031\n\021coalesce_confirms\030\t \001(\010\" \n\014Mes"
+  "sageBatch\022\020\n\010messages\030\001 \003(\014\",\n\014MessageRa"
+  "nge\022\r\n\005start\030\001 \002(\004\022\r\n\005count\030\002 \002(\004\"M\n\005Que"
+  "ue\022\014\n\004size\030\001 \002(\005\022\"\n\006ranges\030\002 \003(\0132\022.wire."
+  "MessageRange\022\022\n\nnext_index\030\003 \001(\004\"\275\003\n\004Sta"
+  "t\022\014\n\004name\030\001 \002(\t\022\016\n\006exists\030\002 \002(\010\022\026\n\016trans"
+  "ient_size\030\003 \001(\r\022\024\n\014durable_size\030\004 \001(\r\022\020\n"
+  "\010enqueued\030\005 \001(\004\022\020\n\010dequeued\030\006 \001(\004\022\r\n\005ack"
+  "ed\030\007 \001(\004\022\023\n\013redelivered\030\010 \001(\004\022\020\n\010bytes_i"
+  "n\030\t \001(\004\022\021\n\tbytes_out\030\n \001(\004\022\024\n\014enqueue_ra"
+  "te\030\013 \001(\001\022\024\n\014dequeue_rate\030\014 \001(\001\022\020\n\010ack_ra"
+  "te\030\r \001(\001\022\027\n\017redelivery_rate\030\016 \001(\001\022\023\n\013sub"
+  "scribers\030\017 \001(\r\022\020\n\010inflight\030\020 \001(\r\022\022\n\nolde"
+  "st_age\030\021 \001(\001\022\025\n\rwrite_backlog\030\022 \001(\004\022\024\n\014m"
+  "emory_bytes\030\023 \001(\004\022\024\n\014spilled_size\030\024 \001(\r\022"
+  "\017\n\007expired\030\025 \001(\004\022\026\n\016scheduled_size\030\026 \001(\r"
+  "\"\235\001\n\016ConnectionStat\022\n\n\002fd\030\001 \002(\005\022\025\n\rsubsc"
+  "riptions\030\002 \001(\r\022\020\n\010inflight\030\003 \001(\r\022\024\n\014infl"
+  "ight_max\030\004 \001(\r\022\025\n\rwrite_backlog\030\005 \001(\004\022\013\n"
+  "\003ack\030\006 \001(\010\022\013\n\003tap\030\007 \001(\010\022\017\n\007replica\030\010 \001(\010"
+  "\"Q\n\010StatDump\022\032\n\006queues\030\001 \003(\0132\n.wire.Stat"
+  "\022)\n\013connections\030\002 \003(\0132\024.wire.ConnectionS"
+  "tat\"\255\001\n\rReplicaAction\022&\n\004type\030\001 \002(\0162\030.wi"
+  "re.ReplicaAction.Type\022\017\n\007payload\030\002 \001(\014\022\022"
+  "\n\ncompressed\030\003 \001(\010\022\013\n\003lsn\030\004 \001(\004\"B\n\004Type\022"
+  "\n\n\006eStart\020\000\022\014\n\010eReserve\020\001\022\n\n\006eEntry\020\002\022\n\n"
+  "\006eBatch\020\003\022\010\n\004eAck\020\004\"\037\n\014ReplicaBatch\022\017\n\007e"
+  "ntries\030\001 \003(\014\"\276\003\n\014ReplicaEntry\022%\n\004type\030\001 "
+  "\002(\0162\027.wire.ReplicaEntry.Type\022\r\n\005queue\030\002 "
+  "\001(\t\022)\n\004kind\030\003 \001(\0162\033.wire.QueueDeclaratio"
+  "n.Type\022\023\n\013destination\030\004 \001(\t\022\r\n\005index\030\005 \001"
+  "(\004\022\r\n\005count\030\006 \001(\r\022\036\n\007message\030\007 \001(\0132\r.wir"
+  "e.Message\022\013\n\003lsn\030\010 \001(\004\022\r\n\005epoch\030\t \001(\004\022\037\n"
+  "\010messages\030\n \003(\0132\r.wire.Message\022\013\n\003key\030\013 "
+  "\001(\t\"\257\001\n\004Type\022\014\n\010eDeclare\020\000\022\t\n\005eBond\020\001\022\013\n"
+  "\007eAppend\020\002\022\n\n\006eErase\020\003\022\014\n\010eEnqueue\020\004\022\014\n\010"
+  "eDequeue\020\005\022\n\n\006eReset\020\006\022\013\n\007eSynced\020\007\022\014\n\010e"
+  "Requeue\020\010\022\r\n\teSchedule\020\t\022\017\n\013eUnschedule\020"
+  "\n\022\022\n\016eResetSchedule\020\013\"*\n\014ReplicaStart\022\r\n"
+  "\005epoch\030\001 \001(\004\022\013\n\003lsn\030\002 \001(\004\"*\n\nQueueError\022"
+  "\r\n\005queue\030\001 \002(\t\022\r\n\005error\030\002 \001(\t\"\372\001\n\020QueueD"
+  "eclaration\022\014\n\004name\030\001 \002(\t\022)\n\004type\030\002 \002(\0162\033"
+  ".wire.QueueDeclaration.Type\022\025\n\rsync_repl"
+  "icas\030\003 \001(\r\022\013\n\003ttl\030\004 \001(\r\022\023\n\013ack_timeout\030\005"
+  " \001(\r\022\016\n\006weight\030\006 \001(\r\022\024\n\014durable_size\030\007 \001"
+  "(\004\022\030\n\020expiries_indexed\030\010 \001(\010\"4\n\004Type\022\016\n\n"
+  "eBroadcast\020\000\022\016\n\neTransient\020\001\022\014\n\010eDurable"
+  "\020\002\"8\n\020QueueReplication\022\r\n\005queue\030\001 \002(\t\022\025\n"
+  "\rsync_replicas\030\002 \002(\r\"O\n\014QueueOptions\022\r\n\005"
+  "queue\030\001 \002(\t\022\013\n\003ttl\030\002 \001(\r\022\023\n\013ack_timeout\030"
+  "\003 \001(\r\022\016\n\006weight\030\004 \001(\r\"<\n\022QueueConfigurat"
+  "ion\022&\n\006queues\030\001 \003(\0132\026.wire.QueueDeclarat"
+  "ion"
+  ;
+static ::_pbi::once_flag descriptor_table_wire_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_wire_2eproto = {
+    false, false, 2643, descriptor_table_protodef_wire_2eproto,
+    "wire.proto",
+    &descriptor_table_wire_2eproto_once, nullptr, 0, 21,
+    schemas, file_default_instances, TableStruct_wire_2eproto::offsets,
+    file_level_metadata_wire_2eproto, file_level_enum_descriptors_wire_2eproto,
+    file_level_service_descriptors_wire_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_wire_2eproto_getter() {
+  return &descriptor_table_wire_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_wire_2eproto(&descriptor_table_wire_2eproto);
+namespace wire {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ReplicaAction_Type_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_wire_2eproto);
+  return file_level_enum_descriptors_wire_2eproto[0];
 }
-
-void Message::InitAsDefaultInstance() {
+bool ReplicaAction_Type_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+  }
 }
 
-Message::Message(const Message& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ReplicaAction_Type ReplicaAction::eStart;
+constexpr ReplicaAction_Type ReplicaAction::eReserve;
+constexpr ReplicaAction_Type ReplicaAction::eEntry;
+constexpr ReplicaAction_Type ReplicaAction::eBatch;
+constexpr ReplicaAction_Type ReplicaAction::eAck;
+constexpr ReplicaAction_Type ReplicaAction::Type_MIN;
+constexpr ReplicaAction_Type ReplicaAction::Type_MAX;
+constexpr int ReplicaAction::Type_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ReplicaEntry_Type_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_wire_2eproto);
+  return file_level_enum_descriptors_wire_2eproto[1];
 }
-
-void Message::SharedCtor() {
-  _cached_size_ = 0;
-  destination_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  payload_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  id_ = GOOGLE_ULONGLONG(0);
-  flags_ = 0u;
-  confirm_id_ = GOOGLE_ULONGLONG(0);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+bool ReplicaEntry_Type_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+      return true;
+    default:
+      return false;
+  }
 }
 
-Message::~Message() {
-  SharedDtor();
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ReplicaEntry_Type ReplicaEntry::eDeclare;
+constexpr ReplicaEntry_Type ReplicaEntry::eBond;
+constexpr ReplicaEntry_Type ReplicaEntry::eAppend;
+constexpr ReplicaEntry_Type ReplicaEntry::eErase;
+constexpr ReplicaEntry_Type ReplicaEntry::eEnqueue;
+constexpr ReplicaEntry_Type ReplicaEntry::eDequeue;
+constexpr ReplicaEntry_Type ReplicaEntry::eReset;
+constexpr ReplicaEntry_Type ReplicaEntry::eSynced;
+constexpr ReplicaEntry_Type ReplicaEntry::eRequeue;
+constexpr ReplicaEntry_Type ReplicaEntry::eSchedule;
+constexpr ReplicaEntry_Type ReplicaEntry::eUnschedule;
+constexpr ReplicaEntry_Type ReplicaEntry::eResetSchedule;
+constexpr ReplicaEntry_Type ReplicaEntry::Type_MIN;
+constexpr ReplicaEntry_Type ReplicaEntry::Type_MAX;
+constexpr int ReplicaEntry::Type_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* QueueDeclaration_Type_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_wire_2eproto);
+  return file_level_enum_descriptors_wire_2eproto[2];
+}
+bool QueueDeclaration_Type_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
 }
 
-void Message::SharedDtor() {
-  if (destination_ != &::google::protobuf::internal::kEmptyString) {
-    delete destination_;
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr QueueDeclaration_Type QueueDeclaration::eBroadcast;
+constexpr QueueDeclaration_Type QueueDeclaration::eTransient;
+constexpr QueueDeclaration_Type QueueDeclaration::eDurable;
+constexpr QueueDeclaration_Type QueueDeclaration::Type_MIN;
+constexpr QueueDeclaration_Type QueueDeclaration::Type_MAX;
+constexpr int QueueDeclaration::Type_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class Message::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Message>()._impl_._has_bits_);
+  static void set_has_destination(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
-  if (payload_ != &::google::protobuf::internal::kEmptyString) {
-    delete payload_;
+  static void set_has_payload(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
   }
-  if (this != default_instance_) {
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
   }
-}
+  static void set_has_flags(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_confirm_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_ttl(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_expires(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_not_before(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_redeliveries(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
 
-void Message::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+Message::Message(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:wire.Message)
 }
-const ::google::protobuf::Descriptor* Message::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Message_descriptor_;
+Message::Message(const Message& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Message* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.destination_){}
+    , decltype(_impl_.payload_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.confirm_id_){}
+    , decltype(_impl_.flags_){}
+    , decltype(_impl_.ttl_){}
+    , decltype(_impl_.expires_){}
+    , decltype(_impl_.not_before_){}
+    , decltype(_impl_.redeliveries_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.destination_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.destination_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_destination()) {
+    _this->_impl_.destination_.Set(from._internal_destination(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.payload_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_payload()) {
+    _this->_impl_.payload_.Set(from._internal_payload(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.redeliveries_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.redeliveries_));
+  // @@protoc_insertion_point(copy_constructor:wire.Message)
+}
+
+inline void Message::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.destination_){}
+    , decltype(_impl_.payload_){}
+    , decltype(_impl_.id_){uint64_t{0u}}
+    , decltype(_impl_.confirm_id_){uint64_t{0u}}
+    , decltype(_impl_.flags_){0u}
+    , decltype(_impl_.ttl_){0u}
+    , decltype(_impl_.expires_){0}
+    , decltype(_impl_.not_before_){0}
+    , decltype(_impl_.redeliveries_){0u}
+  };
+  _impl_.destination_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.destination_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.payload_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-const Message& Message::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_wire_2eproto();
-  return *default_instance_;
+Message::~Message() {
+  // @@protoc_insertion_point(destructor:wire.Message)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-Message* Message::default_instance_ = NULL;
+inline void Message::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.destination_.Destroy();
+  _impl_.payload_.Destroy();
+}
 
-Message* Message::New() const {
-  return new Message;
+void Message::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
 void Message::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_destination()) {
-      if (destination_ != &::google::protobuf::internal::kEmptyString) {
-        destination_->clear();
-      }
-    }
-    if (has_payload()) {
-      if (payload_ != &::google::protobuf::internal::kEmptyString) {
-        payload_->clear();
-      }
-    }
-    id_ = GOOGLE_ULONGLONG(0);
-    flags_ = 0u;
-    confirm_id_ = GOOGLE_ULONGLONG(0);
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool Message::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required string destination = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_destination()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->destination().data(), this->destination().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_payload;
-        break;
-      }
+// @@protoc_insertion_point(message_clear_start:wire.Message)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.destination_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.payload_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x000000fcu) {
+    ::memset(&_impl_.id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.not_before_) -
+        reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.not_before_));
+  }
+  _impl_.redeliveries_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
 
+const char* Message::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string destination = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_destination();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "wire.Message.destination");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // required bytes payload = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_payload:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_payload()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_id;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_payload();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional uint64 id = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_id:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &id_)));
-          set_has_id();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(32)) goto parse_flags;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional uint32 flags = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_flags:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &flags_)));
-          set_has_flags();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(40)) goto parse_confirm_id;
-        break;
-      }
-
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_flags(&has_bits);
+          _impl_.flags_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional uint64 confirm_id = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_confirm_id:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &confirm_id_)));
-          set_has_confirm_id();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_confirm_id(&has_bits);
+          _impl_.confirm_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 ttl = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_ttl(&has_bits);
+          _impl_.ttl_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double expires = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_expires(&has_bits);
+          _impl_.expires_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double not_before = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_not_before(&has_bits);
+          _impl_.not_before_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 redeliveries = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_redeliveries(&has_bits);
+          _impl_.redeliveries_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void Message::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Message::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:wire.Message)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required string destination = 1;
-  if (has_destination()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->destination().data(), this->destination().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->destination(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_destination().data(), static_cast<int>(this->_internal_destination().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "wire.Message.destination");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_destination(), target);
   }
 
   // required bytes payload = 2;
-  if (has_payload()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      2, this->payload(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_payload(), target);
   }
 
   // optional uint64 id = 3;
-  if (has_id()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->id(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_id(), target);
   }
 
   // optional uint32 flags = 4;
-  if (has_flags()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->flags(), output);
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_flags(), target);
   }
 
   // optional uint64 confirm_id = 5;
-  if (has_confirm_id()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(5, this->confirm_id(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_confirm_id(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // optional uint32 ttl = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_ttl(), target);
   }
-}
 
-::google::protobuf::uint8* Message::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required string destination = 1;
-  if (has_destination()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->destination().data(), this->destination().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->destination(), target);
+  // optional double expires = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_expires(), target);
   }
 
-  // required bytes payload = 2;
-  if (has_payload()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        2, this->payload(), target);
+  // optional double not_before = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_not_before(), target);
   }
 
-  // optional uint64 id = 3;
-  if (has_id()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->id(), target);
+  // optional uint32 redeliveries = 9;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_redeliveries(), target);
   }
 
-  // optional uint32 flags = 4;
-  if (has_flags()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->flags(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:wire.Message)
+  return target;
+}
 
-  // optional uint64 confirm_id = 5;
-  if (has_confirm_id()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(5, this->confirm_id(), target);
+size_t Message::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:wire.Message)
+  size_t total_size = 0;
+
+  if (_internal_has_destination()) {
+    // required string destination = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_destination());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (_internal_has_payload()) {
+    // required bytes payload = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_payload());
   }
-  return target;
-}
 
-int Message::ByteSize() const {
-  int total_size = 0;
+  return total_size;
+}
+size_t Message::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:wire.Message)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
     // required string destination = 1;
-    if (has_destination()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->destination());
-    }
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_destination());
 
     // required bytes payload = 2;
-    if (has_payload()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->payload());
-    }
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_payload());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000fcu) {
     // optional uint64 id = 3;
-    if (has_id()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->id());
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_id());
+    }
+
+    // optional uint64 confirm_id = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_confirm_id());
     }
 
     // optional uint32 flags = 4;
-    if (has_flags()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->flags());
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_flags());
     }
 
-    // optional uint64 confirm_id = 5;
-    if (has_confirm_id()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->confirm_id());
+    // optional uint32 ttl = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_ttl());
+    }
+
+    // optional double expires = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double not_before = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 8;
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+  // optional uint32 redeliveries = 9;
+  if (cached_has_bits & 0x00000100u) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_redeliveries());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void Message::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Message* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Message*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Message::MergeFrom(const Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_destination()) {
-      set_destination(from.destination());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Message::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Message::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Message::GetClassData() const { return &_class_data_; }
+
+
+void Message::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Message*>(&to_msg);
+  auto& from = static_cast<const Message&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:wire.Message)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_destination(from._internal_destination());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_payload(from._internal_payload());
     }
-    if (from.has_payload()) {
-      set_payload(from.payload());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.id_ = from._impl_.id_;
     }
-    if (from.has_id()) {
-      set_id(from.id());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.confirm_id_ = from._impl_.confirm_id_;
     }
-    if (from.has_flags()) {
-      set_flags(from.flags());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.flags_ = from._impl_.flags_;
     }
-    if (from.has_confirm_id()) {
-      set_confirm_id(from.confirm_id());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.ttl_ = from._impl_.ttl_;
     }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.expires_ = from._impl_.expires_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.not_before_ = from._impl_.not_before_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void Message::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_redeliveries(from._internal_redeliveries());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Message::CopyFrom(const Message& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:wire.Message)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Message::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void Message::Swap(Message* other) {
-  if (other != this) {
-    std::swap(destination_, other->destination_);
-    std::swap(payload_, other->payload_);
-    std::swap(id_, other->id_);
-    std::swap(flags_, other->flags_);
-    std::swap(confirm_id_, other->confirm_id_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
-}
-
-::google::protobuf::Metadata Message::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Message_descriptor_;
-  metadata.reflection = Message_reflection_;
-  return metadata;
+void Message::InternalSwap(Message* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.destination_, lhs_arena,
+      &other->_impl_.destination_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.payload_, lhs_arena,
+      &other->_impl_.payload_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Message, _impl_.redeliveries_)
+      + sizeof(Message::_impl_.redeliveries_)
+      - PROTOBUF_FIELD_OFFSET(Message, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Message::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_wire_2eproto_getter, &descriptor_table_wire_2eproto_once,
+      file_level_metadata_wire_2eproto[0]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int Action::kTypeFieldNumber;
-const int Action::kPayloadFieldNumber;
-const int Action::kIdFieldNumber;
-#endif  // !_MSC_VER
-
-Action::Action()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class Action::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Action>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_payload(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000004) ^ 0x00000004) != 0;
+  }
+};
 
-void Action::InitAsDefaultInstance() {
+Action::Action(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:wire.Action)
 }
-
 Action::Action(const Action& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void Action::SharedCtor() {
-  _cached_size_ = 0;
-  type_ = 0;
-  payload_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  id_ = GOOGLE_ULONGLONG(0);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Action* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.payload_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.payload_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_payload()) {
+    _this->_impl_.payload_.Set(from._internal_payload(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.type_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.type_));
+  // @@protoc_insertion_point(copy_constructor:wire.Action)
+}
+
+inline void Action::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.payload_){}
+    , decltype(_impl_.id_){uint64_t{0u}}
+    , decltype(_impl_.type_){0}
+  };
+  _impl_.payload_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Action::~Action() {
+  // @@protoc_insertion_point(destructor:wire.Action)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Action::SharedDtor() {
-  if (payload_ != &::google::protobuf::internal::kEmptyString) {
-    delete payload_;
-  }
-  if (this != default_instance_) {
-  }
+inline void Action::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.payload_.Destroy();
 }
 
 void Action::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Action::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Action_descriptor_;
-}
-
-const Action& Action::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_wire_2eproto();
-  return *default_instance_;
-}
-
-Action* Action::default_instance_ = NULL;
-
-Action* Action::New() const {
-  return new Action;
+  _impl_._cached_size_.Set(size);
 }
 
 void Action::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    type_ = 0;
-    if (has_payload()) {
-      if (payload_ != &::google::protobuf::internal::kEmptyString) {
-        payload_->clear();
-      }
-    }
-    id_ = GOOGLE_ULONGLONG(0);
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool Action::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:wire.Action)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.payload_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.type_) -
+        reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.type_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Action::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required int32 type = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &type_)));
-          set_has_type();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_payload;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_type(&has_bits);
+          _impl_.type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional string payload = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_payload:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_payload()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->payload().data(), this->payload().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_id;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_payload();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "wire.Action.payload");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional uint64 id = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_id:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &id_)));
-          set_has_id();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void Action::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required int32 type = 1;
-  if (has_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->type(), output);
-  }
-
-  // optional string payload = 2;
-  if (has_payload()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->payload().data(), this->payload().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      2, this->payload(), output);
-  }
-
-  // optional uint64 id = 3;
-  if (has_id()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->id(), output);
-  }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
-
-::google::protobuf::uint8* Action::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Action::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:wire.Action)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required int32 type = 1;
-  if (has_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->type(), target);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_type(), target);
   }
 
   // optional string payload = 2;
-  if (has_payload()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->payload().data(), this->payload().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->payload(), target);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_payload().data(), static_cast<int>(this->_internal_payload().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "wire.Action.payload");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_payload(), target);
   }
 
   // optional uint64 id = 3;
-  if (has_id()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->id(), target);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_id(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:wire.Action)
   return target;
 }
 
-int Action::ByteSize() const {
-  int total_size = 0;
+size_t Action::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:wire.Action)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required int32 type = 1;
-    if (has_type()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->type());
-    }
+  // required int32 type = 1;
+  if (_internal_has_type()) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_type());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
     // optional string payload = 2;
-    if (has_payload()) {
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->payload());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_payload());
     }
 
     // optional uint64 id = 3;
-    if (has_id()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->id());
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_id());
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Action::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Action* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Action*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Action::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Action::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Action::GetClassData() const { return &_class_data_; }
+
+
+void Action::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Action*>(&to_msg);
+  auto& from = static_cast<const Action&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:wire.Action)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void Action::MergeFrom(const Action& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_type()) {
-      set_type(from.type());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_payload(from._internal_payload());
     }
-    if (from.has_payload()) {
-      set_payload(from.payload());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.id_ = from._impl_.id_;
     }
-    if (from.has_id()) {
-      set_id(from.id());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.type_ = from._impl_.type_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void Action::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Action::CopyFrom(const Action& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:wire.Action)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Action::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void Action::Swap(Action* other) {
-  if (other != this) {
-    std::swap(type_, other->type_);
-    std::swap(payload_, other->payload_);
-    std::swap(id_, other->id_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void Action::InternalSwap(Action* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.payload_, lhs_arena,
+      &other->_impl_.payload_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Action, _impl_.type_)
+      + sizeof(Action::_impl_.type_)
+      - PROTOBUF_FIELD_OFFSET(Action, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
 }
 
-::google::protobuf::Metadata Action::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Action_descriptor_;
-  metadata.reflection = Action_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata Action::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_wire_2eproto_getter, &descriptor_table_wire_2eproto_once,
+      file_level_metadata_wire_2eproto[1]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int BondRequest::kQueueFieldNumber;
-const int BondRequest::kDestinationFieldNumber;
-#endif  // !_MSC_VER
-
-BondRequest::BondRequest()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
-
-void BondRequest::InitAsDefaultInstance() {
+class ConfirmRange::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ConfirmRange>()._impl_._has_bits_);
+  static void set_has_first(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+ConfirmRange::ConfirmRange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:wire.ConfirmRange)
+}
+ConfirmRange::ConfirmRange(const ConfirmRange& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ConfirmRange* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.first_){}
+    , decltype(_impl_.count_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.first_, &from._impl_.first_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.count_) -
+    reinterpret_cast<char*>(&_impl_.first_)) + sizeof(_impl_.count_));
+  // @@protoc_insertion_point(copy_constructor:wire.ConfirmRange)
+}
+
+inline void ConfirmRange::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.first_){uint64_t{0u}}
+    , decltype(_impl_.count_){uint64_t{0u}}
+  };
 }
 
-BondRequest::BondRequest(const BondRequest& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+ConfirmRange::~ConfirmRange() {
+  // @@protoc_insertion_point(destructor:wire.ConfirmRange)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-void BondRequest::SharedCtor() {
-  _cached_size_ = 0;
-  queue_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  destination_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+inline void ConfirmRange::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ConfirmRange::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ConfirmRange::Clear() {
+// @@protoc_insertion_point(message_clear_start:wire.ConfirmRange)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.first_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.count_) -
+        reinterpret_cast<char*>(&_impl_.first_)) + sizeof(_impl_.count_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ConfirmRange::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 first = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_first(&has_bits);
+          _impl_.first_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_count(&has_bits);
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ConfirmRange::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:wire.ConfirmRange)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 first = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_first(), target);
+  }
+
+  // required uint64 count = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_count(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:wire.ConfirmRange)
+  return target;
 }
 
-BondRequest::~BondRequest() {
-  SharedDtor();
-}
+size_t ConfirmRange::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:wire.ConfirmRange)
+  size_t total_size = 0;
 
-void BondRequest::SharedDtor() {
-  if (queue_ != &::google::protobuf::internal::kEmptyString) {
-    delete queue_;
-  }
-  if (destination_ != &::google::protobuf::internal::kEmptyString) {
-    delete destination_;
+  if (_internal_has_first()) {
+    // required uint64 first = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_first());
   }
-  if (this != default_instance_) {
+
+  if (_internal_has_count()) {
+    // required uint64 count = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_count());
   }
-}
 
-void BondRequest::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* BondRequest::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return BondRequest_descriptor_;
+  return total_size;
 }
+size_t ConfirmRange::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:wire.ConfirmRange)
+  size_t total_size = 0;
 
-const BondRequest& BondRequest::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_wire_2eproto();
-  return *default_instance_;
-}
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 first = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_first());
 
-BondRequest* BondRequest::default_instance_ = NULL;
+    // required uint64 count = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_count());
 
-BondRequest* BondRequest::New() const {
-  return new BondRequest;
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void BondRequest::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_queue()) {
-      if (queue_ != &::google::protobuf::internal::kEmptyString) {
-        queue_->clear();
-      }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ConfirmRange::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ConfirmRange::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ConfirmRange::GetClassData() const { return &_class_data_; }
+
+
+void ConfirmRange::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ConfirmRange*>(&to_msg);
+  auto& from = static_cast<const ConfirmRange&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:wire.ConfirmRange)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.first_ = from._impl_.first_;
     }
-    if (has_destination()) {
-      if (destination_ != &::google::protobuf::internal::kEmptyString) {
-        destination_->clear();
-      }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.count_ = from._impl_.count_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-bool BondRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required string queue = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_queue()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->queue().data(), this->queue().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_destination;
-        break;
-      }
+void ConfirmRange::CopyFrom(const ConfirmRange& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:wire.ConfirmRange)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
-      // required string destination = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_destination:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_destination()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->destination().data(), this->destination().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
+bool ConfirmRange::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
-#undef DO_
 }
 
-void BondRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required string queue = 1;
-  if (has_queue()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->queue().data(), this->queue().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->queue(), output);
-  }
-
-  // required string destination = 2;
-  if (has_destination()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->destination().data(), this->destination().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      2, this->destination(), output);
-  }
+void ConfirmRange::InternalSwap(ConfirmRange* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ConfirmRange, _impl_.count_)
+      + sizeof(ConfirmRange::_impl_.count_)
+      - PROTOBUF_FIELD_OFFSET(ConfirmRange, _impl_.first_)>(
+          reinterpret_cast<char*>(&_impl_.first_),
+          reinterpret_cast<char*>(&other->_impl_.first_));
+}
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
+::PROTOBUF_NAMESPACE_ID::Metadata ConfirmRange::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_wire_2eproto_getter, &descriptor_table_wire_2eproto_once,
+      file_level_metadata_wire_2eproto[2]);
 }
 
-::google::protobuf::uint8* BondRequest::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required string queue = 1;
-  if (has_queue()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->queue().data(), this->queue().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->queue(), target);
-  }
+// ===================================================================
 
-  // required string destination = 2;
-  if (has_destination()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->destination().data(), this->destination().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->destination(), target);
-  }
+class Confirms::_Internal {
+ public:
+};
+
+Confirms::Confirms(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:wire.Confirms)
+}
+Confirms::Confirms(const Confirms& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Confirms* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ranges_){from._impl_.ranges_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:wire.Confirms)
+}
+
+inline void Confirms::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ranges_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+Confirms::~Confirms() {
+  // @@protoc_insertion_point(destructor:wire.Confirms)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
+
+inline void Confirms::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ranges_.~RepeatedPtrField();
+}
+
+void Confirms::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Confirms::Clear() {
+// @@protoc_insertion_point(message_clear_start:wire.Confirms)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ranges_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Confirms::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .wire.ConfirmRange ranges = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_ranges(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Confirms::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:wire.Confirms)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .wire.ConfirmRange ranges = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_ranges_size()); i < n; i++) {
+    const auto& repfield = this->_internal_ranges(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:wire.Confirms)
   return target;
 }
 
-int BondRequest::ByteSize() const {
-  int total_size = 0;
+size_t Confirms::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:wire.Confirms)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required string queue = 1;
-    if (has_queue()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->queue());
-    }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-    // required string destination = 2;
-    if (has_destination()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->destination());
-    }
-
-  }
-  if (!unknown_fields().empty()) {
+  // repeated .wire.ConfirmRange ranges = 1;
+  total_size += 1UL * this->_internal_ranges_size();
+  for (const auto& msg : this->_impl_.ranges_) {
     total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void BondRequest::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const BondRequest* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const BondRequest*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void BondRequest::MergeFrom(const BondRequest& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_queue()) {
-      set_queue(from.queue());
-    }
-    if (from.has_destination()) {
-      set_destination(from.destination());
-    }
-  }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Confirms::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Confirms::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Confirms::GetClassData() const { return &_class_data_; }
+
+
+void Confirms::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Confirms*>(&to_msg);
+  auto& from = static_cast<const Confirms&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:wire.Confirms)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.ranges_.MergeFrom(from._impl_.ranges_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void BondRequest::CopyFrom(const ::google::protobuf::Message& from) {
+void Confirms::CopyFrom(const Confirms& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:wire.Confirms)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void BondRequest::CopyFrom(const BondRequest& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+bool Confirms::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.ranges_))
+    return false;
+  return true;
 }
 
-bool BondRequest::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+void Confirms::InternalSwap(Confirms* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.ranges_.InternalSwap(&other->_impl_.ranges_);
+}
 
-  return true;
+::PROTOBUF_NAMESPACE_ID::Metadata Confirms::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_wire_2eproto_getter, &descriptor_table_wire_2eproto_once,
+      file_level_metadata_wire_2eproto[3]);
+}
+
+// ===================================================================
+
+class BondRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<BondRequest>()._impl_._has_bits_);
+  static void set_has_queue(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_destination(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+BondRequest::BondRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:wire.BondRequest)
+}
+BondRequest::BondRequest(const BondRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BondRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.queue_){}
+    , decltype(_impl_.destination_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.queue_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_queue()) {
+    _this->_impl_.queue_.Set(from._internal_queue(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.destination_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.destination_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_destination()) {
+    _this->_impl_.destination_.Set(from._internal_destination(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:wire.BondRequest)
+}
+
+inline void BondRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.queue_){}
+    , decltype(_impl_.destination_){}
+  };
+  _impl_.queue_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.destination_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.destination_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-void BondRequest::Swap(BondRequest* other) {
-  if (other != this) {
-    std::swap(queue_, other->queue_);
-    std::swap(destination_, other->destination_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
+BondRequest::~BondRequest() {
+  // @@protoc_insertion_point(destructor:wire.BondRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
 }
 
-::google::protobuf::Metadata BondRequest::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = BondRequest_descriptor_;
-  metadata.reflection = BondRequest_reflection_;
-  return metadata;
+inline void BondRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.queue_.Destroy();
+  _impl_.destination_.Destroy();
 }
 
+void BondRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
 
-// ===================================================================
+void BondRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:wire.BondRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.queue_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.destination_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BondRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string queue = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_queue();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "wire.BondRequest.queue");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required string destination = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_destination();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "wire.BondRequest.destination");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BondRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:wire.BondRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string queue = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_queue().data(), static_cast<int>(this->_internal_queue().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "wire.BondRequest.queue");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_queue(), target);
+  }
 
-#ifndef _MSC_VER
-const int ConnectionConfigure::kTapFieldNumber;
-const int ConnectionConfigure::kAckFieldNumber;
-const int ConnectionConfigure::kConfirmFieldNumber;
-const int ConnectionConfigure::kInflightFieldNumber;
-#endif  // !_MSC_VER
+  // required string destination = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_destination().data(), static_cast<int>(this->_internal_destination().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "wire.BondRequest.destination");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_destination(), target);
+  }
 
-ConnectionConfigure::ConnectionConfigure()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:wire.BondRequest)
+  return target;
 }
 
-void ConnectionConfigure::InitAsDefaultInstance() {
+size_t BondRequest::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:wire.BondRequest)
+  size_t total_size = 0;
+
+  if (_internal_has_queue()) {
+    // required string queue = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_queue());
+  }
+
+  if (_internal_has_destination()) {
+    // required string destination = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_destination());
+  }
+
+  return total_size;
 }
+size_t BondRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:wire.BondRequest)
+  size_t total_size = 0;
 
-ConnectionConfigure::ConnectionConfigure(const ConnectionConfigure& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string queue = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_queue());
+
+    // required string destination = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_destination());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BondRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BondRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BondRequest::GetClassData() const { return &_class_data_; }
+
+
+void BondRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BondRequest*>(&to_msg);
+  auto& from = static_cast<const BondRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:wire.BondRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_queue(from._internal_queue());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_destination(from._internal_destination());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BondRequest::CopyFrom(const BondRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:wire.BondRequest)
+  if (&from == this) return;
+  Clear();
   MergeFrom(from);
 }
 
-void ConnectionConfigure::SharedCtor() {
-  _cached_size_ = 0;
-  tap_ = false;
-  ack_ = false;
-  confirm_ = false;
-  inflight_ = 0u;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+bool BondRequest::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
 }
 
-ConnectionConfigure::~ConnectionConfigure() {
-  SharedDtor();
+void BondRequest::InternalSwap(BondRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.queue_, lhs_arena,
+      &other->_impl_.queue_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.destination_, lhs_arena,
+      &other->_impl_.destination_, rhs_arena
+  );
 }
 
-void ConnectionConfigure::SharedDtor() {
-  if (this != default_instance_) {
-  }
+::PROTOBUF_NAMESPACE_ID::Metadata BondRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_wire_2eproto_getter, &descriptor_table_wire_2eproto_once,
+      file_level_metadata_wire_2eproto[4]);
 }
 
-void ConnectionConfigure::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+// ===================================================================
+
+class ConnectionConfigure::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ConnectionConfigure>()._impl_._has_bits_);
+  static void set_has_tap(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_ack(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_confirm(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_inflight(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_write_high_water(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_write_low_water(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_batch_messages(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_batch_bytes(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_coalesce_confirms(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+ConnectionConfigure::ConnectionConfigure(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:wire.ConnectionConfigure)
 }
-const ::google::protobuf::Descriptor* ConnectionConfigure::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return ConnectionConfigure_descriptor_;
+ConnectionConfigure::ConnectionConfigure(const ConnectionConfigure& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ConnectionConfigure* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tap_){}
+    , decltype(_impl_.ack_){}
+    , decltype(_impl_.confirm_){}
+    , decltype(_impl_.coalesce_confirms_){}
+    , decltype(_impl_.inflight_){}
+    , decltype(_impl_.write_high_water_){}
+    , decltype(_impl_.write_low_water_){}
+    , decltype(_impl_.batch_messages_){}
+    , decltype(_impl_.batch_bytes_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.tap_, &from._impl_.tap_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.batch_bytes_) -
+    reinterpret_cast<char*>(&_impl_.tap_)) + sizeof(_impl_.batch_bytes_));
+  // @@protoc_insertion_point(copy_constructor:wire.ConnectionConfigure)
+}
+
+inline void ConnectionConfigure::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tap_){false}
+    , decltype(_impl_.ack_){false}
+    , decltype(_impl_.confirm_){false}
+    , decltype(_impl_.coalesce_confirms_){false}
+    , decltype(_impl_.inflight_){0u}
+    , decltype(_impl_.write_high_water_){0u}
+    , decltype(_impl_.write_low_water_){0u}
+    , decltype(_impl_.batch_messages_){0u}
+    , decltype(_impl_.batch_bytes_){0u}
+  };
 }
 
-const ConnectionConfigure& ConnectionConfigure::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_wire_2eproto();
-  return *default_instance_;
+ConnectionConfigure::~ConnectionConfigure() {
+  // @@protoc_insertion_point(destructor:wire.ConnectionConfigure)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-ConnectionConfigure* ConnectionConfigure::default_instance_ = NULL;
+inline void ConnectionConfigure::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
 
-ConnectionConfigure* ConnectionConfigure::New() const {
-  return new ConnectionConfigure;
+void ConnectionConfigure::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
 void ConnectionConfigure::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    tap_ = false;
-    ack_ = false;
-    confirm_ = false;
-    inflight_ = 0u;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool ConnectionConfigure::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:wire.ConnectionConfigure)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.tap_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.batch_messages_) -
+        reinterpret_cast<char*>(&_impl_.tap_)) + sizeof(_impl_.batch_messages_));
+  }
+  _impl_.batch_bytes_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ConnectionConfigure::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional bool tap = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &tap_)));
-          set_has_tap();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_ack;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_tap(&has_bits);
+          _impl_.tap_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional bool ack = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_ack:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &ack_)));
-          set_has_ack();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_confirm;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_ack(&has_bits);
+          _impl_.ack_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional bool confirm = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_confirm:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &confirm_)));
-          set_has_confirm();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(32)) goto parse_inflight;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_confirm(&has_bits);
+          _impl_.confirm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional uint32 inflight = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_inflight:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &inflight_)));
-          set_has_inflight();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_inflight(&has_bits);
+          _impl_.inflight_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 write_high_water = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_write_high_water(&has_bits);
+          _impl_.write_high_water_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 write_low_water = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_write_low_water(&has_bits);
+          _impl_.write_low_water_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 batch_messages = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_batch_messages(&has_bits);
+          _impl_.batch_messages_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 batch_bytes = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_batch_bytes(&has_bits);
+          _impl_.batch_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool coalesce_confirms = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_coalesce_confirms(&has_bits);
+          _impl_.coalesce_confirms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void ConnectionConfigure::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ConnectionConfigure::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:wire.ConnectionConfigure)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional bool tap = 1;
-  if (has_tap()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->tap(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_tap(), target);
   }
 
   // optional bool ack = 2;
-  if (has_ack()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(2, this->ack(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_ack(), target);
   }
 
   // optional bool confirm = 3;
-  if (has_confirm()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(3, this->confirm(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_confirm(), target);
   }
 
   // optional uint32 inflight = 4;
-  if (has_inflight()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->inflight(), output);
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_inflight(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // optional uint32 write_high_water = 5;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_write_high_water(), target);
   }
-}
 
-::google::protobuf::uint8* ConnectionConfigure::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional bool tap = 1;
-  if (has_tap()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->tap(), target);
+  // optional uint32 write_low_water = 6;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_write_low_water(), target);
   }
 
-  // optional bool ack = 2;
-  if (has_ack()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(2, this->ack(), target);
+  // optional uint32 batch_messages = 7;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_batch_messages(), target);
   }
 
-  // optional bool confirm = 3;
-  if (has_confirm()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(3, this->confirm(), target);
+  // optional uint32 batch_bytes = 8;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_batch_bytes(), target);
   }
 
-  // optional uint32 inflight = 4;
-  if (has_inflight()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->inflight(), target);
+  // optional bool coalesce_confirms = 9;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(9, this->_internal_coalesce_confirms(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:wire.ConnectionConfigure)
   return target;
 }
 
-int ConnectionConfigure::ByteSize() const {
-  int total_size = 0;
+size_t ConnectionConfigure::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:wire.ConnectionConfigure)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
     // optional bool tap = 1;
-    if (has_tap()) {
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 + 1;
     }
 
     // optional bool ack = 2;
-    if (has_ack()) {
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 + 1;
     }
 
     // optional bool confirm = 3;
-    if (has_confirm()) {
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool coalesce_confirms = 9;
+    if (cached_has_bits & 0x00000008u) {
       total_size += 1 + 1;
     }
 
     // optional uint32 inflight = 4;
-    if (has_inflight()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->inflight());
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_inflight());
+    }
+
+    // optional uint32 write_high_water = 5;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_write_high_water());
+    }
+
+    // optional uint32 write_low_water = 6;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_write_low_water());
+    }
+
+    // optional uint32 batch_messages = 7;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_batch_messages());
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+  // optional uint32 batch_bytes = 8;
+  if (cached_has_bits & 0x00000100u) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_batch_bytes());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void ConnectionConfigure::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const ConnectionConfigure* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const ConnectionConfigure*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ConnectionConfigure::MergeFrom(const ConnectionConfigure& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_tap()) {
-      set_tap(from.tap());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ConnectionConfigure::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ConnectionConfigure::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ConnectionConfigure::GetClassData() const { return &_class_data_; }
+
+
+void ConnectionConfigure::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ConnectionConfigure*>(&to_msg);
+  auto& from = static_cast<const ConnectionConfigure&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:wire.ConnectionConfigure)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.tap_ = from._impl_.tap_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.ack_ = from._impl_.ack_;
     }
-    if (from.has_ack()) {
-      set_ack(from.ack());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.confirm_ = from._impl_.confirm_;
     }
-    if (from.has_confirm()) {
-      set_confirm(from.confirm());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.coalesce_confirms_ = from._impl_.coalesce_confirms_;
     }
-    if (from.has_inflight()) {
-      set_inflight(from.inflight());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.inflight_ = from._impl_.inflight_;
     }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.write_high_water_ = from._impl_.write_high_water_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.write_low_water_ = from._impl_.write_low_water_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.batch_messages_ = from._impl_.batch_messages_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void ConnectionConfigure::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_batch_bytes(from._internal_batch_bytes());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ConnectionConfigure::CopyFrom(const ConnectionConfigure& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:wire.ConnectionConfigure)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool ConnectionConfigure::IsInitialized() const {
-
   return true;
 }
 
-void ConnectionConfigure::Swap(ConnectionConfigure* other) {
-  if (other != this) {
-    std::swap(tap_, other->tap_);
-    std::swap(ack_, other->ack_);
-    std::swap(confirm_, other->confirm_);
-    std::swap(inflight_, other->inflight_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void ConnectionConfigure::InternalSwap(ConnectionConfigure* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ConnectionConfigure, _impl_.batch_bytes_)
+      + sizeof(ConnectionConfigure::_impl_.batch_bytes_)
+      - PROTOBUF_FIELD_OFFSET(ConnectionConfigure, _impl_.tap_)>(
+          reinterpret_cast<char*>(&_impl_.tap_),
+          reinterpret_cast<char*>(&other->_impl_.tap_));
 }
 
-::google::protobuf::Metadata ConnectionConfigure::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = ConnectionConfigure_descriptor_;
-  metadata.reflection = ConnectionConfigure_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata ConnectionConfigure::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_wire_2eproto_getter, &descriptor_table_wire_2eproto_once,
+      file_level_metadata_wire_2eproto[5]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int MessageRange::kStartFieldNumber;
-const int MessageRange::kCountFieldNumber;
-#endif  // !_MSC_VER
-
-MessageRange::MessageRange()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+class MessageBatch::_Internal {
+ public:
+};
+
+MessageBatch::MessageBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:wire.MessageBatch)
+}
+MessageBatch::MessageBatch(const MessageBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MessageBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.messages_){from._impl_.messages_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:wire.MessageBatch)
+}
+
+inline void MessageBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.messages_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-void MessageRange::InitAsDefaultInstance() {
+MessageBatch::~MessageBatch() {
+  // @@protoc_insertion_point(destructor:wire.MessageBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-MessageRange::MessageRange(const MessageRange& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+inline void MessageBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.messages_.~RepeatedPtrField();
+}
+
+void MessageBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MessageBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:wire.MessageBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.messages_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MessageBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated bytes messages = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_messages();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MessageBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:wire.MessageBatch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated bytes messages = 1;
+  for (int i = 0, n = this->_internal_messages_size(); i < n; i++) {
+    const auto& s = this->_internal_messages(i);
+    target = stream->WriteBytes(1, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:wire.MessageBatch)
+  return target;
 }
 
-void MessageRange::SharedCtor() {
-  _cached_size_ = 0;
-  start_ = 0;
-  count_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-}
+size_t MessageBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:wire.MessageBatch)
+  size_t total_size = 0;
 
-MessageRange::~MessageRange() {
-  SharedDtor();
-}
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-void MessageRange::SharedDtor() {
-  if (this != default_instance_) {
+  // repeated bytes messages = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.messages_.size());
+  for (int i = 0, n = _impl_.messages_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.messages_.Get(i));
   }
-}
 
-void MessageRange::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
-const ::google::protobuf::Descriptor* MessageRange::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return MessageRange_descriptor_;
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MessageBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MessageBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MessageBatch::GetClassData() const { return &_class_data_; }
+
+
+void MessageBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MessageBatch*>(&to_msg);
+  auto& from = static_cast<const MessageBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:wire.MessageBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.messages_.MergeFrom(from._impl_.messages_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-const MessageRange& MessageRange::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_wire_2eproto();
-  return *default_instance_;
+void MessageBatch::CopyFrom(const MessageBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:wire.MessageBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
 
-MessageRange* MessageRange::default_instance_ = NULL;
+bool MessageBatch::IsInitialized() const {
+  return true;
+}
 
-MessageRange* MessageRange::New() const {
-  return new MessageRange;
+void MessageBatch::InternalSwap(MessageBatch* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.messages_.InternalSwap(&other->_impl_.messages_);
 }
 
-void MessageRange::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    start_ = 0;
-    count_ = 0;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool MessageRange::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required int32 start = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &start_)));
-          set_has_start();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_count;
-        break;
-      }
-
-      // required int32 count = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_count:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &count_)));
-          set_has_count();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
+::PROTOBUF_NAMESPACE_ID::Metadata MessageBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_wire_2eproto_getter, &descriptor_table_wire_2eproto_once,
+      file_level_metadata_wire_2eproto[6]);
 }
 
-void MessageRange::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required int32 start = 1;
-  if (has_start()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->start(), output);
-  }
+// ===================================================================
 
-  // required int32 count = 2;
-  if (has_count()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->count(), output);
+class MessageRange::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MessageRange>()._impl_._has_bits_);
+  static void set_has_start(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  static void set_has_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
   }
-}
-
-::google::protobuf::uint8* MessageRange::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required int32 start = 1;
-  if (has_start()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->start(), target);
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
   }
+};
 
-  // required int32 count = 2;
-  if (has_count()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->count(), target);
-  }
+MessageRange::MessageRange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:wire.MessageRange)
+}
+MessageRange::MessageRange(const MessageRange& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MessageRange* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.start_){}
+    , decltype(_impl_.count_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.start_, &from._impl_.start_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.count_) -
+    reinterpret_cast<char*>(&_impl_.start_)) + sizeof(_impl_.count_));
+  // @@protoc_insertion_point(copy_constructor:wire.MessageRange)
+}
+
+inline void MessageRange::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.start_){uint64_t{0u}}
+    , decltype(_impl_.count_){uint64_t{0u}}
+  };
+}
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+MessageRange::~MessageRange() {
+  // @@protoc_insertion_point(destructor:wire.MessageRange)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  return target;
+  SharedDtor();
 }
 
-int MessageRange::ByteSize() const {
-  int total_size = 0;
+inline void MessageRange::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required int32 start = 1;
-    if (has_start()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->start());
-    }
+void MessageRange::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
 
-    // required int32 count = 2;
-    if (has_count()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->count());
+void MessageRange::Clear() {
+// @@protoc_insertion_point(message_clear_start:wire.MessageRange)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.start_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.count_) -
+        reinterpret_cast<char*>(&_impl_.start_)) + sizeof(_impl_.count_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MessageRange::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 start = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_start(&has_bits);
+          _impl_.start_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_count(&has_bits);
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MessageRange::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:wire.MessageRange)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 start = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_start(), target);
+  }
+
+  // required uint64 count = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_count(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:wire.MessageRange)
+  return target;
+}
+
+size_t MessageRange::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:wire.MessageRange)
+  size_t total_size = 0;
 
+  if (_internal_has_start()) {
+    // required uint64 start = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_start());
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+
+  if (_internal_has_count()) {
+    // required uint64 count = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_count());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+
   return total_size;
 }
+size_t MessageRange::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:wire.MessageRange)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 start = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_start());
+
+    // required uint64 count = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_count());
 
-void MessageRange::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const MessageRange* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const MessageRange*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void MessageRange::MergeFrom(const MessageRange& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_start()) {
-      set_start(from.start());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MessageRange::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MessageRange::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MessageRange::GetClassData() const { return &_class_data_; }
+
+
+void MessageRange::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MessageRange*>(&to_msg);
+  auto& from = static_cast<const MessageRange&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:wire.MessageRange)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.start_ = from._impl_.start_;
     }
-    if (from.has_count()) {
-      set_count(from.count());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.count_ = from._impl_.count_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void MessageRange::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void MessageRange::CopyFrom(const MessageRange& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:wire.MessageRange)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool MessageRange::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void MessageRange::Swap(MessageRange* other) {
-  if (other != this) {
-    std::swap(start_, other->start_);
-    std::swap(count_, other->count_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void MessageRange::InternalSwap(MessageRange* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MessageRange, _impl_.count_)
+      + sizeof(MessageRange::_impl_.count_)
+      - PROTOBUF_FIELD_OFFSET(MessageRange, _impl_.start_)>(
+          reinterpret_cast<char*>(&_impl_.start_),
+          reinterpret_cast<char*>(&other->_impl_.start_));
 }
 
-::google::protobuf::Metadata MessageRange::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MessageRange_descriptor_;
-  metadata.reflection = MessageRange_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata MessageRange::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_wire_2eproto_getter, &descriptor_table_wire_2eproto_once,
+      file_level_metadata_wire_2eproto[7]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int Queue::kSizeFieldNumber;
-const int Queue::kRangesFieldNumber;
-#endif  // !_MSC_VER
-
-Queue::Queue()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class Queue::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Queue>()._impl_._has_bits_);
+  static void set_has_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_next_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000002) ^ 0x00000002) != 0;
+  }
+};
 
-void Queue::InitAsDefaultInstance() {
+Queue::Queue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:wire.Queue)
 }
-
 Queue::Queue(const Queue& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void Queue::SharedCtor() {
-  _cached_size_ = 0;
-  size_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Queue* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ranges_){from._impl_.ranges_}
+    , decltype(_impl_.next_index_){}
+    , decltype(_impl_.size_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.next_index_, &from._impl_.next_index_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.size_) -
+    reinterpret_cast<char*>(&_impl_.next_index_)) + sizeof(_impl_.size_));
+  // @@protoc_insertion_point(copy_constructor:wire.Queue)
+}
+
+inline void Queue::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ranges_){arena}
+    , decltype(_impl_.next_index_){uint64_t{0u}}
+    , decltype(_impl_.size_){0}
+  };
 }
 
 Queue::~Queue() {
+  // @@protoc_insertion_point(destructor:wire.Queue)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Queue::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void Queue::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ranges_.~RepeatedPtrField();
 }
 
 void Queue::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Queue::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Queue_descriptor_;
-}
-
-const Queue& Queue::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_wire_2eproto();
-  return *default_instance_;
-}
-
-Queue* Queue::default_instance_ = NULL;
-
-Queue* Queue::New() const {
-  return new Queue;
+  _impl_._cached_size_.Set(size);
 }
 
 void Queue::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    size_ = 0;
-  }
-  ranges_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool Queue::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:wire.Queue)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ranges_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.next_index_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.size_) -
+        reinterpret_cast<char*>(&_impl_.next_index_)) + sizeof(_impl_.size_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Queue::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required int32 size = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &size_)));
-          set_has_size();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_ranges;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_size(&has_bits);
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // repeated .wire.MessageRange ranges = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_ranges:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_ranges()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_ranges;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_ranges(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 next_index = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_next_index(&has_bits);
+          _impl_.next_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void Queue::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Queue::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:wire.Queue)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required int32 size = 1;
-  if (has_size()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->size(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_size(), target);
   }
 
   // repeated .wire.MessageRange ranges = 2;
-  for (int i = 0; i < this->ranges_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->ranges(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_ranges_size()); i < n; i++) {
+    const auto& repfield = this->_internal_ranges(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional uint64 next_index = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_next_index(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:wire.Queue)
+  return target;
 }
 
-::google::protobuf::uint8* Queue::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+size_t Queue::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:wire.Queue)
+  size_t total_size = 0;
+
   // required int32 size = 1;
-  if (has_size()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->size(), target);
+  if (_internal_has_size()) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_size());
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated .wire.MessageRange ranges = 2;
-  for (int i = 0; i < this->ranges_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->ranges(i), target);
+  total_size += 1UL * this->_internal_ranges_size();
+  for (const auto& msg : this->_impl_.ranges_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  // optional uint64 next_index = 3;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_next_index());
   }
-  return target;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-int Queue::ByteSize() const {
-  int total_size = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Queue::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Queue::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Queue::GetClassData() const { return &_class_data_; }
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required int32 size = 1;
-    if (has_size()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->size());
-    }
 
-  }
-  // repeated .wire.MessageRange ranges = 2;
-  total_size += 1 * this->ranges_size();
-  for (int i = 0; i < this->ranges_size(); i++) {
+void Queue::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Queue*>(&to_msg);
+  auto& from = static_cast<const Queue&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:wire.Queue)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.ranges_.MergeFrom(from._impl_.ranges_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.next_index_ = from._impl_.next_index_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.size_ = from._impl_.size_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Queue::CopyFrom(const Queue& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:wire.Queue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Queue::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.ranges_))
+    return false;
+  return true;
+}
+
+void Queue::InternalSwap(Queue* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.ranges_.InternalSwap(&other->_impl_.ranges_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Queue, _impl_.size_)
+      + sizeof(Queue::_impl_.size_)
+      - PROTOBUF_FIELD_OFFSET(Queue, _impl_.next_index_)>(
+          reinterpret_cast<char*>(&_impl_.next_index_),
+          reinterpret_cast<char*>(&other->_impl_.next_index_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Queue::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_wire_2eproto_getter, &descriptor_table_wire_2eproto_once,
+      file_level_metadata_wire_2eproto[8]);
+}
+
+// ===================================================================
+
+class Stat::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Stat>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_exists(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_transient_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_durable_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_enqueued(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_dequeued(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_acked(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_redelivered(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_bytes_in(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_bytes_out(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_enqueue_rate(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_dequeue_rate(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_ack_rate(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_redelivery_rate(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_subscribers(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_inflight(HasBits* has_bits) {
+    (*has_bits)[0] |= 131072u;
+  }
+  static void set_has_oldest_age(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static void set_has_write_backlog(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+  static void set_has_memory_bytes(HasBits* has_bits) {
+    (*has_bits)[0] |= 524288u;
+  }
+  static void set_has_spilled_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 262144u;
+  }
+  static void set_has_expired(HasBits* has_bits) {
+    (*has_bits)[0] |= 1048576u;
+  }
+  static void set_has_scheduled_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 2097152u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+Stat::Stat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:wire.Stat)
+}
+Stat::Stat(const Stat& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Stat* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.exists_){}
+    , decltype(_impl_.transient_size_){}
+    , decltype(_impl_.enqueued_){}
+    , decltype(_impl_.dequeued_){}
+    , decltype(_impl_.acked_){}
+    , decltype(_impl_.redelivered_){}
+    , decltype(_impl_.bytes_in_){}
+    , decltype(_impl_.durable_size_){}
+    , decltype(_impl_.subscribers_){}
+    , decltype(_impl_.bytes_out_){}
+    , decltype(_impl_.enqueue_rate_){}
+    , decltype(_impl_.dequeue_rate_){}
+    , decltype(_impl_.ack_rate_){}
+    , decltype(_impl_.redelivery_rate_){}
+    , decltype(_impl_.oldest_age_){}
+    , decltype(_impl_.write_backlog_){}
+    , decltype(_impl_.inflight_){}
+    , decltype(_impl_.spilled_size_){}
+    , decltype(_impl_.memory_bytes_){}
+    , decltype(_impl_.expired_){}
+    , decltype(_impl_.scheduled_size_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.exists_, &from._impl_.exists_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.scheduled_size_) -
+    reinterpret_cast<char*>(&_impl_.exists_)) + sizeof(_impl_.scheduled_size_));
+  // @@protoc_insertion_point(copy_constructor:wire.Stat)
+}
+
+inline void Stat::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.exists_){false}
+    , decltype(_impl_.transient_size_){0u}
+    , decltype(_impl_.enqueued_){uint64_t{0u}}
+    , decltype(_impl_.dequeued_){uint64_t{0u}}
+    , decltype(_impl_.acked_){uint64_t{0u}}
+    , decltype(_impl_.redelivered_){uint64_t{0u}}
+    , decltype(_impl_.bytes_in_){uint64_t{0u}}
+    , decltype(_impl_.durable_size_){0u}
+    , decltype(_impl_.subscribers_){0u}
+    , decltype(_impl_.bytes_out_){uint64_t{0u}}
+    , decltype(_impl_.enqueue_rate_){0}
+    , decltype(_impl_.dequeue_rate_){0}
+    , decltype(_impl_.ack_rate_){0}
+    , decltype(_impl_.redelivery_rate_){0}
+    , decltype(_impl_.oldest_age_){0}
+    , decltype(_impl_.write_backlog_){uint64_t{0u}}
+    , decltype(_impl_.inflight_){0u}
+    , decltype(_impl_.spilled_size_){0u}
+    , decltype(_impl_.memory_bytes_){uint64_t{0u}}
+    , decltype(_impl_.expired_){uint64_t{0u}}
+    , decltype(_impl_.scheduled_size_){0u}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Stat::~Stat() {
+  // @@protoc_insertion_point(destructor:wire.Stat)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Stat::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+}
+
+void Stat::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Stat::Clear() {
+// @@protoc_insertion_point(message_clear_start:wire.Stat)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x000000feu) {
+    ::memset(&_impl_.exists_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.bytes_in_) -
+        reinterpret_cast<char*>(&_impl_.exists_)) + sizeof(_impl_.bytes_in_));
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    ::memset(&_impl_.durable_size_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.oldest_age_) -
+        reinterpret_cast<char*>(&_impl_.durable_size_)) + sizeof(_impl_.oldest_age_));
+  }
+  if (cached_has_bits & 0x003f0000u) {
+    ::memset(&_impl_.write_backlog_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.scheduled_size_) -
+        reinterpret_cast<char*>(&_impl_.write_backlog_)) + sizeof(_impl_.scheduled_size_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Stat::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "wire.Stat.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool exists = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_exists(&has_bits);
+          _impl_.exists_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 transient_size = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_transient_size(&has_bits);
+          _impl_.transient_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 durable_size = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_durable_size(&has_bits);
+          _impl_.durable_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 enqueued = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_enqueued(&has_bits);
+          _impl_.enqueued_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 dequeued = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_dequeued(&has_bits);
+          _impl_.dequeued_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 acked = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_acked(&has_bits);
+          _impl_.acked_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 redelivered = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_redelivered(&has_bits);
+          _impl_.redelivered_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 bytes_in = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_bytes_in(&has_bits);
+          _impl_.bytes_in_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 bytes_out = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_bytes_out(&has_bits);
+          _impl_.bytes_out_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double enqueue_rate = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 89)) {
+          _Internal::set_has_enqueue_rate(&has_bits);
+          _impl_.enqueue_rate_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double dequeue_rate = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 97)) {
+          _Internal::set_has_dequeue_rate(&has_bits);
+          _impl_.dequeue_rate_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double ack_rate = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 105)) {
+          _Internal::set_has_ack_rate(&has_bits);
+          _impl_.ack_rate_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double redelivery_rate = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 113)) {
+          _Internal::set_has_redelivery_rate(&has_bits);
+          _impl_.redelivery_rate_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 subscribers = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _Internal::set_has_subscribers(&has_bits);
+          _impl_.subscribers_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 inflight = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 128)) {
+          _Internal::set_has_inflight(&has_bits);
+          _impl_.inflight_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double oldest_age = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 137)) {
+          _Internal::set_has_oldest_age(&has_bits);
+          _impl_.oldest_age_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 write_backlog = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 144)) {
+          _Internal::set_has_write_backlog(&has_bits);
+          _impl_.write_backlog_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 memory_bytes = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 152)) {
+          _Internal::set_has_memory_bytes(&has_bits);
+          _impl_.memory_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 spilled_size = 20;
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 160)) {
+          _Internal::set_has_spilled_size(&has_bits);
+          _impl_.spilled_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 expired = 21;
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 168)) {
+          _Internal::set_has_expired(&has_bits);
+          _impl_.expired_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 scheduled_size = 22;
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 176)) {
+          _Internal::set_has_scheduled_size(&has_bits);
+          _impl_.scheduled_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Stat::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:wire.Stat)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "wire.Stat.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // required bool exists = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_exists(), target);
+  }
+
+  // optional uint32 transient_size = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_transient_size(), target);
+  }
+
+  // optional uint32 durable_size = 4;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_durable_size(), target);
+  }
+
+  // optional uint64 enqueued = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_enqueued(), target);
+  }
+
+  // optional uint64 dequeued = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_dequeued(), target);
+  }
+
+  // optional uint64 acked = 7;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_acked(), target);
+  }
+
+  // optional uint64 redelivered = 8;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_redelivered(), target);
+  }
+
+  // optional uint64 bytes_in = 9;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_bytes_in(), target);
+  }
+
+  // optional uint64 bytes_out = 10;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(10, this->_internal_bytes_out(), target);
+  }
+
+  // optional double enqueue_rate = 11;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(11, this->_internal_enqueue_rate(), target);
+  }
+
+  // optional double dequeue_rate = 12;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(12, this->_internal_dequeue_rate(), target);
+  }
+
+  // optional double ack_rate = 13;
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(13, this->_internal_ack_rate(), target);
+  }
+
+  // optional double redelivery_rate = 14;
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(14, this->_internal_redelivery_rate(), target);
+  }
+
+  // optional uint32 subscribers = 15;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(15, this->_internal_subscribers(), target);
+  }
+
+  // optional uint32 inflight = 16;
+  if (cached_has_bits & 0x00020000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(16, this->_internal_inflight(), target);
+  }
+
+  // optional double oldest_age = 17;
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(17, this->_internal_oldest_age(), target);
+  }
+
+  // optional uint64 write_backlog = 18;
+  if (cached_has_bits & 0x00010000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(18, this->_internal_write_backlog(), target);
+  }
+
+  // optional uint64 memory_bytes = 19;
+  if (cached_has_bits & 0x00080000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(19, this->_internal_memory_bytes(), target);
+  }
+
+  // optional uint32 spilled_size = 20;
+  if (cached_has_bits & 0x00040000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(20, this->_internal_spilled_size(), target);
+  }
+
+  // optional uint64 expired = 21;
+  if (cached_has_bits & 0x00100000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(21, this->_internal_expired(), target);
+  }
+
+  // optional uint32 scheduled_size = 22;
+  if (cached_has_bits & 0x00200000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(22, this->_internal_scheduled_size(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:wire.Stat)
+  return target;
+}
+
+size_t Stat::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:wire.Stat)
+  size_t total_size = 0;
+
+  if (_internal_has_name()) {
+    // required string name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  if (_internal_has_exists()) {
+    // required bool exists = 2;
+    total_size += 1 + 1;
+  }
+
+  return total_size;
+}
+size_t Stat::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:wire.Stat)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+
+    // required bool exists = 2;
+    total_size += 1 + 1;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000fcu) {
+    // optional uint32 transient_size = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_transient_size());
+    }
+
+    // optional uint64 enqueued = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_enqueued());
+    }
+
+    // optional uint64 dequeued = 6;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_dequeued());
+    }
+
+    // optional uint64 acked = 7;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_acked());
+    }
+
+    // optional uint64 redelivered = 8;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_redelivered());
+    }
+
+    // optional uint64 bytes_in = 9;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_bytes_in());
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional uint32 durable_size = 4;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_durable_size());
+    }
+
+    // optional uint32 subscribers = 15;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_subscribers());
+    }
+
+    // optional uint64 bytes_out = 10;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_bytes_out());
+    }
+
+    // optional double enqueue_rate = 11;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double dequeue_rate = 12;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double ack_rate = 13;
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double redelivery_rate = 14;
+    if (cached_has_bits & 0x00004000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double oldest_age = 17;
+    if (cached_has_bits & 0x00008000u) {
+      total_size += 2 + 8;
+    }
+
+  }
+  if (cached_has_bits & 0x003f0000u) {
+    // optional uint64 write_backlog = 18;
+    if (cached_has_bits & 0x00010000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt64Size(
+          this->_internal_write_backlog());
+    }
+
+    // optional uint32 inflight = 16;
+    if (cached_has_bits & 0x00020000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt32Size(
+          this->_internal_inflight());
+    }
+
+    // optional uint32 spilled_size = 20;
+    if (cached_has_bits & 0x00040000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt32Size(
+          this->_internal_spilled_size());
+    }
+
+    // optional uint64 memory_bytes = 19;
+    if (cached_has_bits & 0x00080000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt64Size(
+          this->_internal_memory_bytes());
+    }
+
+    // optional uint64 expired = 21;
+    if (cached_has_bits & 0x00100000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt64Size(
+          this->_internal_expired());
+    }
+
+    // optional uint32 scheduled_size = 22;
+    if (cached_has_bits & 0x00200000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt32Size(
+          this->_internal_scheduled_size());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Stat::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Stat::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Stat::GetClassData() const { return &_class_data_; }
+
+
+void Stat::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Stat*>(&to_msg);
+  auto& from = static_cast<const Stat&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:wire.Stat)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.exists_ = from._impl_.exists_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.transient_size_ = from._impl_.transient_size_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.enqueued_ = from._impl_.enqueued_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.dequeued_ = from._impl_.dequeued_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.acked_ = from._impl_.acked_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.redelivered_ = from._impl_.redelivered_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.bytes_in_ = from._impl_.bytes_in_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.durable_size_ = from._impl_.durable_size_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.subscribers_ = from._impl_.subscribers_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.bytes_out_ = from._impl_.bytes_out_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.enqueue_rate_ = from._impl_.enqueue_rate_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.dequeue_rate_ = from._impl_.dequeue_rate_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.ack_rate_ = from._impl_.ack_rate_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.redelivery_rate_ = from._impl_.redelivery_rate_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.oldest_age_ = from._impl_.oldest_age_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x003f0000u) {
+    if (cached_has_bits & 0x00010000u) {
+      _this->_impl_.write_backlog_ = from._impl_.write_backlog_;
+    }
+    if (cached_has_bits & 0x00020000u) {
+      _this->_impl_.inflight_ = from._impl_.inflight_;
+    }
+    if (cached_has_bits & 0x00040000u) {
+      _this->_impl_.spilled_size_ = from._impl_.spilled_size_;
+    }
+    if (cached_has_bits & 0x00080000u) {
+      _this->_impl_.memory_bytes_ = from._impl_.memory_bytes_;
+    }
+    if (cached_has_bits & 0x00100000u) {
+      _this->_impl_.expired_ = from._impl_.expired_;
+    }
+    if (cached_has_bits & 0x00200000u) {
+      _this->_impl_.scheduled_size_ = from._impl_.scheduled_size_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Stat::CopyFrom(const Stat& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:wire.Stat)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Stat::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void Stat::InternalSwap(Stat* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Stat, _impl_.scheduled_size_)
+      + sizeof(Stat::_impl_.scheduled_size_)
+      - PROTOBUF_FIELD_OFFSET(Stat, _impl_.exists_)>(
+          reinterpret_cast<char*>(&_impl_.exists_),
+          reinterpret_cast<char*>(&other->_impl_.exists_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Stat::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_wire_2eproto_getter, &descriptor_table_wire_2eproto_once,
+      file_level_metadata_wire_2eproto[9]);
+}
+
+// ===================================================================
+
+class ConnectionStat::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ConnectionStat>()._impl_._has_bits_);
+  static void set_has_fd(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_subscriptions(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_inflight(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_inflight_max(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_write_backlog(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_ack(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_tap(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_replica(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+ConnectionStat::ConnectionStat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:wire.ConnectionStat)
+}
+ConnectionStat::ConnectionStat(const ConnectionStat& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ConnectionStat* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.fd_){}
+    , decltype(_impl_.subscriptions_){}
+    , decltype(_impl_.inflight_){}
+    , decltype(_impl_.inflight_max_){}
+    , decltype(_impl_.write_backlog_){}
+    , decltype(_impl_.ack_){}
+    , decltype(_impl_.tap_){}
+    , decltype(_impl_.replica_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.fd_, &from._impl_.fd_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replica_) -
+    reinterpret_cast<char*>(&_impl_.fd_)) + sizeof(_impl_.replica_));
+  // @@protoc_insertion_point(copy_constructor:wire.ConnectionStat)
+}
+
+inline void ConnectionStat::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.fd_){0}
+    , decltype(_impl_.subscriptions_){0u}
+    , decltype(_impl_.inflight_){0u}
+    , decltype(_impl_.inflight_max_){0u}
+    , decltype(_impl_.write_backlog_){uint64_t{0u}}
+    , decltype(_impl_.ack_){false}
+    , decltype(_impl_.tap_){false}
+    , decltype(_impl_.replica_){false}
+  };
+}
+
+ConnectionStat::~ConnectionStat() {
+  // @@protoc_insertion_point(destructor:wire.ConnectionStat)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ConnectionStat::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ConnectionStat::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ConnectionStat::Clear() {
+// @@protoc_insertion_point(message_clear_start:wire.ConnectionStat)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.fd_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.replica_) -
+        reinterpret_cast<char*>(&_impl_.fd_)) + sizeof(_impl_.replica_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ConnectionStat::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required int32 fd = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_fd(&has_bits);
+          _impl_.fd_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 subscriptions = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_subscriptions(&has_bits);
+          _impl_.subscriptions_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 inflight = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_inflight(&has_bits);
+          _impl_.inflight_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 inflight_max = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_inflight_max(&has_bits);
+          _impl_.inflight_max_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 write_backlog = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_write_backlog(&has_bits);
+          _impl_.write_backlog_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool ack = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_ack(&has_bits);
+          _impl_.ack_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool tap = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_tap(&has_bits);
+          _impl_.tap_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool replica = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_replica(&has_bits);
+          _impl_.replica_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ConnectionStat::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:wire.ConnectionStat)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required int32 fd = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_fd(), target);
+  }
+
+  // optional uint32 subscriptions = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_subscriptions(), target);
+  }
+
+  // optional uint32 inflight = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_inflight(), target);
+  }
+
+  // optional uint32 inflight_max = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_inflight_max(), target);
+  }
+
+  // optional uint64 write_backlog = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_write_backlog(), target);
+  }
+
+  // optional bool ack = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_ack(), target);
+  }
+
+  // optional bool tap = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_tap(), target);
+  }
+
+  // optional bool replica = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_replica(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:wire.ConnectionStat)
+  return target;
+}
+
+size_t ConnectionStat::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:wire.ConnectionStat)
+  size_t total_size = 0;
+
+  // required int32 fd = 1;
+  if (_internal_has_fd()) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_fd());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000feu) {
+    // optional uint32 subscriptions = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_subscriptions());
+    }
+
+    // optional uint32 inflight = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_inflight());
+    }
+
+    // optional uint32 inflight_max = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_inflight_max());
+    }
+
+    // optional uint64 write_backlog = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_write_backlog());
+    }
+
+    // optional bool ack = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool tap = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool replica = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ConnectionStat::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ConnectionStat::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ConnectionStat::GetClassData() const { return &_class_data_; }
+
+
+void ConnectionStat::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ConnectionStat*>(&to_msg);
+  auto& from = static_cast<const ConnectionStat&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:wire.ConnectionStat)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.fd_ = from._impl_.fd_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.subscriptions_ = from._impl_.subscriptions_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.inflight_ = from._impl_.inflight_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.inflight_max_ = from._impl_.inflight_max_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.write_backlog_ = from._impl_.write_backlog_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.ack_ = from._impl_.ack_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.tap_ = from._impl_.tap_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.replica_ = from._impl_.replica_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ConnectionStat::CopyFrom(const ConnectionStat& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:wire.ConnectionStat)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ConnectionStat::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ConnectionStat::InternalSwap(ConnectionStat* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ConnectionStat, _impl_.replica_)
+      + sizeof(ConnectionStat::_impl_.replica_)
+      - PROTOBUF_FIELD_OFFSET(ConnectionStat, _impl_.fd_)>(
+          reinterpret_cast<char*>(&_impl_.fd_),
+          reinterpret_cast<char*>(&other->_impl_.fd_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ConnectionStat::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_wire_2eproto_getter, &descriptor_table_wire_2eproto_once,
+      file_level_metadata_wire_2eproto[10]);
+}
+
+// ===================================================================
+
+class StatDump::_Internal {
+ public:
+};
+
+StatDump::StatDump(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:wire.StatDump)
+}
+StatDump::StatDump(const StatDump& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StatDump* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.queues_){from._impl_.queues_}
+    , decltype(_impl_.connections_){from._impl_.connections_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:wire.StatDump)
+}
+
+inline void StatDump::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.queues_){arena}
+    , decltype(_impl_.connections_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+StatDump::~StatDump() {
+  // @@protoc_insertion_point(destructor:wire.StatDump)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StatDump::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.queues_.~RepeatedPtrField();
+  _impl_.connections_.~RepeatedPtrField();
+}
+
+void StatDump::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StatDump::Clear() {
+// @@protoc_insertion_point(message_clear_start:wire.StatDump)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.queues_.Clear();
+  _impl_.connections_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StatDump::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .wire.Stat queues = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_queues(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .wire.ConnectionStat connections = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_connections(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StatDump::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:wire.StatDump)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .wire.Stat queues = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_queues_size()); i < n; i++) {
+    const auto& repfield = this->_internal_queues(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .wire.ConnectionStat connections = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_connections_size()); i < n; i++) {
+    const auto& repfield = this->_internal_connections(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:wire.StatDump)
+  return target;
+}
+
+size_t StatDump::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:wire.StatDump)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .wire.Stat queues = 1;
+  total_size += 1UL * this->_internal_queues_size();
+  for (const auto& msg : this->_impl_.queues_) {
     total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->ranges(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (!unknown_fields().empty()) {
+  // repeated .wire.ConnectionStat connections = 2;
+  total_size += 1UL * this->_internal_connections_size();
+  for (const auto& msg : this->_impl_.connections_) {
     total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StatDump::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StatDump::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StatDump::GetClassData() const { return &_class_data_; }
+
+
+void StatDump::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StatDump*>(&to_msg);
+  auto& from = static_cast<const StatDump&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:wire.StatDump)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.queues_.MergeFrom(from._impl_.queues_);
+  _this->_impl_.connections_.MergeFrom(from._impl_.connections_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StatDump::CopyFrom(const StatDump& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:wire.StatDump)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
 
-void Queue::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Queue* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Queue*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
+bool StatDump::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.queues_))
+    return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.connections_))
+    return false;
+  return true;
+}
+
+void StatDump::InternalSwap(StatDump* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.queues_.InternalSwap(&other->_impl_.queues_);
+  _impl_.connections_.InternalSwap(&other->_impl_.connections_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StatDump::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_wire_2eproto_getter, &descriptor_table_wire_2eproto_once,
+      file_level_metadata_wire_2eproto[11]);
+}
+
+// ===================================================================
+
+class ReplicaAction::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ReplicaAction>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_payload(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_compressed(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_lsn(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000002) ^ 0x00000002) != 0;
+  }
+};
+
+ReplicaAction::ReplicaAction(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:wire.ReplicaAction)
+}
+ReplicaAction::ReplicaAction(const ReplicaAction& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReplicaAction* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.payload_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.compressed_){}
+    , decltype(_impl_.lsn_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.payload_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_payload()) {
+    _this->_impl_.payload_.Set(from._internal_payload(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.lsn_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.lsn_));
+  // @@protoc_insertion_point(copy_constructor:wire.ReplicaAction)
+}
+
+inline void ReplicaAction::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.payload_){}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.compressed_){false}
+    , decltype(_impl_.lsn_){uint64_t{0u}}
+  };
+  _impl_.payload_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ReplicaAction::~ReplicaAction() {
+  // @@protoc_insertion_point(destructor:wire.ReplicaAction)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReplicaAction::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.payload_.Destroy();
+}
+
+void ReplicaAction::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReplicaAction::Clear() {
+// @@protoc_insertion_point(message_clear_start:wire.ReplicaAction)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.payload_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.type_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.lsn_) -
+        reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.lsn_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReplicaAction::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .wire.ReplicaAction.Type type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::wire::ReplicaAction_Type_IsValid(val))) {
+            _internal_set_type(static_cast<::wire::ReplicaAction_Type>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes payload = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_payload();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool compressed = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_compressed(&has_bits);
+          _impl_.compressed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 lsn = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_lsn(&has_bits);
+          _impl_.lsn_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReplicaAction::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:wire.ReplicaAction)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .wire.ReplicaAction.Type type = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
+  }
+
+  // optional bytes payload = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_payload(), target);
+  }
+
+  // optional bool compressed = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_compressed(), target);
+  }
+
+  // optional uint64 lsn = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_lsn(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:wire.ReplicaAction)
+  return target;
+}
+
+size_t ReplicaAction::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:wire.ReplicaAction)
+  size_t total_size = 0;
+
+  // required .wire.ReplicaAction.Type type = 1;
+  if (_internal_has_type()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional bytes payload = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_payload());
+  }
+
+  if (cached_has_bits & 0x0000000cu) {
+    // optional bool compressed = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint64 lsn = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lsn());
+    }
+
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Queue::MergeFrom(const Queue& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  ranges_.MergeFrom(from.ranges_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_size()) {
-      set_size(from.size());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReplicaAction::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReplicaAction::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReplicaAction::GetClassData() const { return &_class_data_; }
+
+
+void ReplicaAction::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReplicaAction*>(&to_msg);
+  auto& from = static_cast<const ReplicaAction&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:wire.ReplicaAction)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_payload(from._internal_payload());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.compressed_ = from._impl_.compressed_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.lsn_ = from._impl_.lsn_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Queue::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Queue::CopyFrom(const Queue& from) {
+void ReplicaAction::CopyFrom(const ReplicaAction& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:wire.ReplicaAction)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Queue::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
-  for (int i = 0; i < ranges_size(); i++) {
-    if (!this->ranges(i).IsInitialized()) return false;
-  }
+bool ReplicaAction::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void Queue::Swap(Queue* other) {
-  if (other != this) {
-    std::swap(size_, other->size_);
-    ranges_.Swap(&other->ranges_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void ReplicaAction::InternalSwap(ReplicaAction* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.payload_, lhs_arena,
+      &other->_impl_.payload_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReplicaAction, _impl_.lsn_)
+      + sizeof(ReplicaAction::_impl_.lsn_)
+      - PROTOBUF_FIELD_OFFSET(ReplicaAction, _impl_.type_)>(
+          reinterpret_cast<char*>(&_impl_.type_),
+          reinterpret_cast<char*>(&other->_impl_.type_));
 }
 
-::google::protobuf::Metadata Queue::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Queue_descriptor_;
-  metadata.reflection = Queue_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata ReplicaAction::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_wire_2eproto_getter, &descriptor_table_wire_2eproto_once,
+      file_level_metadata_wire_2eproto[12]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int Stat::kNameFieldNumber;
-const int Stat::kExistsFieldNumber;
-const int Stat::kTransientSizeFieldNumber;
-const int Stat::kDurableSizeFieldNumber;
-#endif  // !_MSC_VER
-
-Stat::Stat()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+class ReplicaBatch::_Internal {
+ public:
+};
+
+ReplicaBatch::ReplicaBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:wire.ReplicaBatch)
+}
+ReplicaBatch::ReplicaBatch(const ReplicaBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReplicaBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){from._impl_.entries_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:wire.ReplicaBatch)
+}
+
+inline void ReplicaBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-void Stat::InitAsDefaultInstance() {
+ReplicaBatch::~ReplicaBatch() {
+  // @@protoc_insertion_point(destructor:wire.ReplicaBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-Stat::Stat(const Stat& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+inline void ReplicaBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
+}
+
+void ReplicaBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReplicaBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:wire.ReplicaBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entries_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReplicaBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated bytes entries = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_entries();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReplicaBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:wire.ReplicaBatch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated bytes entries = 1;
+  for (int i = 0, n = this->_internal_entries_size(); i < n; i++) {
+    const auto& s = this->_internal_entries(i);
+    target = stream->WriteBytes(1, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:wire.ReplicaBatch)
+  return target;
 }
 
-void Stat::SharedCtor() {
-  _cached_size_ = 0;
-  name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  exists_ = false;
-  transient_size_ = 0u;
-  durable_size_ = 0u;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-}
+size_t ReplicaBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:wire.ReplicaBatch)
+  size_t total_size = 0;
 
-Stat::~Stat() {
-  SharedDtor();
-}
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-void Stat::SharedDtor() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
-  }
-  if (this != default_instance_) {
+  // repeated bytes entries = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.entries_.size());
+  for (int i = 0, n = _impl_.entries_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.entries_.Get(i));
   }
-}
-
-void Stat::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Stat::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Stat_descriptor_;
-}
 
-const Stat& Stat::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_wire_2eproto();
-  return *default_instance_;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-Stat* Stat::default_instance_ = NULL;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReplicaBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReplicaBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReplicaBatch::GetClassData() const { return &_class_data_; }
 
-Stat* Stat::New() const {
-  return new Stat;
-}
 
-void Stat::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_name()) {
-      if (name_ != &::google::protobuf::internal::kEmptyString) {
-        name_->clear();
-      }
-    }
-    exists_ = false;
-    transient_size_ = 0u;
-    durable_size_ = 0u;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool Stat::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required string name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_exists;
-        break;
-      }
+void ReplicaBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReplicaBatch*>(&to_msg);
+  auto& from = static_cast<const ReplicaBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:wire.ReplicaBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-      // required bool exists = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_exists:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &exists_)));
-          set_has_exists();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_transient_size;
-        break;
-      }
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
 
-      // optional uint32 transient_size = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_transient_size:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &transient_size_)));
-          set_has_transient_size();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(32)) goto parse_durable_size;
-        break;
-      }
+void ReplicaBatch::CopyFrom(const ReplicaBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:wire.ReplicaBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
-      // optional uint32 durable_size = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_durable_size:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &durable_size_)));
-          set_has_durable_size();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
+bool ReplicaBatch::IsInitialized() const {
   return true;
-#undef DO_
 }
 
-void Stat::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->name(), output);
-  }
+void ReplicaBatch::InternalSwap(ReplicaBatch* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+}
 
-  // required bool exists = 2;
-  if (has_exists()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(2, this->exists(), output);
-  }
+::PROTOBUF_NAMESPACE_ID::Metadata ReplicaBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_wire_2eproto_getter, &descriptor_table_wire_2eproto_once,
+      file_level_metadata_wire_2eproto[13]);
+}
 
-  // optional uint32 transient_size = 3;
-  if (has_transient_size()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->transient_size(), output);
-  }
+// ===================================================================
 
-  // optional uint32 durable_size = 4;
-  if (has_durable_size()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->durable_size(), output);
+class ReplicaEntry::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ReplicaEntry>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_queue(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_kind(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_destination(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static const ::wire::Message& message(const ReplicaEntry* msg);
+  static void set_has_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_lsn(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_epoch(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000010) ^ 0x00000010) != 0;
+  }
+};
+
+const ::wire::Message&
+ReplicaEntry::_Internal::message(const ReplicaEntry* msg) {
+  return *msg->_impl_.message_;
+}
+ReplicaEntry::ReplicaEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:wire.ReplicaEntry)
+}
+ReplicaEntry::ReplicaEntry(const ReplicaEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReplicaEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.messages_){from._impl_.messages_}
+    , decltype(_impl_.queue_){}
+    , decltype(_impl_.destination_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.message_){nullptr}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.kind_){}
+    , decltype(_impl_.index_){}
+    , decltype(_impl_.lsn_){}
+    , decltype(_impl_.epoch_){}
+    , decltype(_impl_.count_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.queue_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_queue()) {
+    _this->_impl_.queue_.Set(from._internal_queue(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.destination_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.destination_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_destination()) {
+    _this->_impl_.destination_.Set(from._internal_destination(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_key()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_message()) {
+    _this->_impl_.message_ = new ::wire::Message(*from._impl_.message_);
+  }
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.count_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.count_));
+  // @@protoc_insertion_point(copy_constructor:wire.ReplicaEntry)
+}
+
+inline void ReplicaEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.messages_){arena}
+    , decltype(_impl_.queue_){}
+    , decltype(_impl_.destination_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.message_){nullptr}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.kind_){0}
+    , decltype(_impl_.index_){uint64_t{0u}}
+    , decltype(_impl_.lsn_){uint64_t{0u}}
+    , decltype(_impl_.epoch_){uint64_t{0u}}
+    , decltype(_impl_.count_){0u}
+  };
+  _impl_.queue_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.destination_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.destination_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ReplicaEntry::~ReplicaEntry() {
+  // @@protoc_insertion_point(destructor:wire.ReplicaEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
+inline void ReplicaEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.messages_.~RepeatedPtrField();
+  _impl_.queue_.Destroy();
+  _impl_.destination_.Destroy();
+  _impl_.key_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.message_;
 }
 
-::google::protobuf::uint8* Stat::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
-  }
+void ReplicaEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
 
-  // required bool exists = 2;
-  if (has_exists()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(2, this->exists(), target);
-  }
+void ReplicaEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:wire.ReplicaEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // optional uint32 transient_size = 3;
-  if (has_transient_size()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->transient_size(), target);
+  _impl_.messages_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.queue_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.destination_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.key_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.message_ != nullptr);
+      _impl_.message_->Clear();
+    }
   }
-
-  // optional uint32 durable_size = 4;
-  if (has_durable_size()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->durable_size(), target);
+  if (cached_has_bits & 0x000000f0u) {
+    ::memset(&_impl_.type_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.lsn_) -
+        reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.lsn_));
+  }
+  if (cached_has_bits & 0x00000300u) {
+    ::memset(&_impl_.epoch_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.count_) -
+        reinterpret_cast<char*>(&_impl_.epoch_)) + sizeof(_impl_.count_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReplicaEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .wire.ReplicaEntry.Type type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::wire::ReplicaEntry_Type_IsValid(val))) {
+            _internal_set_type(static_cast<::wire::ReplicaEntry_Type>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string queue = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_queue();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "wire.ReplicaEntry.queue");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .wire.QueueDeclaration.Type kind = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::wire::QueueDeclaration_Type_IsValid(val))) {
+            _internal_set_kind(static_cast<::wire::QueueDeclaration_Type>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(3, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string destination = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_destination();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "wire.ReplicaEntry.destination");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 index = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_index(&has_bits);
+          _impl_.index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 count = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_count(&has_bits);
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .wire.Message message = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_message(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 lsn = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_lsn(&has_bits);
+          _impl_.lsn_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 epoch = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_epoch(&has_bits);
+          _impl_.epoch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .wire.Message messages = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_messages(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<82>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string key = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "wire.ReplicaEntry.key");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReplicaEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:wire.ReplicaEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .wire.ReplicaEntry.Type type = 1;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
+  }
+
+  // optional string queue = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_queue().data(), static_cast<int>(this->_internal_queue().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "wire.ReplicaEntry.queue");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_queue(), target);
+  }
+
+  // optional .wire.QueueDeclaration.Type kind = 3;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_kind(), target);
+  }
+
+  // optional string destination = 4;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_destination().data(), static_cast<int>(this->_internal_destination().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "wire.ReplicaEntry.destination");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_destination(), target);
+  }
+
+  // optional uint64 index = 5;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_index(), target);
+  }
+
+  // optional uint32 count = 6;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_count(), target);
+  }
+
+  // optional .wire.Message message = 7;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::message(this),
+        _Internal::message(this).GetCachedSize(), target, stream);
+  }
+
+  // optional uint64 lsn = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_lsn(), target);
+  }
+
+  // optional uint64 epoch = 9;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_epoch(), target);
+  }
+
+  // repeated .wire.Message messages = 10;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_messages_size()); i < n; i++) {
+    const auto& repfield = this->_internal_messages(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(10, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional string key = 11;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "wire.ReplicaEntry.key");
+    target = stream->WriteStringMaybeAliased(
+        11, this->_internal_key(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:wire.ReplicaEntry)
   return target;
 }
 
-int Stat::ByteSize() const {
-  int total_size = 0;
+size_t ReplicaEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:wire.ReplicaEntry)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required string name = 1;
-    if (has_name()) {
+  // required .wire.ReplicaEntry.Type type = 1;
+  if (_internal_has_type()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .wire.Message messages = 10;
+  total_size += 1UL * this->_internal_messages_size();
+  for (const auto& msg : this->_impl_.messages_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional string queue = 2;
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->name());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_queue());
     }
 
-    // required bool exists = 2;
-    if (has_exists()) {
-      total_size += 1 + 1;
+    // optional string destination = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_destination());
     }
 
-    // optional uint32 transient_size = 3;
-    if (has_transient_size()) {
+    // optional string key = 11;
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->transient_size());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_key());
     }
 
-    // optional uint32 durable_size = 4;
-    if (has_durable_size()) {
+    // optional .wire.Message message = 7;
+    if (cached_has_bits & 0x00000008u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->durable_size());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.message_);
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+  if (cached_has_bits & 0x000000e0u) {
+    // optional .wire.QueueDeclaration.Type kind = 3;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_kind());
+    }
+
+    // optional uint64 index = 5;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_index());
+    }
+
+    // optional uint64 lsn = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lsn());
+    }
+
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+  if (cached_has_bits & 0x00000300u) {
+    // optional uint64 epoch = 9;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_epoch());
+    }
+
+    // optional uint32 count = 6;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_count());
+    }
 
-void Stat::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Stat* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Stat*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Stat::MergeFrom(const Stat& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_name()) {
-      set_name(from.name());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReplicaEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReplicaEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReplicaEntry::GetClassData() const { return &_class_data_; }
+
+
+void ReplicaEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReplicaEntry*>(&to_msg);
+  auto& from = static_cast<const ReplicaEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:wire.ReplicaEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.messages_.MergeFrom(from._impl_.messages_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_queue(from._internal_queue());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_destination(from._internal_destination());
     }
-    if (from.has_exists()) {
-      set_exists(from.exists());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_key(from._internal_key());
     }
-    if (from.has_transient_size()) {
-      set_transient_size(from.transient_size());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_message()->::wire::Message::MergeFrom(
+          from._internal_message());
     }
-    if (from.has_durable_size()) {
-      set_durable_size(from.durable_size());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.type_ = from._impl_.type_;
     }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.kind_ = from._impl_.kind_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.index_ = from._impl_.index_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.lsn_ = from._impl_.lsn_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000300u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.epoch_ = from._impl_.epoch_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.count_ = from._impl_.count_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Stat::CopyFrom(const ::google::protobuf::Message& from) {
+void ReplicaEntry::CopyFrom(const ReplicaEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:wire.ReplicaEntry)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void Stat::CopyFrom(const Stat& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+bool ReplicaEntry::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.messages_))
+    return false;
+  if (_internal_has_message()) {
+    if (!_impl_.message_->IsInitialized()) return false;
+  }
+  return true;
 }
 
-bool Stat::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+void ReplicaEntry::InternalSwap(ReplicaEntry* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.messages_.InternalSwap(&other->_impl_.messages_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.queue_, lhs_arena,
+      &other->_impl_.queue_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.destination_, lhs_arena,
+      &other->_impl_.destination_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReplicaEntry, _impl_.count_)
+      + sizeof(ReplicaEntry::_impl_.count_)
+      - PROTOBUF_FIELD_OFFSET(ReplicaEntry, _impl_.message_)>(
+          reinterpret_cast<char*>(&_impl_.message_),
+          reinterpret_cast<char*>(&other->_impl_.message_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReplicaEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_wire_2eproto_getter, &descriptor_table_wire_2eproto_once,
+      file_level_metadata_wire_2eproto[14]);
+}
 
-  return true;
+// ===================================================================
+
+class ReplicaStart::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ReplicaStart>()._impl_._has_bits_);
+  static void set_has_epoch(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_lsn(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+ReplicaStart::ReplicaStart(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:wire.ReplicaStart)
+}
+ReplicaStart::ReplicaStart(const ReplicaStart& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReplicaStart* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.epoch_){}
+    , decltype(_impl_.lsn_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.epoch_, &from._impl_.epoch_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.lsn_) -
+    reinterpret_cast<char*>(&_impl_.epoch_)) + sizeof(_impl_.lsn_));
+  // @@protoc_insertion_point(copy_constructor:wire.ReplicaStart)
+}
+
+inline void ReplicaStart::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.epoch_){uint64_t{0u}}
+    , decltype(_impl_.lsn_){uint64_t{0u}}
+  };
 }
 
-void Stat::Swap(Stat* other) {
-  if (other != this) {
-    std::swap(name_, other->name_);
-    std::swap(exists_, other->exists_);
-    std::swap(transient_size_, other->transient_size_);
-    std::swap(durable_size_, other->durable_size_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
+ReplicaStart::~ReplicaStart() {
+  // @@protoc_insertion_point(destructor:wire.ReplicaStart)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
 }
 
-::google::protobuf::Metadata Stat::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Stat_descriptor_;
-  metadata.reflection = Stat_reflection_;
-  return metadata;
+inline void ReplicaStart::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ReplicaStart::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReplicaStart::Clear() {
+// @@protoc_insertion_point(message_clear_start:wire.ReplicaStart)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.epoch_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.lsn_) -
+        reinterpret_cast<char*>(&_impl_.epoch_)) + sizeof(_impl_.lsn_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReplicaStart::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint64 epoch = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_epoch(&has_bits);
+          _impl_.epoch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 lsn = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_lsn(&has_bits);
+          _impl_.lsn_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReplicaStart::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:wire.ReplicaStart)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint64 epoch = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_epoch(), target);
+  }
+
+  // optional uint64 lsn = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_lsn(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:wire.ReplicaStart)
+  return target;
 }
 
+size_t ReplicaStart::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:wire.ReplicaStart)
+  size_t total_size = 0;
 
-// ===================================================================
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional uint64 epoch = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_epoch());
+    }
 
-const ::google::protobuf::EnumDescriptor* ReplicaAction_Type_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return ReplicaAction_Type_descriptor_;
+    // optional uint64 lsn = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lsn());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
-bool ReplicaAction_Type_IsValid(int value) {
-  switch(value) {
-    case 0:
-    case 1:
-      return true;
-    default:
-      return false;
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReplicaStart::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReplicaStart::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReplicaStart::GetClassData() const { return &_class_data_; }
+
+
+void ReplicaStart::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReplicaStart*>(&to_msg);
+  auto& from = static_cast<const ReplicaStart&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:wire.ReplicaStart)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.epoch_ = from._impl_.epoch_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.lsn_ = from._impl_.lsn_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-#ifndef _MSC_VER
-const ReplicaAction_Type ReplicaAction::eStart;
-const ReplicaAction_Type ReplicaAction::eReserve;
-const ReplicaAction_Type ReplicaAction::Type_MIN;
-const ReplicaAction_Type ReplicaAction::Type_MAX;
-const int ReplicaAction::Type_ARRAYSIZE;
-#endif  // _MSC_VER
-#ifndef _MSC_VER
-const int ReplicaAction::kTypeFieldNumber;
-const int ReplicaAction::kPayloadFieldNumber;
-#endif  // !_MSC_VER
+void ReplicaStart::CopyFrom(const ReplicaStart& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:wire.ReplicaStart)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
-ReplicaAction::ReplicaAction()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+bool ReplicaStart::IsInitialized() const {
+  return true;
 }
 
-void ReplicaAction::InitAsDefaultInstance() {
+void ReplicaStart::InternalSwap(ReplicaStart* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReplicaStart, _impl_.lsn_)
+      + sizeof(ReplicaStart::_impl_.lsn_)
+      - PROTOBUF_FIELD_OFFSET(ReplicaStart, _impl_.epoch_)>(
+          reinterpret_cast<char*>(&_impl_.epoch_),
+          reinterpret_cast<char*>(&other->_impl_.epoch_));
 }
 
-ReplicaAction::ReplicaAction(const ReplicaAction& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+::PROTOBUF_NAMESPACE_ID::Metadata ReplicaStart::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_wire_2eproto_getter, &descriptor_table_wire_2eproto_once,
+      file_level_metadata_wire_2eproto[15]);
 }
 
-void ReplicaAction::SharedCtor() {
-  _cached_size_ = 0;
-  type_ = 0;
-  payload_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+// ===================================================================
+
+class QueueError::_Internal {
+ public:
+  using HasBits = decltype(std::declval<QueueError>()._impl_._has_bits_);
+  static void set_has_queue(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_error(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+QueueError::QueueError(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:wire.QueueError)
+}
+QueueError::QueueError(const QueueError& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  QueueError* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.queue_){}
+    , decltype(_impl_.error_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.queue_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_queue()) {
+    _this->_impl_.queue_.Set(from._internal_queue(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_error()) {
+    _this->_impl_.error_.Set(from._internal_error(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:wire.QueueError)
+}
+
+inline void QueueError::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.queue_){}
+    , decltype(_impl_.error_){}
+  };
+  _impl_.queue_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-ReplicaAction::~ReplicaAction() {
+QueueError::~QueueError() {
+  // @@protoc_insertion_point(destructor:wire.QueueError)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ReplicaAction::SharedDtor() {
-  if (payload_ != &::google::protobuf::internal::kEmptyString) {
-    delete payload_;
+inline void QueueError::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.queue_.Destroy();
+  _impl_.error_.Destroy();
+}
+
+void QueueError::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void QueueError::Clear() {
+// @@protoc_insertion_point(message_clear_start:wire.QueueError)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.queue_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.error_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* QueueError::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string queue = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_queue();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "wire.QueueError.queue");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string error = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_error();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "wire.QueueError.error");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* QueueError::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:wire.QueueError)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string queue = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_queue().data(), static_cast<int>(this->_internal_queue().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "wire.QueueError.queue");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_queue(), target);
+  }
+
+  // optional string error = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "wire.QueueError.error");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_error(), target);
   }
-  if (this != default_instance_) {
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:wire.QueueError)
+  return target;
 }
 
-void ReplicaAction::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+size_t QueueError::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:wire.QueueError)
+  size_t total_size = 0;
+
+  // required string queue = 1;
+  if (_internal_has_queue()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_queue());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string error = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData QueueError::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    QueueError::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*QueueError::GetClassData() const { return &_class_data_; }
+
+
+void QueueError::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<QueueError*>(&to_msg);
+  auto& from = static_cast<const QueueError&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:wire.QueueError)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_queue(from._internal_queue());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_error(from._internal_error());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
-const ::google::protobuf::Descriptor* ReplicaAction::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return ReplicaAction_descriptor_;
+
+void QueueError::CopyFrom(const QueueError& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:wire.QueueError)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
 
-const ReplicaAction& ReplicaAction::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_wire_2eproto();
-  return *default_instance_;
+bool QueueError::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
 }
 
-ReplicaAction* ReplicaAction::default_instance_ = NULL;
+void QueueError::InternalSwap(QueueError* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.queue_, lhs_arena,
+      &other->_impl_.queue_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_, lhs_arena,
+      &other->_impl_.error_, rhs_arena
+  );
+}
 
-ReplicaAction* ReplicaAction::New() const {
-  return new ReplicaAction;
+::PROTOBUF_NAMESPACE_ID::Metadata QueueError::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_wire_2eproto_getter, &descriptor_table_wire_2eproto_once,
+      file_level_metadata_wire_2eproto[16]);
 }
 
-void ReplicaAction::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    type_ = 0;
-    if (has_payload()) {
-      if (payload_ != &::google::protobuf::internal::kEmptyString) {
-        payload_->clear();
-      }
-    }
+// ===================================================================
+
+class QueueDeclaration::_Internal {
+ public:
+  using HasBits = decltype(std::declval<QueueDeclaration>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_sync_replicas(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_ttl(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_ack_timeout(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_weight(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_durable_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  static void set_has_expiries_indexed(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+QueueDeclaration::QueueDeclaration(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:wire.QueueDeclaration)
+}
+QueueDeclaration::QueueDeclaration(const QueueDeclaration& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  QueueDeclaration* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.sync_replicas_){}
+    , decltype(_impl_.ttl_){}
+    , decltype(_impl_.ack_timeout_){}
+    , decltype(_impl_.durable_size_){}
+    , decltype(_impl_.weight_){}
+    , decltype(_impl_.expiries_indexed_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.expiries_indexed_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.expiries_indexed_));
+  // @@protoc_insertion_point(copy_constructor:wire.QueueDeclaration)
+}
+
+inline void QueueDeclaration::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.sync_replicas_){0u}
+    , decltype(_impl_.ttl_){0u}
+    , decltype(_impl_.ack_timeout_){0u}
+    , decltype(_impl_.durable_size_){uint64_t{0u}}
+    , decltype(_impl_.weight_){0u}
+    , decltype(_impl_.expiries_indexed_){false}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-bool ReplicaAction::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required .wire.ReplicaAction.Type type = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::wire::ReplicaAction_Type_IsValid(value)) {
-            set_type(static_cast< ::wire::ReplicaAction_Type >(value));
+QueueDeclaration::~QueueDeclaration() {
+  // @@protoc_insertion_point(destructor:wire.QueueDeclaration)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void QueueDeclaration::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+}
+
+void QueueDeclaration::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void QueueDeclaration::Clear() {
+// @@protoc_insertion_point(message_clear_start:wire.QueueDeclaration)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x000000feu) {
+    ::memset(&_impl_.type_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.expiries_indexed_) -
+        reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.expiries_indexed_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* QueueDeclaration::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "wire.QueueDeclaration.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required .wire.QueueDeclaration.Type type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::wire::QueueDeclaration_Type_IsValid(val))) {
+            _internal_set_type(static_cast<::wire::QueueDeclaration_Type>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(1, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_payload;
-        break;
-      }
-
-      // optional bytes payload = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_payload:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_payload()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 sync_replicas = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_sync_replicas(&has_bits);
+          _impl_.sync_replicas_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 ttl = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_ttl(&has_bits);
+          _impl_.ttl_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 ack_timeout = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_ack_timeout(&has_bits);
+          _impl_.ack_timeout_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 weight = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_weight(&has_bits);
+          _impl_.weight_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 durable_size = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_durable_size(&has_bits);
+          _impl_.durable_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool expiries_indexed = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_expiries_indexed(&has_bits);
+          _impl_.expiries_indexed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* QueueDeclaration::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:wire.QueueDeclaration)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "wire.QueueDeclaration.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
-  return true;
-#undef DO_
-}
 
-void ReplicaAction::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required .wire.ReplicaAction.Type type = 1;
-  if (has_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->type(), output);
+  // required .wire.QueueDeclaration.Type type = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_type(), target);
   }
 
-  // optional bytes payload = 2;
-  if (has_payload()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      2, this->payload(), output);
+  // optional uint32 sync_replicas = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_sync_replicas(), target);
+  }
+
+  // optional uint32 ttl = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_ttl(), target);
+  }
+
+  // optional uint32 ack_timeout = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_ack_timeout(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // optional uint32 weight = 6;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_weight(), target);
   }
-}
 
-::google::protobuf::uint8* ReplicaAction::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required .wire.ReplicaAction.Type type = 1;
-  if (has_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->type(), target);
+  // optional uint64 durable_size = 7;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_durable_size(), target);
   }
 
-  // optional bytes payload = 2;
-  if (has_payload()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        2, this->payload(), target);
+  // optional bool expiries_indexed = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_expiries_indexed(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:wire.QueueDeclaration)
   return target;
 }
 
-int ReplicaAction::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required .wire.ReplicaAction.Type type = 1;
-    if (has_type()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
-    }
-
-    // optional bytes payload = 2;
-    if (has_payload()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->payload());
-    }
+size_t QueueDeclaration::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:wire.QueueDeclaration)
+  size_t total_size = 0;
 
+  if (_internal_has_name()) {
+    // required string name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+
+  if (_internal_has_type()) {
+    // required .wire.QueueDeclaration.Type type = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+
   return total_size;
 }
+size_t QueueDeclaration::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:wire.QueueDeclaration)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+
+    // required .wire.QueueDeclaration.Type type = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
 
-void ReplicaAction::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const ReplicaAction* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const ReplicaAction*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
-}
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-void ReplicaAction::MergeFrom(const ReplicaAction& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_type()) {
-      set_type(from.type());
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000fcu) {
+    // optional uint32 sync_replicas = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sync_replicas());
     }
-    if (from.has_payload()) {
-      set_payload(from.payload());
+
+    // optional uint32 ttl = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_ttl());
     }
-  }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
 
-void ReplicaAction::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
+    // optional uint32 ack_timeout = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_ack_timeout());
+    }
 
-void ReplicaAction::CopyFrom(const ReplicaAction& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
+    // optional uint64 durable_size = 7;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_durable_size());
+    }
 
-bool ReplicaAction::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
+    // optional uint32 weight = 6;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_weight());
+    }
 
-  return true;
-}
+    // optional bool expiries_indexed = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 1;
+    }
 
-void ReplicaAction::Swap(ReplicaAction* other) {
-  if (other != this) {
-    std::swap(type_, other->type_);
-    std::swap(payload_, other->payload_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-::google::protobuf::Metadata ReplicaAction::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = ReplicaAction_descriptor_;
-  metadata.reflection = ReplicaAction_reflection_;
-  return metadata;
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData QueueDeclaration::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    QueueDeclaration::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*QueueDeclaration::GetClassData() const { return &_class_data_; }
 
 
-// ===================================================================
+void QueueDeclaration::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<QueueDeclaration*>(&to_msg);
+  auto& from = static_cast<const QueueDeclaration&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:wire.QueueDeclaration)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-#ifndef _MSC_VER
-const int QueueError::kQueueFieldNumber;
-const int QueueError::kErrorFieldNumber;
-#endif  // !_MSC_VER
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.sync_replicas_ = from._impl_.sync_replicas_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.ttl_ = from._impl_.ttl_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.ack_timeout_ = from._impl_.ack_timeout_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.durable_size_ = from._impl_.durable_size_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.weight_ = from._impl_.weight_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.expiries_indexed_ = from._impl_.expiries_indexed_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
 
-QueueError::QueueError()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+void QueueDeclaration::CopyFrom(const QueueDeclaration& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:wire.QueueDeclaration)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
 
-void QueueError::InitAsDefaultInstance() {
+bool QueueDeclaration::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
 }
 
-QueueError::QueueError(const QueueError& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+void QueueDeclaration::InternalSwap(QueueDeclaration* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(QueueDeclaration, _impl_.expiries_indexed_)
+      + sizeof(QueueDeclaration::_impl_.expiries_indexed_)
+      - PROTOBUF_FIELD_OFFSET(QueueDeclaration, _impl_.type_)>(
+          reinterpret_cast<char*>(&_impl_.type_),
+          reinterpret_cast<char*>(&other->_impl_.type_));
 }
 
-void QueueError::SharedCtor() {
-  _cached_size_ = 0;
-  queue_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  error_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+::PROTOBUF_NAMESPACE_ID::Metadata QueueDeclaration::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_wire_2eproto_getter, &descriptor_table_wire_2eproto_once,
+      file_level_metadata_wire_2eproto[17]);
 }
 
-QueueError::~QueueError() {
-  SharedDtor();
+// ===================================================================
+
+class QueueReplication::_Internal {
+ public:
+  using HasBits = decltype(std::declval<QueueReplication>()._impl_._has_bits_);
+  static void set_has_queue(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_sync_replicas(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+QueueReplication::QueueReplication(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:wire.QueueReplication)
+}
+QueueReplication::QueueReplication(const QueueReplication& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  QueueReplication* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.queue_){}
+    , decltype(_impl_.sync_replicas_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.queue_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_queue()) {
+    _this->_impl_.queue_.Set(from._internal_queue(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.sync_replicas_ = from._impl_.sync_replicas_;
+  // @@protoc_insertion_point(copy_constructor:wire.QueueReplication)
+}
+
+inline void QueueReplication::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.queue_){}
+    , decltype(_impl_.sync_replicas_){0u}
+  };
+  _impl_.queue_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-void QueueError::SharedDtor() {
-  if (queue_ != &::google::protobuf::internal::kEmptyString) {
-    delete queue_;
-  }
-  if (error_ != &::google::protobuf::internal::kEmptyString) {
-    delete error_;
-  }
-  if (this != default_instance_) {
+QueueReplication::~QueueReplication() {
+  // @@protoc_insertion_point(destructor:wire.QueueReplication)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
 }
 
-void QueueError::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* QueueError::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return QueueError_descriptor_;
+inline void QueueReplication::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.queue_.Destroy();
 }
 
-const QueueError& QueueError::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_wire_2eproto();
-  return *default_instance_;
+void QueueReplication::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-QueueError* QueueError::default_instance_ = NULL;
-
-QueueError* QueueError::New() const {
-  return new QueueError;
-}
+void QueueReplication::Clear() {
+// @@protoc_insertion_point(message_clear_start:wire.QueueReplication)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-void QueueError::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_queue()) {
-      if (queue_ != &::google::protobuf::internal::kEmptyString) {
-        queue_->clear();
-      }
-    }
-    if (has_error()) {
-      if (error_ != &::google::protobuf::internal::kEmptyString) {
-        error_->clear();
-      }
-    }
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.queue_.ClearNonDefaultToEmpty();
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _impl_.sync_replicas_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool QueueError::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* QueueReplication::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required string queue = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_queue()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->queue().data(), this->queue().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_error;
-        break;
-      }
-
-      // optional string error = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_error:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_error()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->error().data(), this->error().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_queue();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "wire.QueueReplication.queue");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 sync_replicas = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_sync_replicas(&has_bits);
+          _impl_.sync_replicas_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void QueueError::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* QueueReplication::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:wire.QueueReplication)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required string queue = 1;
-  if (has_queue()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->queue().data(), this->queue().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->queue(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_queue().data(), static_cast<int>(this->_internal_queue().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "wire.QueueReplication.queue");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_queue(), target);
   }
 
-  // optional string error = 2;
-  if (has_error()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->error().data(), this->error().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      2, this->error(), output);
+  // required uint32 sync_replicas = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_sync_replicas(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:wire.QueueReplication)
+  return target;
 }
 
-::google::protobuf::uint8* QueueError::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required string queue = 1;
-  if (has_queue()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->queue().data(), this->queue().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->queue(), target);
-  }
+size_t QueueReplication::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:wire.QueueReplication)
+  size_t total_size = 0;
 
-  // optional string error = 2;
-  if (has_error()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->error().data(), this->error().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->error(), target);
+  if (_internal_has_queue()) {
+    // required string queue = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_queue());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (_internal_has_sync_replicas()) {
+    // required uint32 sync_replicas = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sync_replicas());
   }
-  return target;
-}
 
-int QueueError::ByteSize() const {
-  int total_size = 0;
+  return total_size;
+}
+size_t QueueReplication::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:wire.QueueReplication)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
     // required string queue = 1;
-    if (has_queue()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->queue());
-    }
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_queue());
 
-    // optional string error = 2;
-    if (has_error()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->error());
-    }
-
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    // required uint32 sync_replicas = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sync_replicas());
 
-void QueueError::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const QueueError* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const QueueError*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void QueueError::MergeFrom(const QueueError& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_queue()) {
-      set_queue(from.queue());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData QueueReplication::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    QueueReplication::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*QueueReplication::GetClassData() const { return &_class_data_; }
+
+
+void QueueReplication::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<QueueReplication*>(&to_msg);
+  auto& from = static_cast<const QueueReplication&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:wire.QueueReplication)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_queue(from._internal_queue());
     }
-    if (from.has_error()) {
-      set_error(from.error());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.sync_replicas_ = from._impl_.sync_replicas_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void QueueError::CopyFrom(const ::google::protobuf::Message& from) {
+void QueueReplication::CopyFrom(const QueueReplication& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:wire.QueueReplication)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void QueueError::CopyFrom(const QueueError& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool QueueError::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
+bool QueueReplication::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void QueueError::Swap(QueueError* other) {
-  if (other != this) {
-    std::swap(queue_, other->queue_);
-    std::swap(error_, other->error_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void QueueReplication::InternalSwap(QueueReplication* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.queue_, lhs_arena,
+      &other->_impl_.queue_, rhs_arena
+  );
+  swap(_impl_.sync_replicas_, other->_impl_.sync_replicas_);
 }
 
-::google::protobuf::Metadata QueueError::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = QueueError_descriptor_;
-  metadata.reflection = QueueError_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata QueueReplication::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_wire_2eproto_getter, &descriptor_table_wire_2eproto_once,
+      file_level_metadata_wire_2eproto[18]);
 }
 
-
 // ===================================================================
 
-const ::google::protobuf::EnumDescriptor* QueueDeclaration_Type_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return QueueDeclaration_Type_descriptor_;
-}
-bool QueueDeclaration_Type_IsValid(int value) {
-  switch(value) {
-    case 0:
-    case 1:
-    case 2:
-      return true;
-    default:
-      return false;
-  }
-}
-
-#ifndef _MSC_VER
-const QueueDeclaration_Type QueueDeclaration::eBroadcast;
-const QueueDeclaration_Type QueueDeclaration::eTransient;
-const QueueDeclaration_Type QueueDeclaration::eDurable;
-const QueueDeclaration_Type QueueDeclaration::Type_MIN;
-const QueueDeclaration_Type QueueDeclaration::Type_MAX;
-const int QueueDeclaration::Type_ARRAYSIZE;
-#endif  // _MSC_VER
-#ifndef _MSC_VER
-const int QueueDeclaration::kNameFieldNumber;
-const int QueueDeclaration::kTypeFieldNumber;
-#endif  // !_MSC_VER
-
-QueueDeclaration::QueueDeclaration()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
-
-void QueueDeclaration::InitAsDefaultInstance() {
-}
-
-QueueDeclaration::QueueDeclaration(const QueueDeclaration& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void QueueDeclaration::SharedCtor() {
-  _cached_size_ = 0;
-  name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  type_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-}
-
-QueueDeclaration::~QueueDeclaration() {
-  SharedDtor();
+class QueueOptions::_Internal {
+ public:
+  using HasBits = decltype(std::declval<QueueOptions>()._impl_._has_bits_);
+  static void set_has_queue(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_ttl(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_ack_timeout(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_weight(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+QueueOptions::QueueOptions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:wire.QueueOptions)
+}
+QueueOptions::QueueOptions(const QueueOptions& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  QueueOptions* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.queue_){}
+    , decltype(_impl_.ttl_){}
+    , decltype(_impl_.ack_timeout_){}
+    , decltype(_impl_.weight_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.queue_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_queue()) {
+    _this->_impl_.queue_.Set(from._internal_queue(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.ttl_, &from._impl_.ttl_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.weight_) -
+    reinterpret_cast<char*>(&_impl_.ttl_)) + sizeof(_impl_.weight_));
+  // @@protoc_insertion_point(copy_constructor:wire.QueueOptions)
+}
+
+inline void QueueOptions::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.queue_){}
+    , decltype(_impl_.ttl_){0u}
+    , decltype(_impl_.ack_timeout_){0u}
+    , decltype(_impl_.weight_){0u}
+  };
+  _impl_.queue_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-void QueueDeclaration::SharedDtor() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
-  }
-  if (this != default_instance_) {
+QueueOptions::~QueueOptions() {
+  // @@protoc_insertion_point(destructor:wire.QueueOptions)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
 }
 
-void QueueDeclaration::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* QueueDeclaration::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return QueueDeclaration_descriptor_;
+inline void QueueOptions::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.queue_.Destroy();
 }
 
-const QueueDeclaration& QueueDeclaration::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_wire_2eproto();
-  return *default_instance_;
+void QueueOptions::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-QueueDeclaration* QueueDeclaration::default_instance_ = NULL;
-
-QueueDeclaration* QueueDeclaration::New() const {
-  return new QueueDeclaration;
-}
+void QueueOptions::Clear() {
+// @@protoc_insertion_point(message_clear_start:wire.QueueOptions)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-void QueueDeclaration::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_name()) {
-      if (name_ != &::google::protobuf::internal::kEmptyString) {
-        name_->clear();
-      }
-    }
-    type_ = 0;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.queue_.ClearNonDefaultToEmpty();
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool QueueDeclaration::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required string name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_type;
-        break;
-      }
-
-      // required .wire.QueueDeclaration.Type type = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_type:
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::wire::QueueDeclaration_Type_IsValid(value)) {
-            set_type(static_cast< ::wire::QueueDeclaration_Type >(value));
-          } else {
-            mutable_unknown_fields()->AddVarint(2, value);
-          }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.ttl_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.weight_) -
+        reinterpret_cast<char*>(&_impl_.ttl_)) + sizeof(_impl_.weight_));
   }
-  return true;
-#undef DO_
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void QueueDeclaration::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->name(), output);
-  }
-
-  // required .wire.QueueDeclaration.Type type = 2;
-  if (has_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      2, this->type(), output);
+const char* QueueOptions::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string queue = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_queue();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "wire.QueueOptions.queue");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 ttl = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_ttl(&has_bits);
+          _impl_.ttl_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 ack_timeout = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_ack_timeout(&has_bits);
+          _impl_.ack_timeout_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 weight = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_weight(&has_bits);
+          _impl_.weight_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* QueueOptions::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:wire.QueueOptions)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string queue = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_queue().data(), static_cast<int>(this->_internal_queue().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "wire.QueueOptions.queue");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_queue(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // optional uint32 ttl = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_ttl(), target);
   }
-}
 
-::google::protobuf::uint8* QueueDeclaration::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
+  // optional uint32 ack_timeout = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_ack_timeout(), target);
   }
 
-  // required .wire.QueueDeclaration.Type type = 2;
-  if (has_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      2, this->type(), target);
+  // optional uint32 weight = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_weight(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:wire.QueueOptions)
   return target;
 }
 
-int QueueDeclaration::ByteSize() const {
-  int total_size = 0;
+size_t QueueOptions::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:wire.QueueOptions)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required string name = 1;
-    if (has_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->name());
+  // required string queue = 1;
+  if (_internal_has_queue()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_queue());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000eu) {
+    // optional uint32 ttl = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_ttl());
     }
 
-    // required .wire.QueueDeclaration.Type type = 2;
-    if (has_type()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
+    // optional uint32 ack_timeout = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_ack_timeout());
     }
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    // optional uint32 weight = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_weight());
+    }
 
-void QueueDeclaration::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const QueueDeclaration* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const QueueDeclaration*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void QueueDeclaration::MergeFrom(const QueueDeclaration& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_name()) {
-      set_name(from.name());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData QueueOptions::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    QueueOptions::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*QueueOptions::GetClassData() const { return &_class_data_; }
+
+
+void QueueOptions::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<QueueOptions*>(&to_msg);
+  auto& from = static_cast<const QueueOptions&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:wire.QueueOptions)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_queue(from._internal_queue());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.ttl_ = from._impl_.ttl_;
     }
-    if (from.has_type()) {
-      set_type(from.type());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.ack_timeout_ = from._impl_.ack_timeout_;
     }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.weight_ = from._impl_.weight_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void QueueDeclaration::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void QueueDeclaration::CopyFrom(const QueueDeclaration& from) {
+void QueueOptions::CopyFrom(const QueueOptions& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:wire.QueueOptions)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool QueueDeclaration::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-
+bool QueueOptions::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void QueueDeclaration::Swap(QueueDeclaration* other) {
-  if (other != this) {
-    std::swap(name_, other->name_);
-    std::swap(type_, other->type_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void QueueOptions::InternalSwap(QueueOptions* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.queue_, lhs_arena,
+      &other->_impl_.queue_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(QueueOptions, _impl_.weight_)
+      + sizeof(QueueOptions::_impl_.weight_)
+      - PROTOBUF_FIELD_OFFSET(QueueOptions, _impl_.ttl_)>(
+          reinterpret_cast<char*>(&_impl_.ttl_),
+          reinterpret_cast<char*>(&other->_impl_.ttl_));
 }
 
-::google::protobuf::Metadata QueueDeclaration::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = QueueDeclaration_descriptor_;
-  metadata.reflection = QueueDeclaration_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata QueueOptions::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_wire_2eproto_getter, &descriptor_table_wire_2eproto_once,
+      file_level_metadata_wire_2eproto[19]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int QueueConfiguration::kQueuesFieldNumber;
-#endif  // !_MSC_VER
-
-QueueConfiguration::QueueConfiguration()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class QueueConfiguration::_Internal {
+ public:
+};
 
-void QueueConfiguration::InitAsDefaultInstance() {
+QueueConfiguration::QueueConfiguration(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:wire.QueueConfiguration)
 }
-
 QueueConfiguration::QueueConfiguration(const QueueConfiguration& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void QueueConfiguration::SharedCtor() {
-  _cached_size_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  QueueConfiguration* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.queues_){from._impl_.queues_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:wire.QueueConfiguration)
+}
+
+inline void QueueConfiguration::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.queues_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 QueueConfiguration::~QueueConfiguration() {
+  // @@protoc_insertion_point(destructor:wire.QueueConfiguration)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void QueueConfiguration::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void QueueConfiguration::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.queues_.~RepeatedPtrField();
 }
 
 void QueueConfiguration::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* QueueConfiguration::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return QueueConfiguration_descriptor_;
-}
-
-const QueueConfiguration& QueueConfiguration::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_wire_2eproto();
-  return *default_instance_;
-}
-
-QueueConfiguration* QueueConfiguration::default_instance_ = NULL;
-
-QueueConfiguration* QueueConfiguration::New() const {
-  return new QueueConfiguration;
+  _impl_._cached_size_.Set(size);
 }
 
 void QueueConfiguration::Clear() {
-  queues_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+// @@protoc_insertion_point(message_clear_start:wire.QueueConfiguration)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.queues_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool QueueConfiguration::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* QueueConfiguration::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated .wire.QueueDeclaration queues = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_queues:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_queues()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(10)) goto parse_queues;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_queues(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void QueueConfiguration::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // repeated .wire.QueueDeclaration queues = 1;
-  for (int i = 0; i < this->queues_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->queues(i), output);
-  }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* QueueConfiguration::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:wire.QueueConfiguration)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-::google::protobuf::uint8* QueueConfiguration::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
   // repeated .wire.QueueDeclaration queues = 1;
-  for (int i = 0; i < this->queues_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->queues(i), target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_queues_size()); i < n; i++) {
+    const auto& repfield = this->_internal_queues(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:wire.QueueConfiguration)
   return target;
 }
 
-int QueueConfiguration::ByteSize() const {
-  int total_size = 0;
+size_t QueueConfiguration::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:wire.QueueConfiguration)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated .wire.QueueDeclaration queues = 1;
-  total_size += 1 * this->queues_size();
-  for (int i = 0; i < this->queues_size(); i++) {
+  total_size += 1UL * this->_internal_queues_size();
+  for (const auto& msg : this->_impl_.queues_) {
     total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->queues(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void QueueConfiguration::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const QueueConfiguration* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const QueueConfiguration*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData QueueConfiguration::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    QueueConfiguration::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*QueueConfiguration::GetClassData() const { return &_class_data_; }
 
-void QueueConfiguration::MergeFrom(const QueueConfiguration& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  queues_.MergeFrom(from.queues_);
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
 
-void QueueConfiguration::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void QueueConfiguration::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<QueueConfiguration*>(&to_msg);
+  auto& from = static_cast<const QueueConfiguration&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:wire.QueueConfiguration)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.queues_.MergeFrom(from._impl_.queues_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void QueueConfiguration::CopyFrom(const QueueConfiguration& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:wire.QueueConfiguration)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool QueueConfiguration::IsInitialized() const {
-
-  for (int i = 0; i < queues_size(); i++) {
-    if (!this->queues(i).IsInitialized()) return false;
-  }
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.queues_))
+    return false;
   return true;
 }
 
-void QueueConfiguration::Swap(QueueConfiguration* other) {
-  if (other != this) {
-    queues_.Swap(&other->queues_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void QueueConfiguration::InternalSwap(QueueConfiguration* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.queues_.InternalSwap(&other->_impl_.queues_);
 }
 
-::google::protobuf::Metadata QueueConfiguration::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = QueueConfiguration_descriptor_;
-  metadata.reflection = QueueConfiguration_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata QueueConfiguration::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_wire_2eproto_getter, &descriptor_table_wire_2eproto_once,
+      file_level_metadata_wire_2eproto[20]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
-
 }  // namespace wire
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::wire::Message*
+Arena::CreateMaybeMessage< ::wire::Message >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::wire::Message >(arena);
+}
+template<> PROTOBUF_NOINLINE ::wire::Action*
+Arena::CreateMaybeMessage< ::wire::Action >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::wire::Action >(arena);
+}
+template<> PROTOBUF_NOINLINE ::wire::ConfirmRange*
+Arena::CreateMaybeMessage< ::wire::ConfirmRange >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::wire::ConfirmRange >(arena);
+}
+template<> PROTOBUF_NOINLINE ::wire::Confirms*
+Arena::CreateMaybeMessage< ::wire::Confirms >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::wire::Confirms >(arena);
+}
+template<> PROTOBUF_NOINLINE ::wire::BondRequest*
+Arena::CreateMaybeMessage< ::wire::BondRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::wire::BondRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::wire::ConnectionConfigure*
+Arena::CreateMaybeMessage< ::wire::ConnectionConfigure >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::wire::ConnectionConfigure >(arena);
+}
+template<> PROTOBUF_NOINLINE ::wire::MessageBatch*
+Arena::CreateMaybeMessage< ::wire::MessageBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::wire::MessageBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::wire::MessageRange*
+Arena::CreateMaybeMessage< ::wire::MessageRange >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::wire::MessageRange >(arena);
+}
+template<> PROTOBUF_NOINLINE ::wire::Queue*
+Arena::CreateMaybeMessage< ::wire::Queue >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::wire::Queue >(arena);
+}
+template<> PROTOBUF_NOINLINE ::wire::Stat*
+Arena::CreateMaybeMessage< ::wire::Stat >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::wire::Stat >(arena);
+}
+template<> PROTOBUF_NOINLINE ::wire::ConnectionStat*
+Arena::CreateMaybeMessage< ::wire::ConnectionStat >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::wire::ConnectionStat >(arena);
+}
+template<> PROTOBUF_NOINLINE ::wire::StatDump*
+Arena::CreateMaybeMessage< ::wire::StatDump >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::wire::StatDump >(arena);
+}
+template<> PROTOBUF_NOINLINE ::wire::ReplicaAction*
+Arena::CreateMaybeMessage< ::wire::ReplicaAction >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::wire::ReplicaAction >(arena);
+}
+template<> PROTOBUF_NOINLINE ::wire::ReplicaBatch*
+Arena::CreateMaybeMessage< ::wire::ReplicaBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::wire::ReplicaBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::wire::ReplicaEntry*
+Arena::CreateMaybeMessage< ::wire::ReplicaEntry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::wire::ReplicaEntry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::wire::ReplicaStart*
+Arena::CreateMaybeMessage< ::wire::ReplicaStart >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::wire::ReplicaStart >(arena);
+}
+template<> PROTOBUF_NOINLINE ::wire::QueueError*
+Arena::CreateMaybeMessage< ::wire::QueueError >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::wire::QueueError >(arena);
+}
+template<> PROTOBUF_NOINLINE ::wire::QueueDeclaration*
+Arena::CreateMaybeMessage< ::wire::QueueDeclaration >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::wire::QueueDeclaration >(arena);
+}
+template<> PROTOBUF_NOINLINE ::wire::QueueReplication*
+Arena::CreateMaybeMessage< ::wire::QueueReplication >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::wire::QueueReplication >(arena);
+}
+template<> PROTOBUF_NOINLINE ::wire::QueueOptions*
+Arena::CreateMaybeMessage< ::wire::QueueOptions >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::wire::QueueOptions >(arena);
+}
+template<> PROTOBUF_NOINLINE ::wire::QueueConfiguration*
+Arena::CreateMaybeMessage< ::wire::QueueConfiguration >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::wire::QueueConfiguration >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
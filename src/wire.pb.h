@@ -1,2419 +1,8668 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: wire.proto
 
-#ifndef PROTOBUF_wire_2eproto__INCLUDED
-#define PROTOBUF_wire_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_wire_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_wire_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 2005000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 2005000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_wire_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_wire_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_wire_2eproto;
 namespace wire {
-
-// Internal implementation detail -- do not call these.
-void  protobuf_AddDesc_wire_2eproto();
-void protobuf_AssignDesc_wire_2eproto();
-void protobuf_ShutdownFile_wire_2eproto();
-
-class Message;
 class Action;
+struct ActionDefaultTypeInternal;
+extern ActionDefaultTypeInternal _Action_default_instance_;
 class BondRequest;
+struct BondRequestDefaultTypeInternal;
+extern BondRequestDefaultTypeInternal _BondRequest_default_instance_;
+class ConfirmRange;
+struct ConfirmRangeDefaultTypeInternal;
+extern ConfirmRangeDefaultTypeInternal _ConfirmRange_default_instance_;
+class Confirms;
+struct ConfirmsDefaultTypeInternal;
+extern ConfirmsDefaultTypeInternal _Confirms_default_instance_;
 class ConnectionConfigure;
+struct ConnectionConfigureDefaultTypeInternal;
+extern ConnectionConfigureDefaultTypeInternal _ConnectionConfigure_default_instance_;
+class ConnectionStat;
+struct ConnectionStatDefaultTypeInternal;
+extern ConnectionStatDefaultTypeInternal _ConnectionStat_default_instance_;
+class Message;
+struct MessageDefaultTypeInternal;
+extern MessageDefaultTypeInternal _Message_default_instance_;
+class MessageBatch;
+struct MessageBatchDefaultTypeInternal;
+extern MessageBatchDefaultTypeInternal _MessageBatch_default_instance_;
 class MessageRange;
+struct MessageRangeDefaultTypeInternal;
+extern MessageRangeDefaultTypeInternal _MessageRange_default_instance_;
 class Queue;
-class Stat;
-class ReplicaAction;
-class QueueError;
-class QueueDeclaration;
+struct QueueDefaultTypeInternal;
+extern QueueDefaultTypeInternal _Queue_default_instance_;
 class QueueConfiguration;
+struct QueueConfigurationDefaultTypeInternal;
+extern QueueConfigurationDefaultTypeInternal _QueueConfiguration_default_instance_;
+class QueueDeclaration;
+struct QueueDeclarationDefaultTypeInternal;
+extern QueueDeclarationDefaultTypeInternal _QueueDeclaration_default_instance_;
+class QueueError;
+struct QueueErrorDefaultTypeInternal;
+extern QueueErrorDefaultTypeInternal _QueueError_default_instance_;
+class QueueOptions;
+struct QueueOptionsDefaultTypeInternal;
+extern QueueOptionsDefaultTypeInternal _QueueOptions_default_instance_;
+class QueueReplication;
+struct QueueReplicationDefaultTypeInternal;
+extern QueueReplicationDefaultTypeInternal _QueueReplication_default_instance_;
+class ReplicaAction;
+struct ReplicaActionDefaultTypeInternal;
+extern ReplicaActionDefaultTypeInternal _ReplicaAction_default_instance_;
+class ReplicaBatch;
+struct ReplicaBatchDefaultTypeInternal;
+extern ReplicaBatchDefaultTypeInternal _ReplicaBatch_default_instance_;
+class ReplicaEntry;
+struct ReplicaEntryDefaultTypeInternal;
+extern ReplicaEntryDefaultTypeInternal _ReplicaEntry_default_instance_;
+class ReplicaStart;
+struct ReplicaStartDefaultTypeInternal;
+extern ReplicaStartDefaultTypeInternal _ReplicaStart_default_instance_;
+class Stat;
+struct StatDefaultTypeInternal;
+extern StatDefaultTypeInternal _Stat_default_instance_;
+class StatDump;
+struct StatDumpDefaultTypeInternal;
+extern StatDumpDefaultTypeInternal _StatDump_default_instance_;
+}  // namespace wire
+PROTOBUF_NAMESPACE_OPEN
+template<> ::wire::Action* Arena::CreateMaybeMessage<::wire::Action>(Arena*);
+template<> ::wire::BondRequest* Arena::CreateMaybeMessage<::wire::BondRequest>(Arena*);
+template<> ::wire::ConfirmRange* Arena::CreateMaybeMessage<::wire::ConfirmRange>(Arena*);
+template<> ::wire::Confirms* Arena::CreateMaybeMessage<::wire::Confirms>(Arena*);
+template<> ::wire::ConnectionConfigure* Arena::CreateMaybeMessage<::wire::ConnectionConfigure>(Arena*);
+template<> ::wire::ConnectionStat* Arena::CreateMaybeMessage<::wire::ConnectionStat>(Arena*);
+template<> ::wire::Message* Arena::CreateMaybeMessage<::wire::Message>(Arena*);
+template<> ::wire::MessageBatch* Arena::CreateMaybeMessage<::wire::MessageBatch>(Arena*);
+template<> ::wire::MessageRange* Arena::CreateMaybeMessage<::wire::MessageRange>(Arena*);
+template<> ::wire::Queue* Arena::CreateMaybeMessage<::wire::Queue>(Arena*);
+template<> ::wire::QueueConfiguration* Arena::CreateMaybeMessage<::wire::QueueConfiguration>(Arena*);
+template<> ::wire::QueueDeclaration* Arena::CreateMaybeMessage<::wire::QueueDeclaration>(Arena*);
+template<> ::wire::QueueError* Arena::CreateMaybeMessage<::wire::QueueError>(Arena*);
+template<> ::wire::QueueOptions* Arena::CreateMaybeMessage<::wire::QueueOptions>(Arena*);
+template<> ::wire::QueueReplication* Arena::CreateMaybeMessage<::wire::QueueReplication>(Arena*);
+template<> ::wire::ReplicaAction* Arena::CreateMaybeMessage<::wire::ReplicaAction>(Arena*);
+template<> ::wire::ReplicaBatch* Arena::CreateMaybeMessage<::wire::ReplicaBatch>(Arena*);
+template<> ::wire::ReplicaEntry* Arena::CreateMaybeMessage<::wire::ReplicaEntry>(Arena*);
+template<> ::wire::ReplicaStart* Arena::CreateMaybeMessage<::wire::ReplicaStart>(Arena*);
+template<> ::wire::Stat* Arena::CreateMaybeMessage<::wire::Stat>(Arena*);
+template<> ::wire::StatDump* Arena::CreateMaybeMessage<::wire::StatDump>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace wire {
 
-enum ReplicaAction_Type {
+enum ReplicaAction_Type : int {
   ReplicaAction_Type_eStart = 0,
-  ReplicaAction_Type_eReserve = 1
+  ReplicaAction_Type_eReserve = 1,
+  ReplicaAction_Type_eEntry = 2,
+  ReplicaAction_Type_eBatch = 3,
+  ReplicaAction_Type_eAck = 4
 };
 bool ReplicaAction_Type_IsValid(int value);
-const ReplicaAction_Type ReplicaAction_Type_Type_MIN = ReplicaAction_Type_eStart;
-const ReplicaAction_Type ReplicaAction_Type_Type_MAX = ReplicaAction_Type_eReserve;
-const int ReplicaAction_Type_Type_ARRAYSIZE = ReplicaAction_Type_Type_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* ReplicaAction_Type_descriptor();
-inline const ::std::string& ReplicaAction_Type_Name(ReplicaAction_Type value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    ReplicaAction_Type_descriptor(), value);
+constexpr ReplicaAction_Type ReplicaAction_Type_Type_MIN = ReplicaAction_Type_eStart;
+constexpr ReplicaAction_Type ReplicaAction_Type_Type_MAX = ReplicaAction_Type_eAck;
+constexpr int ReplicaAction_Type_Type_ARRAYSIZE = ReplicaAction_Type_Type_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ReplicaAction_Type_descriptor();
+template<typename T>
+inline const std::string& ReplicaAction_Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ReplicaAction_Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ReplicaAction_Type_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ReplicaAction_Type_descriptor(), enum_t_value);
 }
 inline bool ReplicaAction_Type_Parse(
-    const ::std::string& name, ReplicaAction_Type* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<ReplicaAction_Type>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ReplicaAction_Type* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ReplicaAction_Type>(
     ReplicaAction_Type_descriptor(), name, value);
 }
-enum QueueDeclaration_Type {
+enum ReplicaEntry_Type : int {
+  ReplicaEntry_Type_eDeclare = 0,
+  ReplicaEntry_Type_eBond = 1,
+  ReplicaEntry_Type_eAppend = 2,
+  ReplicaEntry_Type_eErase = 3,
+  ReplicaEntry_Type_eEnqueue = 4,
+  ReplicaEntry_Type_eDequeue = 5,
+  ReplicaEntry_Type_eReset = 6,
+  ReplicaEntry_Type_eSynced = 7,
+  ReplicaEntry_Type_eRequeue = 8,
+  ReplicaEntry_Type_eSchedule = 9,
+  ReplicaEntry_Type_eUnschedule = 10,
+  ReplicaEntry_Type_eResetSchedule = 11
+};
+bool ReplicaEntry_Type_IsValid(int value);
+constexpr ReplicaEntry_Type ReplicaEntry_Type_Type_MIN = ReplicaEntry_Type_eDeclare;
+constexpr ReplicaEntry_Type ReplicaEntry_Type_Type_MAX = ReplicaEntry_Type_eResetSchedule;
+constexpr int ReplicaEntry_Type_Type_ARRAYSIZE = ReplicaEntry_Type_Type_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ReplicaEntry_Type_descriptor();
+template<typename T>
+inline const std::string& ReplicaEntry_Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ReplicaEntry_Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ReplicaEntry_Type_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ReplicaEntry_Type_descriptor(), enum_t_value);
+}
+inline bool ReplicaEntry_Type_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ReplicaEntry_Type* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ReplicaEntry_Type>(
+    ReplicaEntry_Type_descriptor(), name, value);
+}
+enum QueueDeclaration_Type : int {
   QueueDeclaration_Type_eBroadcast = 0,
   QueueDeclaration_Type_eTransient = 1,
   QueueDeclaration_Type_eDurable = 2
 };
 bool QueueDeclaration_Type_IsValid(int value);
-const QueueDeclaration_Type QueueDeclaration_Type_Type_MIN = QueueDeclaration_Type_eBroadcast;
-const QueueDeclaration_Type QueueDeclaration_Type_Type_MAX = QueueDeclaration_Type_eDurable;
-const int QueueDeclaration_Type_Type_ARRAYSIZE = QueueDeclaration_Type_Type_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* QueueDeclaration_Type_descriptor();
-inline const ::std::string& QueueDeclaration_Type_Name(QueueDeclaration_Type value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    QueueDeclaration_Type_descriptor(), value);
+constexpr QueueDeclaration_Type QueueDeclaration_Type_Type_MIN = QueueDeclaration_Type_eBroadcast;
+constexpr QueueDeclaration_Type QueueDeclaration_Type_Type_MAX = QueueDeclaration_Type_eDurable;
+constexpr int QueueDeclaration_Type_Type_ARRAYSIZE = QueueDeclaration_Type_Type_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* QueueDeclaration_Type_descriptor();
+template<typename T>
+inline const std::string& QueueDeclaration_Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, QueueDeclaration_Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function QueueDeclaration_Type_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    QueueDeclaration_Type_descriptor(), enum_t_value);
 }
 inline bool QueueDeclaration_Type_Parse(
-    const ::std::string& name, QueueDeclaration_Type* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<QueueDeclaration_Type>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, QueueDeclaration_Type* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<QueueDeclaration_Type>(
     QueueDeclaration_Type_descriptor(), name, value);
 }
 // ===================================================================
 
-class Message : public ::google::protobuf::Message {
+class Message final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.Message) */ {
  public:
-  Message();
-  virtual ~Message();
+  inline Message() : Message(nullptr) {}
+  ~Message() override;
+  explicit PROTOBUF_CONSTEXPR Message(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Message(const Message& from);
+  Message(Message&& from) noexcept
+    : Message() {
+    *this = ::std::move(from);
+  }
 
   inline Message& operator=(const Message& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Message& operator=(Message&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Message& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Message& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Message* internal_default_instance() {
+    return reinterpret_cast<const Message*>(
+               &_Message_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void Swap(Message* other);
+  friend void swap(Message& a, Message& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Message* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Message* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Message* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Message* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Message>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Message& from);
-  void MergeFrom(const Message& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Message& from) {
+    Message::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Message* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.Message";
+  }
+  protected:
+  explicit Message(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kDestinationFieldNumber = 1,
+    kPayloadFieldNumber = 2,
+    kIdFieldNumber = 3,
+    kConfirmIdFieldNumber = 5,
+    kFlagsFieldNumber = 4,
+    kTtlFieldNumber = 6,
+    kExpiresFieldNumber = 7,
+    kNotBeforeFieldNumber = 8,
+    kRedeliveriesFieldNumber = 9,
+  };
   // required string destination = 1;
-  inline bool has_destination() const;
-  inline void clear_destination();
-  static const int kDestinationFieldNumber = 1;
-  inline const ::std::string& destination() const;
-  inline void set_destination(const ::std::string& value);
-  inline void set_destination(const char* value);
-  inline void set_destination(const char* value, size_t size);
-  inline ::std::string* mutable_destination();
-  inline ::std::string* release_destination();
-  inline void set_allocated_destination(::std::string* destination);
+  bool has_destination() const;
+  private:
+  bool _internal_has_destination() const;
+  public:
+  void clear_destination();
+  const std::string& destination() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_destination(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_destination();
+  PROTOBUF_NODISCARD std::string* release_destination();
+  void set_allocated_destination(std::string* destination);
+  private:
+  const std::string& _internal_destination() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_destination(const std::string& value);
+  std::string* _internal_mutable_destination();
+  public:
 
   // required bytes payload = 2;
-  inline bool has_payload() const;
-  inline void clear_payload();
-  static const int kPayloadFieldNumber = 2;
-  inline const ::std::string& payload() const;
-  inline void set_payload(const ::std::string& value);
-  inline void set_payload(const char* value);
-  inline void set_payload(const void* value, size_t size);
-  inline ::std::string* mutable_payload();
-  inline ::std::string* release_payload();
-  inline void set_allocated_payload(::std::string* payload);
+  bool has_payload() const;
+  private:
+  bool _internal_has_payload() const;
+  public:
+  void clear_payload();
+  const std::string& payload() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_payload(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_payload();
+  PROTOBUF_NODISCARD std::string* release_payload();
+  void set_allocated_payload(std::string* payload);
+  private:
+  const std::string& _internal_payload() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_payload(const std::string& value);
+  std::string* _internal_mutable_payload();
+  public:
 
   // optional uint64 id = 3;
-  inline bool has_id() const;
-  inline void clear_id();
-  static const int kIdFieldNumber = 3;
-  inline ::google::protobuf::uint64 id() const;
-  inline void set_id(::google::protobuf::uint64 value);
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  uint64_t id() const;
+  void set_id(uint64_t value);
+  private:
+  uint64_t _internal_id() const;
+  void _internal_set_id(uint64_t value);
+  public:
+
+  // optional uint64 confirm_id = 5;
+  bool has_confirm_id() const;
+  private:
+  bool _internal_has_confirm_id() const;
+  public:
+  void clear_confirm_id();
+  uint64_t confirm_id() const;
+  void set_confirm_id(uint64_t value);
+  private:
+  uint64_t _internal_confirm_id() const;
+  void _internal_set_confirm_id(uint64_t value);
+  public:
 
   // optional uint32 flags = 4;
-  inline bool has_flags() const;
-  inline void clear_flags();
-  static const int kFlagsFieldNumber = 4;
-  inline ::google::protobuf::uint32 flags() const;
-  inline void set_flags(::google::protobuf::uint32 value);
+  bool has_flags() const;
+  private:
+  bool _internal_has_flags() const;
+  public:
+  void clear_flags();
+  uint32_t flags() const;
+  void set_flags(uint32_t value);
+  private:
+  uint32_t _internal_flags() const;
+  void _internal_set_flags(uint32_t value);
+  public:
 
-  // optional uint64 confirm_id = 5;
-  inline bool has_confirm_id() const;
-  inline void clear_confirm_id();
-  static const int kConfirmIdFieldNumber = 5;
-  inline ::google::protobuf::uint64 confirm_id() const;
-  inline void set_confirm_id(::google::protobuf::uint64 value);
+  // optional uint32 ttl = 6;
+  bool has_ttl() const;
+  private:
+  bool _internal_has_ttl() const;
+  public:
+  void clear_ttl();
+  uint32_t ttl() const;
+  void set_ttl(uint32_t value);
+  private:
+  uint32_t _internal_ttl() const;
+  void _internal_set_ttl(uint32_t value);
+  public:
+
+  // optional double expires = 7;
+  bool has_expires() const;
+  private:
+  bool _internal_has_expires() const;
+  public:
+  void clear_expires();
+  double expires() const;
+  void set_expires(double value);
+  private:
+  double _internal_expires() const;
+  void _internal_set_expires(double value);
+  public:
+
+  // optional double not_before = 8;
+  bool has_not_before() const;
+  private:
+  bool _internal_has_not_before() const;
+  public:
+  void clear_not_before();
+  double not_before() const;
+  void set_not_before(double value);
+  private:
+  double _internal_not_before() const;
+  void _internal_set_not_before(double value);
+  public:
+
+  // optional uint32 redeliveries = 9;
+  bool has_redeliveries() const;
+  private:
+  bool _internal_has_redeliveries() const;
+  public:
+  void clear_redeliveries();
+  uint32_t redeliveries() const;
+  void set_redeliveries(uint32_t value);
+  private:
+  uint32_t _internal_redeliveries() const;
+  void _internal_set_redeliveries(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:wire.Message)
  private:
-  inline void set_has_destination();
-  inline void clear_has_destination();
-  inline void set_has_payload();
-  inline void clear_has_payload();
-  inline void set_has_id();
-  inline void clear_has_id();
-  inline void set_has_flags();
-  inline void clear_has_flags();
-  inline void set_has_confirm_id();
-  inline void clear_has_confirm_id();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* destination_;
-  ::std::string* payload_;
-  ::google::protobuf::uint64 id_;
-  ::google::protobuf::uint64 confirm_id_;
-  ::google::protobuf::uint32 flags_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(5 + 31) / 32];
-
-  friend void  protobuf_AddDesc_wire_2eproto();
-  friend void protobuf_AssignDesc_wire_2eproto();
-  friend void protobuf_ShutdownFile_wire_2eproto();
-
-  void InitAsDefaultInstance();
-  static Message* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr destination_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr payload_;
+    uint64_t id_;
+    uint64_t confirm_id_;
+    uint32_t flags_;
+    uint32_t ttl_;
+    double expires_;
+    double not_before_;
+    uint32_t redeliveries_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Action : public ::google::protobuf::Message {
+class Action final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.Action) */ {
  public:
-  Action();
-  virtual ~Action();
+  inline Action() : Action(nullptr) {}
+  ~Action() override;
+  explicit PROTOBUF_CONSTEXPR Action(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Action(const Action& from);
+  Action(Action&& from) noexcept
+    : Action() {
+    *this = ::std::move(from);
+  }
 
   inline Action& operator=(const Action& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Action& operator=(Action&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Action& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Action& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Action* internal_default_instance() {
+    return reinterpret_cast<const Action*>(
+               &_Action_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
-  void Swap(Action* other);
+  friend void swap(Action& a, Action& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Action* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Action* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Action* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Action* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Action>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Action& from);
-  void MergeFrom(const Action& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Action& from) {
+    Action::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Action* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.Action";
+  }
+  protected:
+  explicit Action(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // required int32 type = 1;
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 1;
-  inline ::google::protobuf::int32 type() const;
-  inline void set_type(::google::protobuf::int32 value);
-
+  enum : int {
+    kPayloadFieldNumber = 2,
+    kIdFieldNumber = 3,
+    kTypeFieldNumber = 1,
+  };
   // optional string payload = 2;
-  inline bool has_payload() const;
-  inline void clear_payload();
-  static const int kPayloadFieldNumber = 2;
-  inline const ::std::string& payload() const;
-  inline void set_payload(const ::std::string& value);
-  inline void set_payload(const char* value);
-  inline void set_payload(const char* value, size_t size);
-  inline ::std::string* mutable_payload();
-  inline ::std::string* release_payload();
-  inline void set_allocated_payload(::std::string* payload);
+  bool has_payload() const;
+  private:
+  bool _internal_has_payload() const;
+  public:
+  void clear_payload();
+  const std::string& payload() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_payload(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_payload();
+  PROTOBUF_NODISCARD std::string* release_payload();
+  void set_allocated_payload(std::string* payload);
+  private:
+  const std::string& _internal_payload() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_payload(const std::string& value);
+  std::string* _internal_mutable_payload();
+  public:
 
   // optional uint64 id = 3;
-  inline bool has_id() const;
-  inline void clear_id();
-  static const int kIdFieldNumber = 3;
-  inline ::google::protobuf::uint64 id() const;
-  inline void set_id(::google::protobuf::uint64 value);
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  uint64_t id() const;
+  void set_id(uint64_t value);
+  private:
+  uint64_t _internal_id() const;
+  void _internal_set_id(uint64_t value);
+  public:
+
+  // required int32 type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  int32_t type() const;
+  void set_type(int32_t value);
+  private:
+  int32_t _internal_type() const;
+  void _internal_set_type(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:wire.Action)
  private:
-  inline void set_has_type();
-  inline void clear_has_type();
-  inline void set_has_payload();
-  inline void clear_has_payload();
-  inline void set_has_id();
-  inline void clear_has_id();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* payload_;
-  ::google::protobuf::uint64 id_;
-  ::google::protobuf::int32 type_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
-
-  friend void  protobuf_AddDesc_wire_2eproto();
-  friend void protobuf_AssignDesc_wire_2eproto();
-  friend void protobuf_ShutdownFile_wire_2eproto();
-
-  void InitAsDefaultInstance();
-  static Action* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr payload_;
+    uint64_t id_;
+    int32_t type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BondRequest : public ::google::protobuf::Message {
+class ConfirmRange final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.ConfirmRange) */ {
  public:
-  BondRequest();
-  virtual ~BondRequest();
-
-  BondRequest(const BondRequest& from);
+  inline ConfirmRange() : ConfirmRange(nullptr) {}
+  ~ConfirmRange() override;
+  explicit PROTOBUF_CONSTEXPR ConfirmRange(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ConfirmRange(const ConfirmRange& from);
+  ConfirmRange(ConfirmRange&& from) noexcept
+    : ConfirmRange() {
+    *this = ::std::move(from);
+  }
 
-  inline BondRequest& operator=(const BondRequest& from) {
+  inline ConfirmRange& operator=(const ConfirmRange& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline ConfirmRange& operator=(ConfirmRange&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const BondRequest& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ConfirmRange& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ConfirmRange* internal_default_instance() {
+    return reinterpret_cast<const ConfirmRange*>(
+               &_ConfirmRange_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
 
-  void Swap(BondRequest* other);
+  friend void swap(ConfirmRange& a, ConfirmRange& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ConfirmRange* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ConfirmRange* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  BondRequest* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const BondRequest& from);
-  void MergeFrom(const BondRequest& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  ConfirmRange* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ConfirmRange>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ConfirmRange& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ConfirmRange& from) {
+    ConfirmRange::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // accessors -------------------------------------------------------
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ConfirmRange* other);
 
-  // required string queue = 1;
-  inline bool has_queue() const;
-  inline void clear_queue();
-  static const int kQueueFieldNumber = 1;
-  inline const ::std::string& queue() const;
-  inline void set_queue(const ::std::string& value);
-  inline void set_queue(const char* value);
-  inline void set_queue(const char* value, size_t size);
-  inline ::std::string* mutable_queue();
-  inline ::std::string* release_queue();
-  inline void set_allocated_queue(::std::string* queue);
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.ConfirmRange";
+  }
+  protected:
+  explicit ConfirmRange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // required string destination = 2;
-  inline bool has_destination() const;
-  inline void clear_destination();
-  static const int kDestinationFieldNumber = 2;
-  inline const ::std::string& destination() const;
-  inline void set_destination(const ::std::string& value);
-  inline void set_destination(const char* value);
-  inline void set_destination(const char* value, size_t size);
-  inline ::std::string* mutable_destination();
-  inline ::std::string* release_destination();
-  inline void set_allocated_destination(::std::string* destination);
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // @@protoc_insertion_point(class_scope:wire.BondRequest)
- private:
-  inline void set_has_queue();
-  inline void clear_has_queue();
-  inline void set_has_destination();
-  inline void clear_has_destination();
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  // nested types ----------------------------------------------------
 
-  ::std::string* queue_;
-  ::std::string* destination_;
+  // accessors -------------------------------------------------------
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  enum : int {
+    kFirstFieldNumber = 1,
+    kCountFieldNumber = 2,
+  };
+  // required uint64 first = 1;
+  bool has_first() const;
+  private:
+  bool _internal_has_first() const;
+  public:
+  void clear_first();
+  uint64_t first() const;
+  void set_first(uint64_t value);
+  private:
+  uint64_t _internal_first() const;
+  void _internal_set_first(uint64_t value);
+  public:
 
-  friend void  protobuf_AddDesc_wire_2eproto();
-  friend void protobuf_AssignDesc_wire_2eproto();
-  friend void protobuf_ShutdownFile_wire_2eproto();
+  // required uint64 count = 2;
+  bool has_count() const;
+  private:
+  bool _internal_has_count() const;
+  public:
+  void clear_count();
+  uint64_t count() const;
+  void set_count(uint64_t value);
+  private:
+  uint64_t _internal_count() const;
+  void _internal_set_count(uint64_t value);
+  public:
 
-  void InitAsDefaultInstance();
-  static BondRequest* default_instance_;
+  // @@protoc_insertion_point(class_scope:wire.ConfirmRange)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t first_;
+    uint64_t count_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ConnectionConfigure : public ::google::protobuf::Message {
+class Confirms final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.Confirms) */ {
  public:
-  ConnectionConfigure();
-  virtual ~ConnectionConfigure();
-
-  ConnectionConfigure(const ConnectionConfigure& from);
+  inline Confirms() : Confirms(nullptr) {}
+  ~Confirms() override;
+  explicit PROTOBUF_CONSTEXPR Confirms(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Confirms(const Confirms& from);
+  Confirms(Confirms&& from) noexcept
+    : Confirms() {
+    *this = ::std::move(from);
+  }
 
-  inline ConnectionConfigure& operator=(const ConnectionConfigure& from) {
+  inline Confirms& operator=(const Confirms& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Confirms& operator=(Confirms&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ConnectionConfigure& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Confirms& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Confirms* internal_default_instance() {
+    return reinterpret_cast<const Confirms*>(
+               &_Confirms_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
 
-  void Swap(ConnectionConfigure* other);
+  friend void swap(Confirms& a, Confirms& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Confirms* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Confirms* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  ConnectionConfigure* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ConnectionConfigure& from);
-  void MergeFrom(const ConnectionConfigure& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  Confirms* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Confirms>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Confirms& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Confirms& from) {
+    Confirms::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // nested types ----------------------------------------------------
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Confirms* other);
 
-  // accessors -------------------------------------------------------
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.Confirms";
+  }
+  protected:
+  explicit Confirms(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // optional bool tap = 1;
-  inline bool has_tap() const;
-  inline void clear_tap();
-  static const int kTapFieldNumber = 1;
-  inline bool tap() const;
-  inline void set_tap(bool value);
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // optional bool ack = 2;
-  inline bool has_ack() const;
-  inline void clear_ack();
-  static const int kAckFieldNumber = 2;
-  inline bool ack() const;
-  inline void set_ack(bool value);
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  // optional bool confirm = 3;
-  inline bool has_confirm() const;
-  inline void clear_confirm();
-  static const int kConfirmFieldNumber = 3;
-  inline bool confirm() const;
-  inline void set_confirm(bool value);
+  // nested types ----------------------------------------------------
 
-  // optional uint32 inflight = 4;
-  inline bool has_inflight() const;
-  inline void clear_inflight();
-  static const int kInflightFieldNumber = 4;
-  inline ::google::protobuf::uint32 inflight() const;
-  inline void set_inflight(::google::protobuf::uint32 value);
+  // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:wire.ConnectionConfigure)
+  enum : int {
+    kRangesFieldNumber = 1,
+  };
+  // repeated .wire.ConfirmRange ranges = 1;
+  int ranges_size() const;
+  private:
+  int _internal_ranges_size() const;
+  public:
+  void clear_ranges();
+  ::wire::ConfirmRange* mutable_ranges(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::ConfirmRange >*
+      mutable_ranges();
+  private:
+  const ::wire::ConfirmRange& _internal_ranges(int index) const;
+  ::wire::ConfirmRange* _internal_add_ranges();
+  public:
+  const ::wire::ConfirmRange& ranges(int index) const;
+  ::wire::ConfirmRange* add_ranges();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::ConfirmRange >&
+      ranges() const;
+
+  // @@protoc_insertion_point(class_scope:wire.Confirms)
  private:
-  inline void set_has_tap();
-  inline void clear_has_tap();
-  inline void set_has_ack();
-  inline void clear_has_ack();
-  inline void set_has_confirm();
-  inline void clear_has_confirm();
-  inline void set_has_inflight();
-  inline void clear_has_inflight();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  bool tap_;
-  bool ack_;
-  bool confirm_;
-  ::google::protobuf::uint32 inflight_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
-
-  friend void  protobuf_AddDesc_wire_2eproto();
-  friend void protobuf_AssignDesc_wire_2eproto();
-  friend void protobuf_ShutdownFile_wire_2eproto();
-
-  void InitAsDefaultInstance();
-  static ConnectionConfigure* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::ConfirmRange > ranges_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
 };
 // -------------------------------------------------------------------
 
-class MessageRange : public ::google::protobuf::Message {
+class BondRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.BondRequest) */ {
  public:
-  MessageRange();
-  virtual ~MessageRange();
+  inline BondRequest() : BondRequest(nullptr) {}
+  ~BondRequest() override;
+  explicit PROTOBUF_CONSTEXPR BondRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  MessageRange(const MessageRange& from);
+  BondRequest(const BondRequest& from);
+  BondRequest(BondRequest&& from) noexcept
+    : BondRequest() {
+    *this = ::std::move(from);
+  }
 
-  inline MessageRange& operator=(const MessageRange& from) {
+  inline BondRequest& operator=(const BondRequest& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline BondRequest& operator=(BondRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const MessageRange& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BondRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BondRequest* internal_default_instance() {
+    return reinterpret_cast<const BondRequest*>(
+               &_BondRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
 
-  void Swap(MessageRange* other);
+  friend void swap(BondRequest& a, BondRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BondRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BondRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  MessageRange* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const MessageRange& from);
-  void MergeFrom(const MessageRange& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  BondRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BondRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BondRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BondRequest& from) {
+    BondRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BondRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.BondRequest";
+  }
+  protected:
+  explicit BondRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // required int32 start = 1;
-  inline bool has_start() const;
-  inline void clear_start();
-  static const int kStartFieldNumber = 1;
-  inline ::google::protobuf::int32 start() const;
-  inline void set_start(::google::protobuf::int32 value);
+  enum : int {
+    kQueueFieldNumber = 1,
+    kDestinationFieldNumber = 2,
+  };
+  // required string queue = 1;
+  bool has_queue() const;
+  private:
+  bool _internal_has_queue() const;
+  public:
+  void clear_queue();
+  const std::string& queue() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_queue(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_queue();
+  PROTOBUF_NODISCARD std::string* release_queue();
+  void set_allocated_queue(std::string* queue);
+  private:
+  const std::string& _internal_queue() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_queue(const std::string& value);
+  std::string* _internal_mutable_queue();
+  public:
 
-  // required int32 count = 2;
-  inline bool has_count() const;
-  inline void clear_count();
-  static const int kCountFieldNumber = 2;
-  inline ::google::protobuf::int32 count() const;
-  inline void set_count(::google::protobuf::int32 value);
+  // required string destination = 2;
+  bool has_destination() const;
+  private:
+  bool _internal_has_destination() const;
+  public:
+  void clear_destination();
+  const std::string& destination() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_destination(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_destination();
+  PROTOBUF_NODISCARD std::string* release_destination();
+  void set_allocated_destination(std::string* destination);
+  private:
+  const std::string& _internal_destination() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_destination(const std::string& value);
+  std::string* _internal_mutable_destination();
+  public:
 
-  // @@protoc_insertion_point(class_scope:wire.MessageRange)
+  // @@protoc_insertion_point(class_scope:wire.BondRequest)
  private:
-  inline void set_has_start();
-  inline void clear_has_start();
-  inline void set_has_count();
-  inline void clear_has_count();
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr destination_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
+};
+// -------------------------------------------------------------------
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::int32 start_;
-  ::google::protobuf::int32 count_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-
-  friend void  protobuf_AddDesc_wire_2eproto();
-  friend void protobuf_AssignDesc_wire_2eproto();
-  friend void protobuf_ShutdownFile_wire_2eproto();
-
-  void InitAsDefaultInstance();
-  static MessageRange* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class Queue : public ::google::protobuf::Message {
+class ConnectionConfigure final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.ConnectionConfigure) */ {
  public:
-  Queue();
-  virtual ~Queue();
+  inline ConnectionConfigure() : ConnectionConfigure(nullptr) {}
+  ~ConnectionConfigure() override;
+  explicit PROTOBUF_CONSTEXPR ConnectionConfigure(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Queue(const Queue& from);
+  ConnectionConfigure(const ConnectionConfigure& from);
+  ConnectionConfigure(ConnectionConfigure&& from) noexcept
+    : ConnectionConfigure() {
+    *this = ::std::move(from);
+  }
 
-  inline Queue& operator=(const Queue& from) {
+  inline ConnectionConfigure& operator=(const ConnectionConfigure& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline ConnectionConfigure& operator=(ConnectionConfigure&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Queue& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ConnectionConfigure& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ConnectionConfigure* internal_default_instance() {
+    return reinterpret_cast<const ConnectionConfigure*>(
+               &_ConnectionConfigure_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
 
-  void Swap(Queue* other);
+  friend void swap(ConnectionConfigure& a, ConnectionConfigure& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ConnectionConfigure* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ConnectionConfigure* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Queue* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const Queue& from);
-  void MergeFrom(const Queue& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  ConnectionConfigure* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ConnectionConfigure>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ConnectionConfigure& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ConnectionConfigure& from) {
+    ConnectionConfigure::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ConnectionConfigure* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.ConnectionConfigure";
+  }
+  protected:
+  explicit ConnectionConfigure(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // required int32 size = 1;
-  inline bool has_size() const;
-  inline void clear_size();
-  static const int kSizeFieldNumber = 1;
-  inline ::google::protobuf::int32 size() const;
-  inline void set_size(::google::protobuf::int32 value);
+  enum : int {
+    kTapFieldNumber = 1,
+    kAckFieldNumber = 2,
+    kConfirmFieldNumber = 3,
+    kCoalesceConfirmsFieldNumber = 9,
+    kInflightFieldNumber = 4,
+    kWriteHighWaterFieldNumber = 5,
+    kWriteLowWaterFieldNumber = 6,
+    kBatchMessagesFieldNumber = 7,
+    kBatchBytesFieldNumber = 8,
+  };
+  // optional bool tap = 1;
+  bool has_tap() const;
+  private:
+  bool _internal_has_tap() const;
+  public:
+  void clear_tap();
+  bool tap() const;
+  void set_tap(bool value);
+  private:
+  bool _internal_tap() const;
+  void _internal_set_tap(bool value);
+  public:
 
-  // repeated .wire.MessageRange ranges = 2;
-  inline int ranges_size() const;
-  inline void clear_ranges();
-  static const int kRangesFieldNumber = 2;
-  inline const ::wire::MessageRange& ranges(int index) const;
-  inline ::wire::MessageRange* mutable_ranges(int index);
-  inline ::wire::MessageRange* add_ranges();
-  inline const ::google::protobuf::RepeatedPtrField< ::wire::MessageRange >&
-      ranges() const;
-  inline ::google::protobuf::RepeatedPtrField< ::wire::MessageRange >*
-      mutable_ranges();
+  // optional bool ack = 2;
+  bool has_ack() const;
+  private:
+  bool _internal_has_ack() const;
+  public:
+  void clear_ack();
+  bool ack() const;
+  void set_ack(bool value);
+  private:
+  bool _internal_ack() const;
+  void _internal_set_ack(bool value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:wire.Queue)
- private:
-  inline void set_has_size();
-  inline void clear_has_size();
+  // optional bool confirm = 3;
+  bool has_confirm() const;
+  private:
+  bool _internal_has_confirm() const;
+  public:
+  void clear_confirm();
+  bool confirm() const;
+  void set_confirm(bool value);
+  private:
+  bool _internal_confirm() const;
+  void _internal_set_confirm(bool value);
+  public:
+
+  // optional bool coalesce_confirms = 9;
+  bool has_coalesce_confirms() const;
+  private:
+  bool _internal_has_coalesce_confirms() const;
+  public:
+  void clear_coalesce_confirms();
+  bool coalesce_confirms() const;
+  void set_coalesce_confirms(bool value);
+  private:
+  bool _internal_coalesce_confirms() const;
+  void _internal_set_coalesce_confirms(bool value);
+  public:
+
+  // optional uint32 inflight = 4;
+  bool has_inflight() const;
+  private:
+  bool _internal_has_inflight() const;
+  public:
+  void clear_inflight();
+  uint32_t inflight() const;
+  void set_inflight(uint32_t value);
+  private:
+  uint32_t _internal_inflight() const;
+  void _internal_set_inflight(uint32_t value);
+  public:
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  // optional uint32 write_high_water = 5;
+  bool has_write_high_water() const;
+  private:
+  bool _internal_has_write_high_water() const;
+  public:
+  void clear_write_high_water();
+  uint32_t write_high_water() const;
+  void set_write_high_water(uint32_t value);
+  private:
+  uint32_t _internal_write_high_water() const;
+  void _internal_set_write_high_water(uint32_t value);
+  public:
 
-  ::google::protobuf::RepeatedPtrField< ::wire::MessageRange > ranges_;
-  ::google::protobuf::int32 size_;
+  // optional uint32 write_low_water = 6;
+  bool has_write_low_water() const;
+  private:
+  bool _internal_has_write_low_water() const;
+  public:
+  void clear_write_low_water();
+  uint32_t write_low_water() const;
+  void set_write_low_water(uint32_t value);
+  private:
+  uint32_t _internal_write_low_water() const;
+  void _internal_set_write_low_water(uint32_t value);
+  public:
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  // optional uint32 batch_messages = 7;
+  bool has_batch_messages() const;
+  private:
+  bool _internal_has_batch_messages() const;
+  public:
+  void clear_batch_messages();
+  uint32_t batch_messages() const;
+  void set_batch_messages(uint32_t value);
+  private:
+  uint32_t _internal_batch_messages() const;
+  void _internal_set_batch_messages(uint32_t value);
+  public:
 
-  friend void  protobuf_AddDesc_wire_2eproto();
-  friend void protobuf_AssignDesc_wire_2eproto();
-  friend void protobuf_ShutdownFile_wire_2eproto();
+  // optional uint32 batch_bytes = 8;
+  bool has_batch_bytes() const;
+  private:
+  bool _internal_has_batch_bytes() const;
+  public:
+  void clear_batch_bytes();
+  uint32_t batch_bytes() const;
+  void set_batch_bytes(uint32_t value);
+  private:
+  uint32_t _internal_batch_bytes() const;
+  void _internal_set_batch_bytes(uint32_t value);
+  public:
 
-  void InitAsDefaultInstance();
-  static Queue* default_instance_;
+  // @@protoc_insertion_point(class_scope:wire.ConnectionConfigure)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    bool tap_;
+    bool ack_;
+    bool confirm_;
+    bool coalesce_confirms_;
+    uint32_t inflight_;
+    uint32_t write_high_water_;
+    uint32_t write_low_water_;
+    uint32_t batch_messages_;
+    uint32_t batch_bytes_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Stat : public ::google::protobuf::Message {
+class MessageBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.MessageBatch) */ {
  public:
-  Stat();
-  virtual ~Stat();
-
-  Stat(const Stat& from);
+  inline MessageBatch() : MessageBatch(nullptr) {}
+  ~MessageBatch() override;
+  explicit PROTOBUF_CONSTEXPR MessageBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MessageBatch(const MessageBatch& from);
+  MessageBatch(MessageBatch&& from) noexcept
+    : MessageBatch() {
+    *this = ::std::move(from);
+  }
 
-  inline Stat& operator=(const Stat& from) {
+  inline MessageBatch& operator=(const MessageBatch& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline MessageBatch& operator=(MessageBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Stat& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MessageBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MessageBatch* internal_default_instance() {
+    return reinterpret_cast<const MessageBatch*>(
+               &_MessageBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
 
-  void Swap(Stat* other);
+  friend void swap(MessageBatch& a, MessageBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MessageBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MessageBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Stat* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const Stat& from);
-  void MergeFrom(const Stat& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  MessageBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MessageBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MessageBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MessageBatch& from) {
+    MessageBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // nested types ----------------------------------------------------
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MessageBatch* other);
 
-  // accessors -------------------------------------------------------
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.MessageBatch";
+  }
+  protected:
+  explicit MessageBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // required string name = 1;
-  inline bool has_name() const;
-  inline void clear_name();
-  static const int kNameFieldNumber = 1;
-  inline const ::std::string& name() const;
-  inline void set_name(const ::std::string& value);
-  inline void set_name(const char* value);
-  inline void set_name(const char* value, size_t size);
-  inline ::std::string* mutable_name();
-  inline ::std::string* release_name();
-  inline void set_allocated_name(::std::string* name);
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // required bool exists = 2;
-  inline bool has_exists() const;
-  inline void clear_exists();
-  static const int kExistsFieldNumber = 2;
-  inline bool exists() const;
-  inline void set_exists(bool value);
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  // optional uint32 transient_size = 3;
-  inline bool has_transient_size() const;
-  inline void clear_transient_size();
-  static const int kTransientSizeFieldNumber = 3;
-  inline ::google::protobuf::uint32 transient_size() const;
-  inline void set_transient_size(::google::protobuf::uint32 value);
+  // nested types ----------------------------------------------------
 
-  // optional uint32 durable_size = 4;
-  inline bool has_durable_size() const;
-  inline void clear_durable_size();
-  static const int kDurableSizeFieldNumber = 4;
-  inline ::google::protobuf::uint32 durable_size() const;
-  inline void set_durable_size(::google::protobuf::uint32 value);
+  // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:wire.Stat)
+  enum : int {
+    kMessagesFieldNumber = 1,
+  };
+  // repeated bytes messages = 1;
+  int messages_size() const;
+  private:
+  int _internal_messages_size() const;
+  public:
+  void clear_messages();
+  const std::string& messages(int index) const;
+  std::string* mutable_messages(int index);
+  void set_messages(int index, const std::string& value);
+  void set_messages(int index, std::string&& value);
+  void set_messages(int index, const char* value);
+  void set_messages(int index, const void* value, size_t size);
+  std::string* add_messages();
+  void add_messages(const std::string& value);
+  void add_messages(std::string&& value);
+  void add_messages(const char* value);
+  void add_messages(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& messages() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_messages();
+  private:
+  const std::string& _internal_messages(int index) const;
+  std::string* _internal_add_messages();
+  public:
+
+  // @@protoc_insertion_point(class_scope:wire.MessageBatch)
  private:
-  inline void set_has_name();
-  inline void clear_has_name();
-  inline void set_has_exists();
-  inline void clear_has_exists();
-  inline void set_has_transient_size();
-  inline void clear_has_transient_size();
-  inline void set_has_durable_size();
-  inline void clear_has_durable_size();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* name_;
-  bool exists_;
-  ::google::protobuf::uint32 transient_size_;
-  ::google::protobuf::uint32 durable_size_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
-
-  friend void  protobuf_AddDesc_wire_2eproto();
-  friend void protobuf_AssignDesc_wire_2eproto();
-  friend void protobuf_ShutdownFile_wire_2eproto();
-
-  void InitAsDefaultInstance();
-  static Stat* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> messages_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ReplicaAction : public ::google::protobuf::Message {
+class MessageRange final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.MessageRange) */ {
  public:
-  ReplicaAction();
-  virtual ~ReplicaAction();
+  inline MessageRange() : MessageRange(nullptr) {}
+  ~MessageRange() override;
+  explicit PROTOBUF_CONSTEXPR MessageRange(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ReplicaAction(const ReplicaAction& from);
+  MessageRange(const MessageRange& from);
+  MessageRange(MessageRange&& from) noexcept
+    : MessageRange() {
+    *this = ::std::move(from);
+  }
 
-  inline ReplicaAction& operator=(const ReplicaAction& from) {
+  inline MessageRange& operator=(const MessageRange& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline MessageRange& operator=(MessageRange&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ReplicaAction& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MessageRange& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MessageRange* internal_default_instance() {
+    return reinterpret_cast<const MessageRange*>(
+               &_MessageRange_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
 
-  void Swap(ReplicaAction* other);
+  friend void swap(MessageRange& a, MessageRange& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MessageRange* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MessageRange* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  ReplicaAction* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ReplicaAction& from);
-  void MergeFrom(const ReplicaAction& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  MessageRange* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MessageRange>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MessageRange& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MessageRange& from) {
+    MessageRange::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // nested types ----------------------------------------------------
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MessageRange* other);
 
-  typedef ReplicaAction_Type Type;
-  static const Type eStart = ReplicaAction_Type_eStart;
-  static const Type eReserve = ReplicaAction_Type_eReserve;
-  static inline bool Type_IsValid(int value) {
-    return ReplicaAction_Type_IsValid(value);
-  }
-  static const Type Type_MIN =
-    ReplicaAction_Type_Type_MIN;
-  static const Type Type_MAX =
-    ReplicaAction_Type_Type_MAX;
-  static const int Type_ARRAYSIZE =
-    ReplicaAction_Type_Type_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  Type_descriptor() {
-    return ReplicaAction_Type_descriptor();
-  }
-  static inline const ::std::string& Type_Name(Type value) {
-    return ReplicaAction_Type_Name(value);
-  }
-  static inline bool Type_Parse(const ::std::string& name,
-      Type* value) {
-    return ReplicaAction_Type_Parse(name, value);
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.MessageRange";
   }
+  protected:
+  explicit MessageRange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // accessors -------------------------------------------------------
-
-  // required .wire.ReplicaAction.Type type = 1;
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 1;
-  inline ::wire::ReplicaAction_Type type() const;
-  inline void set_type(::wire::ReplicaAction_Type value);
-
-  // optional bytes payload = 2;
-  inline bool has_payload() const;
-  inline void clear_payload();
-  static const int kPayloadFieldNumber = 2;
-  inline const ::std::string& payload() const;
-  inline void set_payload(const ::std::string& value);
-  inline void set_payload(const char* value);
-  inline void set_payload(const void* value, size_t size);
-  inline ::std::string* mutable_payload();
-  inline ::std::string* release_payload();
-  inline void set_allocated_payload(::std::string* payload);
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // @@protoc_insertion_point(class_scope:wire.ReplicaAction)
- private:
-  inline void set_has_type();
-  inline void clear_has_type();
-  inline void set_has_payload();
-  inline void clear_has_payload();
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  // nested types ----------------------------------------------------
 
-  ::std::string* payload_;
-  int type_;
+  // accessors -------------------------------------------------------
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  enum : int {
+    kStartFieldNumber = 1,
+    kCountFieldNumber = 2,
+  };
+  // required uint64 start = 1;
+  bool has_start() const;
+  private:
+  bool _internal_has_start() const;
+  public:
+  void clear_start();
+  uint64_t start() const;
+  void set_start(uint64_t value);
+  private:
+  uint64_t _internal_start() const;
+  void _internal_set_start(uint64_t value);
+  public:
 
-  friend void  protobuf_AddDesc_wire_2eproto();
-  friend void protobuf_AssignDesc_wire_2eproto();
-  friend void protobuf_ShutdownFile_wire_2eproto();
+  // required uint64 count = 2;
+  bool has_count() const;
+  private:
+  bool _internal_has_count() const;
+  public:
+  void clear_count();
+  uint64_t count() const;
+  void set_count(uint64_t value);
+  private:
+  uint64_t _internal_count() const;
+  void _internal_set_count(uint64_t value);
+  public:
 
-  void InitAsDefaultInstance();
-  static ReplicaAction* default_instance_;
+  // @@protoc_insertion_point(class_scope:wire.MessageRange)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t start_;
+    uint64_t count_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
 };
 // -------------------------------------------------------------------
 
-class QueueError : public ::google::protobuf::Message {
+class Queue final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.Queue) */ {
  public:
-  QueueError();
-  virtual ~QueueError();
+  inline Queue() : Queue(nullptr) {}
+  ~Queue() override;
+  explicit PROTOBUF_CONSTEXPR Queue(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  QueueError(const QueueError& from);
+  Queue(const Queue& from);
+  Queue(Queue&& from) noexcept
+    : Queue() {
+    *this = ::std::move(from);
+  }
 
-  inline QueueError& operator=(const QueueError& from) {
+  inline Queue& operator=(const Queue& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Queue& operator=(Queue&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const QueueError& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Queue& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Queue* internal_default_instance() {
+    return reinterpret_cast<const Queue*>(
+               &_Queue_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
 
-  void Swap(QueueError* other);
+  friend void swap(Queue& a, Queue& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Queue* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Queue* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  QueueError* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const QueueError& from);
-  void MergeFrom(const QueueError& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  Queue* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Queue>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Queue& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Queue& from) {
+    Queue::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // nested types ----------------------------------------------------
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Queue* other);
 
-  // accessors -------------------------------------------------------
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.Queue";
+  }
+  protected:
+  explicit Queue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // required string queue = 1;
-  inline bool has_queue() const;
-  inline void clear_queue();
-  static const int kQueueFieldNumber = 1;
-  inline const ::std::string& queue() const;
-  inline void set_queue(const ::std::string& value);
-  inline void set_queue(const char* value);
-  inline void set_queue(const char* value, size_t size);
-  inline ::std::string* mutable_queue();
-  inline ::std::string* release_queue();
-  inline void set_allocated_queue(::std::string* queue);
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // optional string error = 2;
-  inline bool has_error() const;
-  inline void clear_error();
-  static const int kErrorFieldNumber = 2;
-  inline const ::std::string& error() const;
-  inline void set_error(const ::std::string& value);
-  inline void set_error(const char* value);
-  inline void set_error(const char* value, size_t size);
-  inline ::std::string* mutable_error();
-  inline ::std::string* release_error();
-  inline void set_allocated_error(::std::string* error);
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  // @@protoc_insertion_point(class_scope:wire.QueueError)
- private:
-  inline void set_has_queue();
-  inline void clear_has_queue();
-  inline void set_has_error();
-  inline void clear_has_error();
+  // nested types ----------------------------------------------------
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  // accessors -------------------------------------------------------
 
-  ::std::string* queue_;
-  ::std::string* error_;
+  enum : int {
+    kRangesFieldNumber = 2,
+    kNextIndexFieldNumber = 3,
+    kSizeFieldNumber = 1,
+  };
+  // repeated .wire.MessageRange ranges = 2;
+  int ranges_size() const;
+  private:
+  int _internal_ranges_size() const;
+  public:
+  void clear_ranges();
+  ::wire::MessageRange* mutable_ranges(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::MessageRange >*
+      mutable_ranges();
+  private:
+  const ::wire::MessageRange& _internal_ranges(int index) const;
+  ::wire::MessageRange* _internal_add_ranges();
+  public:
+  const ::wire::MessageRange& ranges(int index) const;
+  ::wire::MessageRange* add_ranges();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::MessageRange >&
+      ranges() const;
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  // optional uint64 next_index = 3;
+  bool has_next_index() const;
+  private:
+  bool _internal_has_next_index() const;
+  public:
+  void clear_next_index();
+  uint64_t next_index() const;
+  void set_next_index(uint64_t value);
+  private:
+  uint64_t _internal_next_index() const;
+  void _internal_set_next_index(uint64_t value);
+  public:
 
-  friend void  protobuf_AddDesc_wire_2eproto();
-  friend void protobuf_AssignDesc_wire_2eproto();
-  friend void protobuf_ShutdownFile_wire_2eproto();
+  // required int32 size = 1;
+  bool has_size() const;
+  private:
+  bool _internal_has_size() const;
+  public:
+  void clear_size();
+  int32_t size() const;
+  void set_size(int32_t value);
+  private:
+  int32_t _internal_size() const;
+  void _internal_set_size(int32_t value);
+  public:
 
-  void InitAsDefaultInstance();
-  static QueueError* default_instance_;
+  // @@protoc_insertion_point(class_scope:wire.Queue)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::MessageRange > ranges_;
+    uint64_t next_index_;
+    int32_t size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
 };
 // -------------------------------------------------------------------
 
-class QueueDeclaration : public ::google::protobuf::Message {
+class Stat final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.Stat) */ {
  public:
-  QueueDeclaration();
-  virtual ~QueueDeclaration();
+  inline Stat() : Stat(nullptr) {}
+  ~Stat() override;
+  explicit PROTOBUF_CONSTEXPR Stat(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  QueueDeclaration(const QueueDeclaration& from);
+  Stat(const Stat& from);
+  Stat(Stat&& from) noexcept
+    : Stat() {
+    *this = ::std::move(from);
+  }
 
-  inline QueueDeclaration& operator=(const QueueDeclaration& from) {
+  inline Stat& operator=(const Stat& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Stat& operator=(Stat&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const QueueDeclaration& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Stat& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Stat* internal_default_instance() {
+    return reinterpret_cast<const Stat*>(
+               &_Stat_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
 
-  void Swap(QueueDeclaration* other);
+  friend void swap(Stat& a, Stat& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Stat* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Stat* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  QueueDeclaration* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const QueueDeclaration& from);
-  void MergeFrom(const QueueDeclaration& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
+  Stat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Stat>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Stat& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Stat& from) {
+    Stat::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Stat* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.Stat";
+  }
+  protected:
+  explicit Stat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
-  typedef QueueDeclaration_Type Type;
-  static const Type eBroadcast = QueueDeclaration_Type_eBroadcast;
-  static const Type eTransient = QueueDeclaration_Type_eTransient;
-  static const Type eDurable = QueueDeclaration_Type_eDurable;
-  static inline bool Type_IsValid(int value) {
-    return QueueDeclaration_Type_IsValid(value);
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kExistsFieldNumber = 2,
+    kTransientSizeFieldNumber = 3,
+    kEnqueuedFieldNumber = 5,
+    kDequeuedFieldNumber = 6,
+    kAckedFieldNumber = 7,
+    kRedeliveredFieldNumber = 8,
+    kBytesInFieldNumber = 9,
+    kDurableSizeFieldNumber = 4,
+    kSubscribersFieldNumber = 15,
+    kBytesOutFieldNumber = 10,
+    kEnqueueRateFieldNumber = 11,
+    kDequeueRateFieldNumber = 12,
+    kAckRateFieldNumber = 13,
+    kRedeliveryRateFieldNumber = 14,
+    kOldestAgeFieldNumber = 17,
+    kWriteBacklogFieldNumber = 18,
+    kInflightFieldNumber = 16,
+    kSpilledSizeFieldNumber = 20,
+    kMemoryBytesFieldNumber = 19,
+    kExpiredFieldNumber = 21,
+    kScheduledSizeFieldNumber = 22,
+  };
+  // required string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // required bool exists = 2;
+  bool has_exists() const;
+  private:
+  bool _internal_has_exists() const;
+  public:
+  void clear_exists();
+  bool exists() const;
+  void set_exists(bool value);
+  private:
+  bool _internal_exists() const;
+  void _internal_set_exists(bool value);
+  public:
+
+  // optional uint32 transient_size = 3;
+  bool has_transient_size() const;
+  private:
+  bool _internal_has_transient_size() const;
+  public:
+  void clear_transient_size();
+  uint32_t transient_size() const;
+  void set_transient_size(uint32_t value);
+  private:
+  uint32_t _internal_transient_size() const;
+  void _internal_set_transient_size(uint32_t value);
+  public:
+
+  // optional uint64 enqueued = 5;
+  bool has_enqueued() const;
+  private:
+  bool _internal_has_enqueued() const;
+  public:
+  void clear_enqueued();
+  uint64_t enqueued() const;
+  void set_enqueued(uint64_t value);
+  private:
+  uint64_t _internal_enqueued() const;
+  void _internal_set_enqueued(uint64_t value);
+  public:
+
+  // optional uint64 dequeued = 6;
+  bool has_dequeued() const;
+  private:
+  bool _internal_has_dequeued() const;
+  public:
+  void clear_dequeued();
+  uint64_t dequeued() const;
+  void set_dequeued(uint64_t value);
+  private:
+  uint64_t _internal_dequeued() const;
+  void _internal_set_dequeued(uint64_t value);
+  public:
+
+  // optional uint64 acked = 7;
+  bool has_acked() const;
+  private:
+  bool _internal_has_acked() const;
+  public:
+  void clear_acked();
+  uint64_t acked() const;
+  void set_acked(uint64_t value);
+  private:
+  uint64_t _internal_acked() const;
+  void _internal_set_acked(uint64_t value);
+  public:
+
+  // optional uint64 redelivered = 8;
+  bool has_redelivered() const;
+  private:
+  bool _internal_has_redelivered() const;
+  public:
+  void clear_redelivered();
+  uint64_t redelivered() const;
+  void set_redelivered(uint64_t value);
+  private:
+  uint64_t _internal_redelivered() const;
+  void _internal_set_redelivered(uint64_t value);
+  public:
+
+  // optional uint64 bytes_in = 9;
+  bool has_bytes_in() const;
+  private:
+  bool _internal_has_bytes_in() const;
+  public:
+  void clear_bytes_in();
+  uint64_t bytes_in() const;
+  void set_bytes_in(uint64_t value);
+  private:
+  uint64_t _internal_bytes_in() const;
+  void _internal_set_bytes_in(uint64_t value);
+  public:
+
+  // optional uint32 durable_size = 4;
+  bool has_durable_size() const;
+  private:
+  bool _internal_has_durable_size() const;
+  public:
+  void clear_durable_size();
+  uint32_t durable_size() const;
+  void set_durable_size(uint32_t value);
+  private:
+  uint32_t _internal_durable_size() const;
+  void _internal_set_durable_size(uint32_t value);
+  public:
+
+  // optional uint32 subscribers = 15;
+  bool has_subscribers() const;
+  private:
+  bool _internal_has_subscribers() const;
+  public:
+  void clear_subscribers();
+  uint32_t subscribers() const;
+  void set_subscribers(uint32_t value);
+  private:
+  uint32_t _internal_subscribers() const;
+  void _internal_set_subscribers(uint32_t value);
+  public:
+
+  // optional uint64 bytes_out = 10;
+  bool has_bytes_out() const;
+  private:
+  bool _internal_has_bytes_out() const;
+  public:
+  void clear_bytes_out();
+  uint64_t bytes_out() const;
+  void set_bytes_out(uint64_t value);
+  private:
+  uint64_t _internal_bytes_out() const;
+  void _internal_set_bytes_out(uint64_t value);
+  public:
+
+  // optional double enqueue_rate = 11;
+  bool has_enqueue_rate() const;
+  private:
+  bool _internal_has_enqueue_rate() const;
+  public:
+  void clear_enqueue_rate();
+  double enqueue_rate() const;
+  void set_enqueue_rate(double value);
+  private:
+  double _internal_enqueue_rate() const;
+  void _internal_set_enqueue_rate(double value);
+  public:
+
+  // optional double dequeue_rate = 12;
+  bool has_dequeue_rate() const;
+  private:
+  bool _internal_has_dequeue_rate() const;
+  public:
+  void clear_dequeue_rate();
+  double dequeue_rate() const;
+  void set_dequeue_rate(double value);
+  private:
+  double _internal_dequeue_rate() const;
+  void _internal_set_dequeue_rate(double value);
+  public:
+
+  // optional double ack_rate = 13;
+  bool has_ack_rate() const;
+  private:
+  bool _internal_has_ack_rate() const;
+  public:
+  void clear_ack_rate();
+  double ack_rate() const;
+  void set_ack_rate(double value);
+  private:
+  double _internal_ack_rate() const;
+  void _internal_set_ack_rate(double value);
+  public:
+
+  // optional double redelivery_rate = 14;
+  bool has_redelivery_rate() const;
+  private:
+  bool _internal_has_redelivery_rate() const;
+  public:
+  void clear_redelivery_rate();
+  double redelivery_rate() const;
+  void set_redelivery_rate(double value);
+  private:
+  double _internal_redelivery_rate() const;
+  void _internal_set_redelivery_rate(double value);
+  public:
+
+  // optional double oldest_age = 17;
+  bool has_oldest_age() const;
+  private:
+  bool _internal_has_oldest_age() const;
+  public:
+  void clear_oldest_age();
+  double oldest_age() const;
+  void set_oldest_age(double value);
+  private:
+  double _internal_oldest_age() const;
+  void _internal_set_oldest_age(double value);
+  public:
+
+  // optional uint64 write_backlog = 18;
+  bool has_write_backlog() const;
+  private:
+  bool _internal_has_write_backlog() const;
+  public:
+  void clear_write_backlog();
+  uint64_t write_backlog() const;
+  void set_write_backlog(uint64_t value);
+  private:
+  uint64_t _internal_write_backlog() const;
+  void _internal_set_write_backlog(uint64_t value);
+  public:
+
+  // optional uint32 inflight = 16;
+  bool has_inflight() const;
+  private:
+  bool _internal_has_inflight() const;
+  public:
+  void clear_inflight();
+  uint32_t inflight() const;
+  void set_inflight(uint32_t value);
+  private:
+  uint32_t _internal_inflight() const;
+  void _internal_set_inflight(uint32_t value);
+  public:
+
+  // optional uint32 spilled_size = 20;
+  bool has_spilled_size() const;
+  private:
+  bool _internal_has_spilled_size() const;
+  public:
+  void clear_spilled_size();
+  uint32_t spilled_size() const;
+  void set_spilled_size(uint32_t value);
+  private:
+  uint32_t _internal_spilled_size() const;
+  void _internal_set_spilled_size(uint32_t value);
+  public:
+
+  // optional uint64 memory_bytes = 19;
+  bool has_memory_bytes() const;
+  private:
+  bool _internal_has_memory_bytes() const;
+  public:
+  void clear_memory_bytes();
+  uint64_t memory_bytes() const;
+  void set_memory_bytes(uint64_t value);
+  private:
+  uint64_t _internal_memory_bytes() const;
+  void _internal_set_memory_bytes(uint64_t value);
+  public:
+
+  // optional uint64 expired = 21;
+  bool has_expired() const;
+  private:
+  bool _internal_has_expired() const;
+  public:
+  void clear_expired();
+  uint64_t expired() const;
+  void set_expired(uint64_t value);
+  private:
+  uint64_t _internal_expired() const;
+  void _internal_set_expired(uint64_t value);
+  public:
+
+  // optional uint32 scheduled_size = 22;
+  bool has_scheduled_size() const;
+  private:
+  bool _internal_has_scheduled_size() const;
+  public:
+  void clear_scheduled_size();
+  uint32_t scheduled_size() const;
+  void set_scheduled_size(uint32_t value);
+  private:
+  uint32_t _internal_scheduled_size() const;
+  void _internal_set_scheduled_size(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:wire.Stat)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    bool exists_;
+    uint32_t transient_size_;
+    uint64_t enqueued_;
+    uint64_t dequeued_;
+    uint64_t acked_;
+    uint64_t redelivered_;
+    uint64_t bytes_in_;
+    uint32_t durable_size_;
+    uint32_t subscribers_;
+    uint64_t bytes_out_;
+    double enqueue_rate_;
+    double dequeue_rate_;
+    double ack_rate_;
+    double redelivery_rate_;
+    double oldest_age_;
+    uint64_t write_backlog_;
+    uint32_t inflight_;
+    uint32_t spilled_size_;
+    uint64_t memory_bytes_;
+    uint64_t expired_;
+    uint32_t scheduled_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ConnectionStat final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.ConnectionStat) */ {
+ public:
+  inline ConnectionStat() : ConnectionStat(nullptr) {}
+  ~ConnectionStat() override;
+  explicit PROTOBUF_CONSTEXPR ConnectionStat(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ConnectionStat(const ConnectionStat& from);
+  ConnectionStat(ConnectionStat&& from) noexcept
+    : ConnectionStat() {
+    *this = ::std::move(from);
   }
-  static const Type Type_MIN =
-    QueueDeclaration_Type_Type_MIN;
-  static const Type Type_MAX =
-    QueueDeclaration_Type_Type_MAX;
-  static const int Type_ARRAYSIZE =
-    QueueDeclaration_Type_Type_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  Type_descriptor() {
-    return QueueDeclaration_Type_descriptor();
+
+  inline ConnectionStat& operator=(const ConnectionStat& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ConnectionStat& operator=(ConnectionStat&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
-  static inline const ::std::string& Type_Name(Type value) {
-    return QueueDeclaration_Type_Name(value);
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
-  static inline bool Type_Parse(const ::std::string& name,
-      Type* value) {
-    return QueueDeclaration_Type_Parse(name, value);
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ConnectionStat& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ConnectionStat* internal_default_instance() {
+    return reinterpret_cast<const ConnectionStat*>(
+               &_ConnectionStat_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(ConnectionStat& a, ConnectionStat& b) {
+    a.Swap(&b);
   }
+  inline void Swap(ConnectionStat* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ConnectionStat* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ConnectionStat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ConnectionStat>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ConnectionStat& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ConnectionStat& from) {
+    ConnectionStat::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ConnectionStat* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.ConnectionStat";
+  }
+  protected:
+  explicit ConnectionStat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // required string name = 1;
-  inline bool has_name() const;
-  inline void clear_name();
-  static const int kNameFieldNumber = 1;
-  inline const ::std::string& name() const;
-  inline void set_name(const ::std::string& value);
-  inline void set_name(const char* value);
-  inline void set_name(const char* value, size_t size);
-  inline ::std::string* mutable_name();
-  inline ::std::string* release_name();
-  inline void set_allocated_name(::std::string* name);
+  enum : int {
+    kFdFieldNumber = 1,
+    kSubscriptionsFieldNumber = 2,
+    kInflightFieldNumber = 3,
+    kInflightMaxFieldNumber = 4,
+    kWriteBacklogFieldNumber = 5,
+    kAckFieldNumber = 6,
+    kTapFieldNumber = 7,
+    kReplicaFieldNumber = 8,
+  };
+  // required int32 fd = 1;
+  bool has_fd() const;
+  private:
+  bool _internal_has_fd() const;
+  public:
+  void clear_fd();
+  int32_t fd() const;
+  void set_fd(int32_t value);
+  private:
+  int32_t _internal_fd() const;
+  void _internal_set_fd(int32_t value);
+  public:
 
-  // required .wire.QueueDeclaration.Type type = 2;
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 2;
-  inline ::wire::QueueDeclaration_Type type() const;
-  inline void set_type(::wire::QueueDeclaration_Type value);
+  // optional uint32 subscriptions = 2;
+  bool has_subscriptions() const;
+  private:
+  bool _internal_has_subscriptions() const;
+  public:
+  void clear_subscriptions();
+  uint32_t subscriptions() const;
+  void set_subscriptions(uint32_t value);
+  private:
+  uint32_t _internal_subscriptions() const;
+  void _internal_set_subscriptions(uint32_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:wire.QueueDeclaration)
- private:
-  inline void set_has_name();
-  inline void clear_has_name();
-  inline void set_has_type();
-  inline void clear_has_type();
+  // optional uint32 inflight = 3;
+  bool has_inflight() const;
+  private:
+  bool _internal_has_inflight() const;
+  public:
+  void clear_inflight();
+  uint32_t inflight() const;
+  void set_inflight(uint32_t value);
+  private:
+  uint32_t _internal_inflight() const;
+  void _internal_set_inflight(uint32_t value);
+  public:
+
+  // optional uint32 inflight_max = 4;
+  bool has_inflight_max() const;
+  private:
+  bool _internal_has_inflight_max() const;
+  public:
+  void clear_inflight_max();
+  uint32_t inflight_max() const;
+  void set_inflight_max(uint32_t value);
+  private:
+  uint32_t _internal_inflight_max() const;
+  void _internal_set_inflight_max(uint32_t value);
+  public:
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  // optional uint64 write_backlog = 5;
+  bool has_write_backlog() const;
+  private:
+  bool _internal_has_write_backlog() const;
+  public:
+  void clear_write_backlog();
+  uint64_t write_backlog() const;
+  void set_write_backlog(uint64_t value);
+  private:
+  uint64_t _internal_write_backlog() const;
+  void _internal_set_write_backlog(uint64_t value);
+  public:
 
-  ::std::string* name_;
-  int type_;
+  // optional bool ack = 6;
+  bool has_ack() const;
+  private:
+  bool _internal_has_ack() const;
+  public:
+  void clear_ack();
+  bool ack() const;
+  void set_ack(bool value);
+  private:
+  bool _internal_ack() const;
+  void _internal_set_ack(bool value);
+  public:
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  // optional bool tap = 7;
+  bool has_tap() const;
+  private:
+  bool _internal_has_tap() const;
+  public:
+  void clear_tap();
+  bool tap() const;
+  void set_tap(bool value);
+  private:
+  bool _internal_tap() const;
+  void _internal_set_tap(bool value);
+  public:
 
-  friend void  protobuf_AddDesc_wire_2eproto();
-  friend void protobuf_AssignDesc_wire_2eproto();
-  friend void protobuf_ShutdownFile_wire_2eproto();
+  // optional bool replica = 8;
+  bool has_replica() const;
+  private:
+  bool _internal_has_replica() const;
+  public:
+  void clear_replica();
+  bool replica() const;
+  void set_replica(bool value);
+  private:
+  bool _internal_replica() const;
+  void _internal_set_replica(bool value);
+  public:
 
-  void InitAsDefaultInstance();
-  static QueueDeclaration* default_instance_;
+  // @@protoc_insertion_point(class_scope:wire.ConnectionStat)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t fd_;
+    uint32_t subscriptions_;
+    uint32_t inflight_;
+    uint32_t inflight_max_;
+    uint64_t write_backlog_;
+    bool ack_;
+    bool tap_;
+    bool replica_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
 };
 // -------------------------------------------------------------------
 
-class QueueConfiguration : public ::google::protobuf::Message {
- public:
-  QueueConfiguration();
-  virtual ~QueueConfiguration();
+class StatDump final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.StatDump) */ {
+ public:
+  inline StatDump() : StatDump(nullptr) {}
+  ~StatDump() override;
+  explicit PROTOBUF_CONSTEXPR StatDump(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StatDump(const StatDump& from);
+  StatDump(StatDump&& from) noexcept
+    : StatDump() {
+    *this = ::std::move(from);
+  }
+
+  inline StatDump& operator=(const StatDump& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StatDump& operator=(StatDump&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StatDump& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StatDump* internal_default_instance() {
+    return reinterpret_cast<const StatDump*>(
+               &_StatDump_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(StatDump& a, StatDump& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StatDump* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StatDump* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StatDump* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StatDump>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StatDump& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StatDump& from) {
+    StatDump::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StatDump* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.StatDump";
+  }
+  protected:
+  explicit StatDump(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kQueuesFieldNumber = 1,
+    kConnectionsFieldNumber = 2,
+  };
+  // repeated .wire.Stat queues = 1;
+  int queues_size() const;
+  private:
+  int _internal_queues_size() const;
+  public:
+  void clear_queues();
+  ::wire::Stat* mutable_queues(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::Stat >*
+      mutable_queues();
+  private:
+  const ::wire::Stat& _internal_queues(int index) const;
+  ::wire::Stat* _internal_add_queues();
+  public:
+  const ::wire::Stat& queues(int index) const;
+  ::wire::Stat* add_queues();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::Stat >&
+      queues() const;
+
+  // repeated .wire.ConnectionStat connections = 2;
+  int connections_size() const;
+  private:
+  int _internal_connections_size() const;
+  public:
+  void clear_connections();
+  ::wire::ConnectionStat* mutable_connections(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::ConnectionStat >*
+      mutable_connections();
+  private:
+  const ::wire::ConnectionStat& _internal_connections(int index) const;
+  ::wire::ConnectionStat* _internal_add_connections();
+  public:
+  const ::wire::ConnectionStat& connections(int index) const;
+  ::wire::ConnectionStat* add_connections();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::ConnectionStat >&
+      connections() const;
+
+  // @@protoc_insertion_point(class_scope:wire.StatDump)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::Stat > queues_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::ConnectionStat > connections_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReplicaAction final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.ReplicaAction) */ {
+ public:
+  inline ReplicaAction() : ReplicaAction(nullptr) {}
+  ~ReplicaAction() override;
+  explicit PROTOBUF_CONSTEXPR ReplicaAction(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReplicaAction(const ReplicaAction& from);
+  ReplicaAction(ReplicaAction&& from) noexcept
+    : ReplicaAction() {
+    *this = ::std::move(from);
+  }
+
+  inline ReplicaAction& operator=(const ReplicaAction& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReplicaAction& operator=(ReplicaAction&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplicaAction& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReplicaAction* internal_default_instance() {
+    return reinterpret_cast<const ReplicaAction*>(
+               &_ReplicaAction_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(ReplicaAction& a, ReplicaAction& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReplicaAction* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplicaAction* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReplicaAction* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReplicaAction>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReplicaAction& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReplicaAction& from) {
+    ReplicaAction::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReplicaAction* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.ReplicaAction";
+  }
+  protected:
+  explicit ReplicaAction(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ReplicaAction_Type Type;
+  static constexpr Type eStart =
+    ReplicaAction_Type_eStart;
+  static constexpr Type eReserve =
+    ReplicaAction_Type_eReserve;
+  static constexpr Type eEntry =
+    ReplicaAction_Type_eEntry;
+  static constexpr Type eBatch =
+    ReplicaAction_Type_eBatch;
+  static constexpr Type eAck =
+    ReplicaAction_Type_eAck;
+  static inline bool Type_IsValid(int value) {
+    return ReplicaAction_Type_IsValid(value);
+  }
+  static constexpr Type Type_MIN =
+    ReplicaAction_Type_Type_MIN;
+  static constexpr Type Type_MAX =
+    ReplicaAction_Type_Type_MAX;
+  static constexpr int Type_ARRAYSIZE =
+    ReplicaAction_Type_Type_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Type_descriptor() {
+    return ReplicaAction_Type_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Type_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Type>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Type_Name.");
+    return ReplicaAction_Type_Name(enum_t_value);
+  }
+  static inline bool Type_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Type* value) {
+    return ReplicaAction_Type_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPayloadFieldNumber = 2,
+    kTypeFieldNumber = 1,
+    kCompressedFieldNumber = 3,
+    kLsnFieldNumber = 4,
+  };
+  // optional bytes payload = 2;
+  bool has_payload() const;
+  private:
+  bool _internal_has_payload() const;
+  public:
+  void clear_payload();
+  const std::string& payload() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_payload(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_payload();
+  PROTOBUF_NODISCARD std::string* release_payload();
+  void set_allocated_payload(std::string* payload);
+  private:
+  const std::string& _internal_payload() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_payload(const std::string& value);
+  std::string* _internal_mutable_payload();
+  public:
+
+  // required .wire.ReplicaAction.Type type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::wire::ReplicaAction_Type type() const;
+  void set_type(::wire::ReplicaAction_Type value);
+  private:
+  ::wire::ReplicaAction_Type _internal_type() const;
+  void _internal_set_type(::wire::ReplicaAction_Type value);
+  public:
+
+  // optional bool compressed = 3;
+  bool has_compressed() const;
+  private:
+  bool _internal_has_compressed() const;
+  public:
+  void clear_compressed();
+  bool compressed() const;
+  void set_compressed(bool value);
+  private:
+  bool _internal_compressed() const;
+  void _internal_set_compressed(bool value);
+  public:
+
+  // optional uint64 lsn = 4;
+  bool has_lsn() const;
+  private:
+  bool _internal_has_lsn() const;
+  public:
+  void clear_lsn();
+  uint64_t lsn() const;
+  void set_lsn(uint64_t value);
+  private:
+  uint64_t _internal_lsn() const;
+  void _internal_set_lsn(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:wire.ReplicaAction)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr payload_;
+    int type_;
+    bool compressed_;
+    uint64_t lsn_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReplicaBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.ReplicaBatch) */ {
+ public:
+  inline ReplicaBatch() : ReplicaBatch(nullptr) {}
+  ~ReplicaBatch() override;
+  explicit PROTOBUF_CONSTEXPR ReplicaBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReplicaBatch(const ReplicaBatch& from);
+  ReplicaBatch(ReplicaBatch&& from) noexcept
+    : ReplicaBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline ReplicaBatch& operator=(const ReplicaBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReplicaBatch& operator=(ReplicaBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplicaBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReplicaBatch* internal_default_instance() {
+    return reinterpret_cast<const ReplicaBatch*>(
+               &_ReplicaBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(ReplicaBatch& a, ReplicaBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReplicaBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplicaBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReplicaBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReplicaBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReplicaBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReplicaBatch& from) {
+    ReplicaBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReplicaBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.ReplicaBatch";
+  }
+  protected:
+  explicit ReplicaBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 1,
+  };
+  // repeated bytes entries = 1;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  const std::string& entries(int index) const;
+  std::string* mutable_entries(int index);
+  void set_entries(int index, const std::string& value);
+  void set_entries(int index, std::string&& value);
+  void set_entries(int index, const char* value);
+  void set_entries(int index, const void* value, size_t size);
+  std::string* add_entries();
+  void add_entries(const std::string& value);
+  void add_entries(std::string&& value);
+  void add_entries(const char* value);
+  void add_entries(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& entries() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_entries();
+  private:
+  const std::string& _internal_entries(int index) const;
+  std::string* _internal_add_entries();
+  public:
+
+  // @@protoc_insertion_point(class_scope:wire.ReplicaBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> entries_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReplicaEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.ReplicaEntry) */ {
+ public:
+  inline ReplicaEntry() : ReplicaEntry(nullptr) {}
+  ~ReplicaEntry() override;
+  explicit PROTOBUF_CONSTEXPR ReplicaEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReplicaEntry(const ReplicaEntry& from);
+  ReplicaEntry(ReplicaEntry&& from) noexcept
+    : ReplicaEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline ReplicaEntry& operator=(const ReplicaEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReplicaEntry& operator=(ReplicaEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplicaEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReplicaEntry* internal_default_instance() {
+    return reinterpret_cast<const ReplicaEntry*>(
+               &_ReplicaEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(ReplicaEntry& a, ReplicaEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReplicaEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplicaEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReplicaEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReplicaEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReplicaEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReplicaEntry& from) {
+    ReplicaEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReplicaEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.ReplicaEntry";
+  }
+  protected:
+  explicit ReplicaEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ReplicaEntry_Type Type;
+  static constexpr Type eDeclare =
+    ReplicaEntry_Type_eDeclare;
+  static constexpr Type eBond =
+    ReplicaEntry_Type_eBond;
+  static constexpr Type eAppend =
+    ReplicaEntry_Type_eAppend;
+  static constexpr Type eErase =
+    ReplicaEntry_Type_eErase;
+  static constexpr Type eEnqueue =
+    ReplicaEntry_Type_eEnqueue;
+  static constexpr Type eDequeue =
+    ReplicaEntry_Type_eDequeue;
+  static constexpr Type eReset =
+    ReplicaEntry_Type_eReset;
+  static constexpr Type eSynced =
+    ReplicaEntry_Type_eSynced;
+  static constexpr Type eRequeue =
+    ReplicaEntry_Type_eRequeue;
+  static constexpr Type eSchedule =
+    ReplicaEntry_Type_eSchedule;
+  static constexpr Type eUnschedule =
+    ReplicaEntry_Type_eUnschedule;
+  static constexpr Type eResetSchedule =
+    ReplicaEntry_Type_eResetSchedule;
+  static inline bool Type_IsValid(int value) {
+    return ReplicaEntry_Type_IsValid(value);
+  }
+  static constexpr Type Type_MIN =
+    ReplicaEntry_Type_Type_MIN;
+  static constexpr Type Type_MAX =
+    ReplicaEntry_Type_Type_MAX;
+  static constexpr int Type_ARRAYSIZE =
+    ReplicaEntry_Type_Type_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Type_descriptor() {
+    return ReplicaEntry_Type_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Type_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Type>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Type_Name.");
+    return ReplicaEntry_Type_Name(enum_t_value);
+  }
+  static inline bool Type_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Type* value) {
+    return ReplicaEntry_Type_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessagesFieldNumber = 10,
+    kQueueFieldNumber = 2,
+    kDestinationFieldNumber = 4,
+    kKeyFieldNumber = 11,
+    kMessageFieldNumber = 7,
+    kTypeFieldNumber = 1,
+    kKindFieldNumber = 3,
+    kIndexFieldNumber = 5,
+    kLsnFieldNumber = 8,
+    kEpochFieldNumber = 9,
+    kCountFieldNumber = 6,
+  };
+  // repeated .wire.Message messages = 10;
+  int messages_size() const;
+  private:
+  int _internal_messages_size() const;
+  public:
+  void clear_messages();
+  ::wire::Message* mutable_messages(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::Message >*
+      mutable_messages();
+  private:
+  const ::wire::Message& _internal_messages(int index) const;
+  ::wire::Message* _internal_add_messages();
+  public:
+  const ::wire::Message& messages(int index) const;
+  ::wire::Message* add_messages();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::Message >&
+      messages() const;
+
+  // optional string queue = 2;
+  bool has_queue() const;
+  private:
+  bool _internal_has_queue() const;
+  public:
+  void clear_queue();
+  const std::string& queue() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_queue(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_queue();
+  PROTOBUF_NODISCARD std::string* release_queue();
+  void set_allocated_queue(std::string* queue);
+  private:
+  const std::string& _internal_queue() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_queue(const std::string& value);
+  std::string* _internal_mutable_queue();
+  public:
+
+  // optional string destination = 4;
+  bool has_destination() const;
+  private:
+  bool _internal_has_destination() const;
+  public:
+  void clear_destination();
+  const std::string& destination() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_destination(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_destination();
+  PROTOBUF_NODISCARD std::string* release_destination();
+  void set_allocated_destination(std::string* destination);
+  private:
+  const std::string& _internal_destination() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_destination(const std::string& value);
+  std::string* _internal_mutable_destination();
+  public:
+
+  // optional string key = 11;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // optional .wire.Message message = 7;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const ::wire::Message& message() const;
+  PROTOBUF_NODISCARD ::wire::Message* release_message();
+  ::wire::Message* mutable_message();
+  void set_allocated_message(::wire::Message* message);
+  private:
+  const ::wire::Message& _internal_message() const;
+  ::wire::Message* _internal_mutable_message();
+  public:
+  void unsafe_arena_set_allocated_message(
+      ::wire::Message* message);
+  ::wire::Message* unsafe_arena_release_message();
+
+  // required .wire.ReplicaEntry.Type type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::wire::ReplicaEntry_Type type() const;
+  void set_type(::wire::ReplicaEntry_Type value);
+  private:
+  ::wire::ReplicaEntry_Type _internal_type() const;
+  void _internal_set_type(::wire::ReplicaEntry_Type value);
+  public:
+
+  // optional .wire.QueueDeclaration.Type kind = 3;
+  bool has_kind() const;
+  private:
+  bool _internal_has_kind() const;
+  public:
+  void clear_kind();
+  ::wire::QueueDeclaration_Type kind() const;
+  void set_kind(::wire::QueueDeclaration_Type value);
+  private:
+  ::wire::QueueDeclaration_Type _internal_kind() const;
+  void _internal_set_kind(::wire::QueueDeclaration_Type value);
+  public:
+
+  // optional uint64 index = 5;
+  bool has_index() const;
+  private:
+  bool _internal_has_index() const;
+  public:
+  void clear_index();
+  uint64_t index() const;
+  void set_index(uint64_t value);
+  private:
+  uint64_t _internal_index() const;
+  void _internal_set_index(uint64_t value);
+  public:
+
+  // optional uint64 lsn = 8;
+  bool has_lsn() const;
+  private:
+  bool _internal_has_lsn() const;
+  public:
+  void clear_lsn();
+  uint64_t lsn() const;
+  void set_lsn(uint64_t value);
+  private:
+  uint64_t _internal_lsn() const;
+  void _internal_set_lsn(uint64_t value);
+  public:
+
+  // optional uint64 epoch = 9;
+  bool has_epoch() const;
+  private:
+  bool _internal_has_epoch() const;
+  public:
+  void clear_epoch();
+  uint64_t epoch() const;
+  void set_epoch(uint64_t value);
+  private:
+  uint64_t _internal_epoch() const;
+  void _internal_set_epoch(uint64_t value);
+  public:
+
+  // optional uint32 count = 6;
+  bool has_count() const;
+  private:
+  bool _internal_has_count() const;
+  public:
+  void clear_count();
+  uint32_t count() const;
+  void set_count(uint32_t value);
+  private:
+  uint32_t _internal_count() const;
+  void _internal_set_count(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:wire.ReplicaEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::Message > messages_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr destination_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::wire::Message* message_;
+    int type_;
+    int kind_;
+    uint64_t index_;
+    uint64_t lsn_;
+    uint64_t epoch_;
+    uint32_t count_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReplicaStart final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.ReplicaStart) */ {
+ public:
+  inline ReplicaStart() : ReplicaStart(nullptr) {}
+  ~ReplicaStart() override;
+  explicit PROTOBUF_CONSTEXPR ReplicaStart(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReplicaStart(const ReplicaStart& from);
+  ReplicaStart(ReplicaStart&& from) noexcept
+    : ReplicaStart() {
+    *this = ::std::move(from);
+  }
+
+  inline ReplicaStart& operator=(const ReplicaStart& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReplicaStart& operator=(ReplicaStart&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplicaStart& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReplicaStart* internal_default_instance() {
+    return reinterpret_cast<const ReplicaStart*>(
+               &_ReplicaStart_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(ReplicaStart& a, ReplicaStart& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReplicaStart* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplicaStart* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReplicaStart* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReplicaStart>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReplicaStart& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReplicaStart& from) {
+    ReplicaStart::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReplicaStart* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.ReplicaStart";
+  }
+  protected:
+  explicit ReplicaStart(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEpochFieldNumber = 1,
+    kLsnFieldNumber = 2,
+  };
+  // optional uint64 epoch = 1;
+  bool has_epoch() const;
+  private:
+  bool _internal_has_epoch() const;
+  public:
+  void clear_epoch();
+  uint64_t epoch() const;
+  void set_epoch(uint64_t value);
+  private:
+  uint64_t _internal_epoch() const;
+  void _internal_set_epoch(uint64_t value);
+  public:
+
+  // optional uint64 lsn = 2;
+  bool has_lsn() const;
+  private:
+  bool _internal_has_lsn() const;
+  public:
+  void clear_lsn();
+  uint64_t lsn() const;
+  void set_lsn(uint64_t value);
+  private:
+  uint64_t _internal_lsn() const;
+  void _internal_set_lsn(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:wire.ReplicaStart)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t epoch_;
+    uint64_t lsn_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
+};
+// -------------------------------------------------------------------
+
+class QueueError final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.QueueError) */ {
+ public:
+  inline QueueError() : QueueError(nullptr) {}
+  ~QueueError() override;
+  explicit PROTOBUF_CONSTEXPR QueueError(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  QueueError(const QueueError& from);
+  QueueError(QueueError&& from) noexcept
+    : QueueError() {
+    *this = ::std::move(from);
+  }
+
+  inline QueueError& operator=(const QueueError& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline QueueError& operator=(QueueError&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const QueueError& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const QueueError* internal_default_instance() {
+    return reinterpret_cast<const QueueError*>(
+               &_QueueError_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(QueueError& a, QueueError& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(QueueError* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(QueueError* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  QueueError* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<QueueError>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const QueueError& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const QueueError& from) {
+    QueueError::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(QueueError* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.QueueError";
+  }
+  protected:
+  explicit QueueError(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kQueueFieldNumber = 1,
+    kErrorFieldNumber = 2,
+  };
+  // required string queue = 1;
+  bool has_queue() const;
+  private:
+  bool _internal_has_queue() const;
+  public:
+  void clear_queue();
+  const std::string& queue() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_queue(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_queue();
+  PROTOBUF_NODISCARD std::string* release_queue();
+  void set_allocated_queue(std::string* queue);
+  private:
+  const std::string& _internal_queue() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_queue(const std::string& value);
+  std::string* _internal_mutable_queue();
+  public:
+
+  // optional string error = 2;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // @@protoc_insertion_point(class_scope:wire.QueueError)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
+};
+// -------------------------------------------------------------------
+
+class QueueDeclaration final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.QueueDeclaration) */ {
+ public:
+  inline QueueDeclaration() : QueueDeclaration(nullptr) {}
+  ~QueueDeclaration() override;
+  explicit PROTOBUF_CONSTEXPR QueueDeclaration(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  QueueDeclaration(const QueueDeclaration& from);
+  QueueDeclaration(QueueDeclaration&& from) noexcept
+    : QueueDeclaration() {
+    *this = ::std::move(from);
+  }
+
+  inline QueueDeclaration& operator=(const QueueDeclaration& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline QueueDeclaration& operator=(QueueDeclaration&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const QueueDeclaration& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const QueueDeclaration* internal_default_instance() {
+    return reinterpret_cast<const QueueDeclaration*>(
+               &_QueueDeclaration_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(QueueDeclaration& a, QueueDeclaration& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(QueueDeclaration* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(QueueDeclaration* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  QueueDeclaration* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<QueueDeclaration>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const QueueDeclaration& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const QueueDeclaration& from) {
+    QueueDeclaration::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(QueueDeclaration* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.QueueDeclaration";
+  }
+  protected:
+  explicit QueueDeclaration(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef QueueDeclaration_Type Type;
+  static constexpr Type eBroadcast =
+    QueueDeclaration_Type_eBroadcast;
+  static constexpr Type eTransient =
+    QueueDeclaration_Type_eTransient;
+  static constexpr Type eDurable =
+    QueueDeclaration_Type_eDurable;
+  static inline bool Type_IsValid(int value) {
+    return QueueDeclaration_Type_IsValid(value);
+  }
+  static constexpr Type Type_MIN =
+    QueueDeclaration_Type_Type_MIN;
+  static constexpr Type Type_MAX =
+    QueueDeclaration_Type_Type_MAX;
+  static constexpr int Type_ARRAYSIZE =
+    QueueDeclaration_Type_Type_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Type_descriptor() {
+    return QueueDeclaration_Type_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Type_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Type>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Type_Name.");
+    return QueueDeclaration_Type_Name(enum_t_value);
+  }
+  static inline bool Type_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Type* value) {
+    return QueueDeclaration_Type_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kTypeFieldNumber = 2,
+    kSyncReplicasFieldNumber = 3,
+    kTtlFieldNumber = 4,
+    kAckTimeoutFieldNumber = 5,
+    kDurableSizeFieldNumber = 7,
+    kWeightFieldNumber = 6,
+    kExpiriesIndexedFieldNumber = 8,
+  };
+  // required string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // required .wire.QueueDeclaration.Type type = 2;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::wire::QueueDeclaration_Type type() const;
+  void set_type(::wire::QueueDeclaration_Type value);
+  private:
+  ::wire::QueueDeclaration_Type _internal_type() const;
+  void _internal_set_type(::wire::QueueDeclaration_Type value);
+  public:
+
+  // optional uint32 sync_replicas = 3;
+  bool has_sync_replicas() const;
+  private:
+  bool _internal_has_sync_replicas() const;
+  public:
+  void clear_sync_replicas();
+  uint32_t sync_replicas() const;
+  void set_sync_replicas(uint32_t value);
+  private:
+  uint32_t _internal_sync_replicas() const;
+  void _internal_set_sync_replicas(uint32_t value);
+  public:
+
+  // optional uint32 ttl = 4;
+  bool has_ttl() const;
+  private:
+  bool _internal_has_ttl() const;
+  public:
+  void clear_ttl();
+  uint32_t ttl() const;
+  void set_ttl(uint32_t value);
+  private:
+  uint32_t _internal_ttl() const;
+  void _internal_set_ttl(uint32_t value);
+  public:
+
+  // optional uint32 ack_timeout = 5;
+  bool has_ack_timeout() const;
+  private:
+  bool _internal_has_ack_timeout() const;
+  public:
+  void clear_ack_timeout();
+  uint32_t ack_timeout() const;
+  void set_ack_timeout(uint32_t value);
+  private:
+  uint32_t _internal_ack_timeout() const;
+  void _internal_set_ack_timeout(uint32_t value);
+  public:
+
+  // optional uint64 durable_size = 7;
+  bool has_durable_size() const;
+  private:
+  bool _internal_has_durable_size() const;
+  public:
+  void clear_durable_size();
+  uint64_t durable_size() const;
+  void set_durable_size(uint64_t value);
+  private:
+  uint64_t _internal_durable_size() const;
+  void _internal_set_durable_size(uint64_t value);
+  public:
+
+  // optional uint32 weight = 6;
+  bool has_weight() const;
+  private:
+  bool _internal_has_weight() const;
+  public:
+  void clear_weight();
+  uint32_t weight() const;
+  void set_weight(uint32_t value);
+  private:
+  uint32_t _internal_weight() const;
+  void _internal_set_weight(uint32_t value);
+  public:
+
+  // optional bool expiries_indexed = 8;
+  bool has_expiries_indexed() const;
+  private:
+  bool _internal_has_expiries_indexed() const;
+  public:
+  void clear_expiries_indexed();
+  bool expiries_indexed() const;
+  void set_expiries_indexed(bool value);
+  private:
+  bool _internal_expiries_indexed() const;
+  void _internal_set_expiries_indexed(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:wire.QueueDeclaration)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    int type_;
+    uint32_t sync_replicas_;
+    uint32_t ttl_;
+    uint32_t ack_timeout_;
+    uint64_t durable_size_;
+    uint32_t weight_;
+    bool expiries_indexed_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
+};
+// -------------------------------------------------------------------
+
+class QueueReplication final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.QueueReplication) */ {
+ public:
+  inline QueueReplication() : QueueReplication(nullptr) {}
+  ~QueueReplication() override;
+  explicit PROTOBUF_CONSTEXPR QueueReplication(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  QueueReplication(const QueueReplication& from);
+  QueueReplication(QueueReplication&& from) noexcept
+    : QueueReplication() {
+    *this = ::std::move(from);
+  }
+
+  inline QueueReplication& operator=(const QueueReplication& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline QueueReplication& operator=(QueueReplication&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const QueueReplication& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const QueueReplication* internal_default_instance() {
+    return reinterpret_cast<const QueueReplication*>(
+               &_QueueReplication_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(QueueReplication& a, QueueReplication& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(QueueReplication* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(QueueReplication* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  QueueReplication* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<QueueReplication>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const QueueReplication& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const QueueReplication& from) {
+    QueueReplication::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(QueueReplication* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.QueueReplication";
+  }
+  protected:
+  explicit QueueReplication(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kQueueFieldNumber = 1,
+    kSyncReplicasFieldNumber = 2,
+  };
+  // required string queue = 1;
+  bool has_queue() const;
+  private:
+  bool _internal_has_queue() const;
+  public:
+  void clear_queue();
+  const std::string& queue() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_queue(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_queue();
+  PROTOBUF_NODISCARD std::string* release_queue();
+  void set_allocated_queue(std::string* queue);
+  private:
+  const std::string& _internal_queue() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_queue(const std::string& value);
+  std::string* _internal_mutable_queue();
+  public:
+
+  // required uint32 sync_replicas = 2;
+  bool has_sync_replicas() const;
+  private:
+  bool _internal_has_sync_replicas() const;
+  public:
+  void clear_sync_replicas();
+  uint32_t sync_replicas() const;
+  void set_sync_replicas(uint32_t value);
+  private:
+  uint32_t _internal_sync_replicas() const;
+  void _internal_set_sync_replicas(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:wire.QueueReplication)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_;
+    uint32_t sync_replicas_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
+};
+// -------------------------------------------------------------------
+
+class QueueOptions final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.QueueOptions) */ {
+ public:
+  inline QueueOptions() : QueueOptions(nullptr) {}
+  ~QueueOptions() override;
+  explicit PROTOBUF_CONSTEXPR QueueOptions(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  QueueOptions(const QueueOptions& from);
+  QueueOptions(QueueOptions&& from) noexcept
+    : QueueOptions() {
+    *this = ::std::move(from);
+  }
+
+  inline QueueOptions& operator=(const QueueOptions& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline QueueOptions& operator=(QueueOptions&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const QueueOptions& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const QueueOptions* internal_default_instance() {
+    return reinterpret_cast<const QueueOptions*>(
+               &_QueueOptions_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(QueueOptions& a, QueueOptions& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(QueueOptions* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(QueueOptions* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  QueueOptions* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<QueueOptions>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const QueueOptions& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const QueueOptions& from) {
+    QueueOptions::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(QueueOptions* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.QueueOptions";
+  }
+  protected:
+  explicit QueueOptions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kQueueFieldNumber = 1,
+    kTtlFieldNumber = 2,
+    kAckTimeoutFieldNumber = 3,
+    kWeightFieldNumber = 4,
+  };
+  // required string queue = 1;
+  bool has_queue() const;
+  private:
+  bool _internal_has_queue() const;
+  public:
+  void clear_queue();
+  const std::string& queue() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_queue(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_queue();
+  PROTOBUF_NODISCARD std::string* release_queue();
+  void set_allocated_queue(std::string* queue);
+  private:
+  const std::string& _internal_queue() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_queue(const std::string& value);
+  std::string* _internal_mutable_queue();
+  public:
+
+  // optional uint32 ttl = 2;
+  bool has_ttl() const;
+  private:
+  bool _internal_has_ttl() const;
+  public:
+  void clear_ttl();
+  uint32_t ttl() const;
+  void set_ttl(uint32_t value);
+  private:
+  uint32_t _internal_ttl() const;
+  void _internal_set_ttl(uint32_t value);
+  public:
+
+  // optional uint32 ack_timeout = 3;
+  bool has_ack_timeout() const;
+  private:
+  bool _internal_has_ack_timeout() const;
+  public:
+  void clear_ack_timeout();
+  uint32_t ack_timeout() const;
+  void set_ack_timeout(uint32_t value);
+  private:
+  uint32_t _internal_ack_timeout() const;
+  void _internal_set_ack_timeout(uint32_t value);
+  public:
+
+  // optional uint32 weight = 4;
+  bool has_weight() const;
+  private:
+  bool _internal_has_weight() const;
+  public:
+  void clear_weight();
+  uint32_t weight() const;
+  void set_weight(uint32_t value);
+  private:
+  uint32_t _internal_weight() const;
+  void _internal_set_weight(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:wire.QueueOptions)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_;
+    uint32_t ttl_;
+    uint32_t ack_timeout_;
+    uint32_t weight_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
+};
+// -------------------------------------------------------------------
+
+class QueueConfiguration final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.QueueConfiguration) */ {
+ public:
+  inline QueueConfiguration() : QueueConfiguration(nullptr) {}
+  ~QueueConfiguration() override;
+  explicit PROTOBUF_CONSTEXPR QueueConfiguration(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  QueueConfiguration(const QueueConfiguration& from);
+  QueueConfiguration(QueueConfiguration&& from) noexcept
+    : QueueConfiguration() {
+    *this = ::std::move(from);
+  }
+
+  inline QueueConfiguration& operator=(const QueueConfiguration& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline QueueConfiguration& operator=(QueueConfiguration&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const QueueConfiguration& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const QueueConfiguration* internal_default_instance() {
+    return reinterpret_cast<const QueueConfiguration*>(
+               &_QueueConfiguration_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(QueueConfiguration& a, QueueConfiguration& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(QueueConfiguration* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(QueueConfiguration* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  QueueConfiguration* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<QueueConfiguration>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const QueueConfiguration& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const QueueConfiguration& from) {
+    QueueConfiguration::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(QueueConfiguration* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.QueueConfiguration";
+  }
+  protected:
+  explicit QueueConfiguration(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kQueuesFieldNumber = 1,
+  };
+  // repeated .wire.QueueDeclaration queues = 1;
+  int queues_size() const;
+  private:
+  int _internal_queues_size() const;
+  public:
+  void clear_queues();
+  ::wire::QueueDeclaration* mutable_queues(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::QueueDeclaration >*
+      mutable_queues();
+  private:
+  const ::wire::QueueDeclaration& _internal_queues(int index) const;
+  ::wire::QueueDeclaration* _internal_add_queues();
+  public:
+  const ::wire::QueueDeclaration& queues(int index) const;
+  ::wire::QueueDeclaration* add_queues();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::QueueDeclaration >&
+      queues() const;
+
+  // @@protoc_insertion_point(class_scope:wire.QueueConfiguration)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::QueueDeclaration > queues_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Message
+
+// required string destination = 1;
+inline bool Message::_internal_has_destination() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Message::has_destination() const {
+  return _internal_has_destination();
+}
+inline void Message::clear_destination() {
+  _impl_.destination_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Message::destination() const {
+  // @@protoc_insertion_point(field_get:wire.Message.destination)
+  return _internal_destination();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Message::set_destination(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.destination_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:wire.Message.destination)
+}
+inline std::string* Message::mutable_destination() {
+  std::string* _s = _internal_mutable_destination();
+  // @@protoc_insertion_point(field_mutable:wire.Message.destination)
+  return _s;
+}
+inline const std::string& Message::_internal_destination() const {
+  return _impl_.destination_.Get();
+}
+inline void Message::_internal_set_destination(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.destination_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Message::_internal_mutable_destination() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.destination_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Message::release_destination() {
+  // @@protoc_insertion_point(field_release:wire.Message.destination)
+  if (!_internal_has_destination()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.destination_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.destination_.IsDefault()) {
+    _impl_.destination_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Message::set_allocated_destination(std::string* destination) {
+  if (destination != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.destination_.SetAllocated(destination, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.destination_.IsDefault()) {
+    _impl_.destination_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:wire.Message.destination)
+}
+
+// required bytes payload = 2;
+inline bool Message::_internal_has_payload() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Message::has_payload() const {
+  return _internal_has_payload();
+}
+inline void Message::clear_payload() {
+  _impl_.payload_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Message::payload() const {
+  // @@protoc_insertion_point(field_get:wire.Message.payload)
+  return _internal_payload();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Message::set_payload(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.payload_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:wire.Message.payload)
+}
+inline std::string* Message::mutable_payload() {
+  std::string* _s = _internal_mutable_payload();
+  // @@protoc_insertion_point(field_mutable:wire.Message.payload)
+  return _s;
+}
+inline const std::string& Message::_internal_payload() const {
+  return _impl_.payload_.Get();
+}
+inline void Message::_internal_set_payload(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.payload_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Message::_internal_mutable_payload() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.payload_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Message::release_payload() {
+  // @@protoc_insertion_point(field_release:wire.Message.payload)
+  if (!_internal_has_payload()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.payload_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.payload_.IsDefault()) {
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Message::set_allocated_payload(std::string* payload) {
+  if (payload != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.payload_.SetAllocated(payload, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.payload_.IsDefault()) {
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:wire.Message.payload)
+}
+
+// optional uint64 id = 3;
+inline bool Message::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Message::has_id() const {
+  return _internal_has_id();
+}
+inline void Message::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t Message::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint64_t Message::id() const {
+  // @@protoc_insertion_point(field_get:wire.Message.id)
+  return _internal_id();
+}
+inline void Message::_internal_set_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.id_ = value;
+}
+inline void Message::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:wire.Message.id)
+}
+
+// optional uint32 flags = 4;
+inline bool Message::_internal_has_flags() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Message::has_flags() const {
+  return _internal_has_flags();
+}
+inline void Message::clear_flags() {
+  _impl_.flags_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t Message::_internal_flags() const {
+  return _impl_.flags_;
+}
+inline uint32_t Message::flags() const {
+  // @@protoc_insertion_point(field_get:wire.Message.flags)
+  return _internal_flags();
+}
+inline void Message::_internal_set_flags(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.flags_ = value;
+}
+inline void Message::set_flags(uint32_t value) {
+  _internal_set_flags(value);
+  // @@protoc_insertion_point(field_set:wire.Message.flags)
+}
+
+// optional uint64 confirm_id = 5;
+inline bool Message::_internal_has_confirm_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Message::has_confirm_id() const {
+  return _internal_has_confirm_id();
+}
+inline void Message::clear_confirm_id() {
+  _impl_.confirm_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t Message::_internal_confirm_id() const {
+  return _impl_.confirm_id_;
+}
+inline uint64_t Message::confirm_id() const {
+  // @@protoc_insertion_point(field_get:wire.Message.confirm_id)
+  return _internal_confirm_id();
+}
+inline void Message::_internal_set_confirm_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.confirm_id_ = value;
+}
+inline void Message::set_confirm_id(uint64_t value) {
+  _internal_set_confirm_id(value);
+  // @@protoc_insertion_point(field_set:wire.Message.confirm_id)
+}
+
+// optional uint32 ttl = 6;
+inline bool Message::_internal_has_ttl() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Message::has_ttl() const {
+  return _internal_has_ttl();
+}
+inline void Message::clear_ttl() {
+  _impl_.ttl_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t Message::_internal_ttl() const {
+  return _impl_.ttl_;
+}
+inline uint32_t Message::ttl() const {
+  // @@protoc_insertion_point(field_get:wire.Message.ttl)
+  return _internal_ttl();
+}
+inline void Message::_internal_set_ttl(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.ttl_ = value;
+}
+inline void Message::set_ttl(uint32_t value) {
+  _internal_set_ttl(value);
+  // @@protoc_insertion_point(field_set:wire.Message.ttl)
+}
+
+// optional double expires = 7;
+inline bool Message::_internal_has_expires() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Message::has_expires() const {
+  return _internal_has_expires();
+}
+inline void Message::clear_expires() {
+  _impl_.expires_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline double Message::_internal_expires() const {
+  return _impl_.expires_;
+}
+inline double Message::expires() const {
+  // @@protoc_insertion_point(field_get:wire.Message.expires)
+  return _internal_expires();
+}
+inline void Message::_internal_set_expires(double value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.expires_ = value;
+}
+inline void Message::set_expires(double value) {
+  _internal_set_expires(value);
+  // @@protoc_insertion_point(field_set:wire.Message.expires)
+}
+
+// optional double not_before = 8;
+inline bool Message::_internal_has_not_before() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Message::has_not_before() const {
+  return _internal_has_not_before();
+}
+inline void Message::clear_not_before() {
+  _impl_.not_before_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline double Message::_internal_not_before() const {
+  return _impl_.not_before_;
+}
+inline double Message::not_before() const {
+  // @@protoc_insertion_point(field_get:wire.Message.not_before)
+  return _internal_not_before();
+}
+inline void Message::_internal_set_not_before(double value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.not_before_ = value;
+}
+inline void Message::set_not_before(double value) {
+  _internal_set_not_before(value);
+  // @@protoc_insertion_point(field_set:wire.Message.not_before)
+}
+
+// optional uint32 redeliveries = 9;
+inline bool Message::_internal_has_redeliveries() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Message::has_redeliveries() const {
+  return _internal_has_redeliveries();
+}
+inline void Message::clear_redeliveries() {
+  _impl_.redeliveries_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint32_t Message::_internal_redeliveries() const {
+  return _impl_.redeliveries_;
+}
+inline uint32_t Message::redeliveries() const {
+  // @@protoc_insertion_point(field_get:wire.Message.redeliveries)
+  return _internal_redeliveries();
+}
+inline void Message::_internal_set_redeliveries(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.redeliveries_ = value;
+}
+inline void Message::set_redeliveries(uint32_t value) {
+  _internal_set_redeliveries(value);
+  // @@protoc_insertion_point(field_set:wire.Message.redeliveries)
+}
+
+// -------------------------------------------------------------------
+
+// Action
+
+// required int32 type = 1;
+inline bool Action::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Action::has_type() const {
+  return _internal_has_type();
+}
+inline void Action::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t Action::_internal_type() const {
+  return _impl_.type_;
+}
+inline int32_t Action::type() const {
+  // @@protoc_insertion_point(field_get:wire.Action.type)
+  return _internal_type();
+}
+inline void Action::_internal_set_type(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.type_ = value;
+}
+inline void Action::set_type(int32_t value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:wire.Action.type)
+}
+
+// optional string payload = 2;
+inline bool Action::_internal_has_payload() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Action::has_payload() const {
+  return _internal_has_payload();
+}
+inline void Action::clear_payload() {
+  _impl_.payload_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Action::payload() const {
+  // @@protoc_insertion_point(field_get:wire.Action.payload)
+  return _internal_payload();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Action::set_payload(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.payload_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:wire.Action.payload)
+}
+inline std::string* Action::mutable_payload() {
+  std::string* _s = _internal_mutable_payload();
+  // @@protoc_insertion_point(field_mutable:wire.Action.payload)
+  return _s;
+}
+inline const std::string& Action::_internal_payload() const {
+  return _impl_.payload_.Get();
+}
+inline void Action::_internal_set_payload(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.payload_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Action::_internal_mutable_payload() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.payload_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Action::release_payload() {
+  // @@protoc_insertion_point(field_release:wire.Action.payload)
+  if (!_internal_has_payload()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.payload_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.payload_.IsDefault()) {
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Action::set_allocated_payload(std::string* payload) {
+  if (payload != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.payload_.SetAllocated(payload, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.payload_.IsDefault()) {
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:wire.Action.payload)
+}
+
+// optional uint64 id = 3;
+inline bool Action::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Action::has_id() const {
+  return _internal_has_id();
+}
+inline void Action::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t Action::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint64_t Action::id() const {
+  // @@protoc_insertion_point(field_get:wire.Action.id)
+  return _internal_id();
+}
+inline void Action::_internal_set_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.id_ = value;
+}
+inline void Action::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:wire.Action.id)
+}
+
+// -------------------------------------------------------------------
+
+// ConfirmRange
+
+// required uint64 first = 1;
+inline bool ConfirmRange::_internal_has_first() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ConfirmRange::has_first() const {
+  return _internal_has_first();
+}
+inline void ConfirmRange::clear_first() {
+  _impl_.first_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t ConfirmRange::_internal_first() const {
+  return _impl_.first_;
+}
+inline uint64_t ConfirmRange::first() const {
+  // @@protoc_insertion_point(field_get:wire.ConfirmRange.first)
+  return _internal_first();
+}
+inline void ConfirmRange::_internal_set_first(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.first_ = value;
+}
+inline void ConfirmRange::set_first(uint64_t value) {
+  _internal_set_first(value);
+  // @@protoc_insertion_point(field_set:wire.ConfirmRange.first)
+}
+
+// required uint64 count = 2;
+inline bool ConfirmRange::_internal_has_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ConfirmRange::has_count() const {
+  return _internal_has_count();
+}
+inline void ConfirmRange::clear_count() {
+  _impl_.count_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t ConfirmRange::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint64_t ConfirmRange::count() const {
+  // @@protoc_insertion_point(field_get:wire.ConfirmRange.count)
+  return _internal_count();
+}
+inline void ConfirmRange::_internal_set_count(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.count_ = value;
+}
+inline void ConfirmRange::set_count(uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:wire.ConfirmRange.count)
+}
+
+// -------------------------------------------------------------------
+
+// Confirms
+
+// repeated .wire.ConfirmRange ranges = 1;
+inline int Confirms::_internal_ranges_size() const {
+  return _impl_.ranges_.size();
+}
+inline int Confirms::ranges_size() const {
+  return _internal_ranges_size();
+}
+inline void Confirms::clear_ranges() {
+  _impl_.ranges_.Clear();
+}
+inline ::wire::ConfirmRange* Confirms::mutable_ranges(int index) {
+  // @@protoc_insertion_point(field_mutable:wire.Confirms.ranges)
+  return _impl_.ranges_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::ConfirmRange >*
+Confirms::mutable_ranges() {
+  // @@protoc_insertion_point(field_mutable_list:wire.Confirms.ranges)
+  return &_impl_.ranges_;
+}
+inline const ::wire::ConfirmRange& Confirms::_internal_ranges(int index) const {
+  return _impl_.ranges_.Get(index);
+}
+inline const ::wire::ConfirmRange& Confirms::ranges(int index) const {
+  // @@protoc_insertion_point(field_get:wire.Confirms.ranges)
+  return _internal_ranges(index);
+}
+inline ::wire::ConfirmRange* Confirms::_internal_add_ranges() {
+  return _impl_.ranges_.Add();
+}
+inline ::wire::ConfirmRange* Confirms::add_ranges() {
+  ::wire::ConfirmRange* _add = _internal_add_ranges();
+  // @@protoc_insertion_point(field_add:wire.Confirms.ranges)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::ConfirmRange >&
+Confirms::ranges() const {
+  // @@protoc_insertion_point(field_list:wire.Confirms.ranges)
+  return _impl_.ranges_;
+}
+
+// -------------------------------------------------------------------
+
+// BondRequest
+
+// required string queue = 1;
+inline bool BondRequest::_internal_has_queue() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool BondRequest::has_queue() const {
+  return _internal_has_queue();
+}
+inline void BondRequest::clear_queue() {
+  _impl_.queue_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& BondRequest::queue() const {
+  // @@protoc_insertion_point(field_get:wire.BondRequest.queue)
+  return _internal_queue();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BondRequest::set_queue(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.queue_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:wire.BondRequest.queue)
+}
+inline std::string* BondRequest::mutable_queue() {
+  std::string* _s = _internal_mutable_queue();
+  // @@protoc_insertion_point(field_mutable:wire.BondRequest.queue)
+  return _s;
+}
+inline const std::string& BondRequest::_internal_queue() const {
+  return _impl_.queue_.Get();
+}
+inline void BondRequest::_internal_set_queue(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.queue_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BondRequest::_internal_mutable_queue() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.queue_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BondRequest::release_queue() {
+  // @@protoc_insertion_point(field_release:wire.BondRequest.queue)
+  if (!_internal_has_queue()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.queue_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.queue_.IsDefault()) {
+    _impl_.queue_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void BondRequest::set_allocated_queue(std::string* queue) {
+  if (queue != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.queue_.SetAllocated(queue, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.queue_.IsDefault()) {
+    _impl_.queue_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:wire.BondRequest.queue)
+}
+
+// required string destination = 2;
+inline bool BondRequest::_internal_has_destination() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool BondRequest::has_destination() const {
+  return _internal_has_destination();
+}
+inline void BondRequest::clear_destination() {
+  _impl_.destination_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& BondRequest::destination() const {
+  // @@protoc_insertion_point(field_get:wire.BondRequest.destination)
+  return _internal_destination();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BondRequest::set_destination(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.destination_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:wire.BondRequest.destination)
+}
+inline std::string* BondRequest::mutable_destination() {
+  std::string* _s = _internal_mutable_destination();
+  // @@protoc_insertion_point(field_mutable:wire.BondRequest.destination)
+  return _s;
+}
+inline const std::string& BondRequest::_internal_destination() const {
+  return _impl_.destination_.Get();
+}
+inline void BondRequest::_internal_set_destination(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.destination_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BondRequest::_internal_mutable_destination() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.destination_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BondRequest::release_destination() {
+  // @@protoc_insertion_point(field_release:wire.BondRequest.destination)
+  if (!_internal_has_destination()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.destination_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.destination_.IsDefault()) {
+    _impl_.destination_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void BondRequest::set_allocated_destination(std::string* destination) {
+  if (destination != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.destination_.SetAllocated(destination, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.destination_.IsDefault()) {
+    _impl_.destination_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:wire.BondRequest.destination)
+}
+
+// -------------------------------------------------------------------
+
+// ConnectionConfigure
+
+// optional bool tap = 1;
+inline bool ConnectionConfigure::_internal_has_tap() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ConnectionConfigure::has_tap() const {
+  return _internal_has_tap();
+}
+inline void ConnectionConfigure::clear_tap() {
+  _impl_.tap_ = false;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline bool ConnectionConfigure::_internal_tap() const {
+  return _impl_.tap_;
+}
+inline bool ConnectionConfigure::tap() const {
+  // @@protoc_insertion_point(field_get:wire.ConnectionConfigure.tap)
+  return _internal_tap();
+}
+inline void ConnectionConfigure::_internal_set_tap(bool value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.tap_ = value;
+}
+inline void ConnectionConfigure::set_tap(bool value) {
+  _internal_set_tap(value);
+  // @@protoc_insertion_point(field_set:wire.ConnectionConfigure.tap)
+}
+
+// optional bool ack = 2;
+inline bool ConnectionConfigure::_internal_has_ack() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ConnectionConfigure::has_ack() const {
+  return _internal_has_ack();
+}
+inline void ConnectionConfigure::clear_ack() {
+  _impl_.ack_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool ConnectionConfigure::_internal_ack() const {
+  return _impl_.ack_;
+}
+inline bool ConnectionConfigure::ack() const {
+  // @@protoc_insertion_point(field_get:wire.ConnectionConfigure.ack)
+  return _internal_ack();
+}
+inline void ConnectionConfigure::_internal_set_ack(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.ack_ = value;
+}
+inline void ConnectionConfigure::set_ack(bool value) {
+  _internal_set_ack(value);
+  // @@protoc_insertion_point(field_set:wire.ConnectionConfigure.ack)
+}
+
+// optional bool confirm = 3;
+inline bool ConnectionConfigure::_internal_has_confirm() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ConnectionConfigure::has_confirm() const {
+  return _internal_has_confirm();
+}
+inline void ConnectionConfigure::clear_confirm() {
+  _impl_.confirm_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool ConnectionConfigure::_internal_confirm() const {
+  return _impl_.confirm_;
+}
+inline bool ConnectionConfigure::confirm() const {
+  // @@protoc_insertion_point(field_get:wire.ConnectionConfigure.confirm)
+  return _internal_confirm();
+}
+inline void ConnectionConfigure::_internal_set_confirm(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.confirm_ = value;
+}
+inline void ConnectionConfigure::set_confirm(bool value) {
+  _internal_set_confirm(value);
+  // @@protoc_insertion_point(field_set:wire.ConnectionConfigure.confirm)
+}
+
+// optional uint32 inflight = 4;
+inline bool ConnectionConfigure::_internal_has_inflight() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool ConnectionConfigure::has_inflight() const {
+  return _internal_has_inflight();
+}
+inline void ConnectionConfigure::clear_inflight() {
+  _impl_.inflight_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t ConnectionConfigure::_internal_inflight() const {
+  return _impl_.inflight_;
+}
+inline uint32_t ConnectionConfigure::inflight() const {
+  // @@protoc_insertion_point(field_get:wire.ConnectionConfigure.inflight)
+  return _internal_inflight();
+}
+inline void ConnectionConfigure::_internal_set_inflight(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.inflight_ = value;
+}
+inline void ConnectionConfigure::set_inflight(uint32_t value) {
+  _internal_set_inflight(value);
+  // @@protoc_insertion_point(field_set:wire.ConnectionConfigure.inflight)
+}
+
+// optional uint32 write_high_water = 5;
+inline bool ConnectionConfigure::_internal_has_write_high_water() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool ConnectionConfigure::has_write_high_water() const {
+  return _internal_has_write_high_water();
+}
+inline void ConnectionConfigure::clear_write_high_water() {
+  _impl_.write_high_water_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t ConnectionConfigure::_internal_write_high_water() const {
+  return _impl_.write_high_water_;
+}
+inline uint32_t ConnectionConfigure::write_high_water() const {
+  // @@protoc_insertion_point(field_get:wire.ConnectionConfigure.write_high_water)
+  return _internal_write_high_water();
+}
+inline void ConnectionConfigure::_internal_set_write_high_water(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.write_high_water_ = value;
+}
+inline void ConnectionConfigure::set_write_high_water(uint32_t value) {
+  _internal_set_write_high_water(value);
+  // @@protoc_insertion_point(field_set:wire.ConnectionConfigure.write_high_water)
+}
+
+// optional uint32 write_low_water = 6;
+inline bool ConnectionConfigure::_internal_has_write_low_water() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool ConnectionConfigure::has_write_low_water() const {
+  return _internal_has_write_low_water();
+}
+inline void ConnectionConfigure::clear_write_low_water() {
+  _impl_.write_low_water_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t ConnectionConfigure::_internal_write_low_water() const {
+  return _impl_.write_low_water_;
+}
+inline uint32_t ConnectionConfigure::write_low_water() const {
+  // @@protoc_insertion_point(field_get:wire.ConnectionConfigure.write_low_water)
+  return _internal_write_low_water();
+}
+inline void ConnectionConfigure::_internal_set_write_low_water(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.write_low_water_ = value;
+}
+inline void ConnectionConfigure::set_write_low_water(uint32_t value) {
+  _internal_set_write_low_water(value);
+  // @@protoc_insertion_point(field_set:wire.ConnectionConfigure.write_low_water)
+}
+
+// optional uint32 batch_messages = 7;
+inline bool ConnectionConfigure::_internal_has_batch_messages() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool ConnectionConfigure::has_batch_messages() const {
+  return _internal_has_batch_messages();
+}
+inline void ConnectionConfigure::clear_batch_messages() {
+  _impl_.batch_messages_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint32_t ConnectionConfigure::_internal_batch_messages() const {
+  return _impl_.batch_messages_;
+}
+inline uint32_t ConnectionConfigure::batch_messages() const {
+  // @@protoc_insertion_point(field_get:wire.ConnectionConfigure.batch_messages)
+  return _internal_batch_messages();
+}
+inline void ConnectionConfigure::_internal_set_batch_messages(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.batch_messages_ = value;
+}
+inline void ConnectionConfigure::set_batch_messages(uint32_t value) {
+  _internal_set_batch_messages(value);
+  // @@protoc_insertion_point(field_set:wire.ConnectionConfigure.batch_messages)
+}
+
+// optional uint32 batch_bytes = 8;
+inline bool ConnectionConfigure::_internal_has_batch_bytes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool ConnectionConfigure::has_batch_bytes() const {
+  return _internal_has_batch_bytes();
+}
+inline void ConnectionConfigure::clear_batch_bytes() {
+  _impl_.batch_bytes_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint32_t ConnectionConfigure::_internal_batch_bytes() const {
+  return _impl_.batch_bytes_;
+}
+inline uint32_t ConnectionConfigure::batch_bytes() const {
+  // @@protoc_insertion_point(field_get:wire.ConnectionConfigure.batch_bytes)
+  return _internal_batch_bytes();
+}
+inline void ConnectionConfigure::_internal_set_batch_bytes(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.batch_bytes_ = value;
+}
+inline void ConnectionConfigure::set_batch_bytes(uint32_t value) {
+  _internal_set_batch_bytes(value);
+  // @@protoc_insertion_point(field_set:wire.ConnectionConfigure.batch_bytes)
+}
+
+// optional bool coalesce_confirms = 9;
+inline bool ConnectionConfigure::_internal_has_coalesce_confirms() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ConnectionConfigure::has_coalesce_confirms() const {
+  return _internal_has_coalesce_confirms();
+}
+inline void ConnectionConfigure::clear_coalesce_confirms() {
+  _impl_.coalesce_confirms_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool ConnectionConfigure::_internal_coalesce_confirms() const {
+  return _impl_.coalesce_confirms_;
+}
+inline bool ConnectionConfigure::coalesce_confirms() const {
+  // @@protoc_insertion_point(field_get:wire.ConnectionConfigure.coalesce_confirms)
+  return _internal_coalesce_confirms();
+}
+inline void ConnectionConfigure::_internal_set_coalesce_confirms(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.coalesce_confirms_ = value;
+}
+inline void ConnectionConfigure::set_coalesce_confirms(bool value) {
+  _internal_set_coalesce_confirms(value);
+  // @@protoc_insertion_point(field_set:wire.ConnectionConfigure.coalesce_confirms)
+}
+
+// -------------------------------------------------------------------
+
+// MessageBatch
+
+// repeated bytes messages = 1;
+inline int MessageBatch::_internal_messages_size() const {
+  return _impl_.messages_.size();
+}
+inline int MessageBatch::messages_size() const {
+  return _internal_messages_size();
+}
+inline void MessageBatch::clear_messages() {
+  _impl_.messages_.Clear();
+}
+inline std::string* MessageBatch::add_messages() {
+  std::string* _s = _internal_add_messages();
+  // @@protoc_insertion_point(field_add_mutable:wire.MessageBatch.messages)
+  return _s;
+}
+inline const std::string& MessageBatch::_internal_messages(int index) const {
+  return _impl_.messages_.Get(index);
+}
+inline const std::string& MessageBatch::messages(int index) const {
+  // @@protoc_insertion_point(field_get:wire.MessageBatch.messages)
+  return _internal_messages(index);
+}
+inline std::string* MessageBatch::mutable_messages(int index) {
+  // @@protoc_insertion_point(field_mutable:wire.MessageBatch.messages)
+  return _impl_.messages_.Mutable(index);
+}
+inline void MessageBatch::set_messages(int index, const std::string& value) {
+  _impl_.messages_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:wire.MessageBatch.messages)
+}
+inline void MessageBatch::set_messages(int index, std::string&& value) {
+  _impl_.messages_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:wire.MessageBatch.messages)
+}
+inline void MessageBatch::set_messages(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.messages_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:wire.MessageBatch.messages)
+}
+inline void MessageBatch::set_messages(int index, const void* value, size_t size) {
+  _impl_.messages_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:wire.MessageBatch.messages)
+}
+inline std::string* MessageBatch::_internal_add_messages() {
+  return _impl_.messages_.Add();
+}
+inline void MessageBatch::add_messages(const std::string& value) {
+  _impl_.messages_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:wire.MessageBatch.messages)
+}
+inline void MessageBatch::add_messages(std::string&& value) {
+  _impl_.messages_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:wire.MessageBatch.messages)
+}
+inline void MessageBatch::add_messages(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.messages_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:wire.MessageBatch.messages)
+}
+inline void MessageBatch::add_messages(const void* value, size_t size) {
+  _impl_.messages_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:wire.MessageBatch.messages)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+MessageBatch::messages() const {
+  // @@protoc_insertion_point(field_list:wire.MessageBatch.messages)
+  return _impl_.messages_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+MessageBatch::mutable_messages() {
+  // @@protoc_insertion_point(field_mutable_list:wire.MessageBatch.messages)
+  return &_impl_.messages_;
+}
+
+// -------------------------------------------------------------------
+
+// MessageRange
+
+// required uint64 start = 1;
+inline bool MessageRange::_internal_has_start() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool MessageRange::has_start() const {
+  return _internal_has_start();
+}
+inline void MessageRange::clear_start() {
+  _impl_.start_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t MessageRange::_internal_start() const {
+  return _impl_.start_;
+}
+inline uint64_t MessageRange::start() const {
+  // @@protoc_insertion_point(field_get:wire.MessageRange.start)
+  return _internal_start();
+}
+inline void MessageRange::_internal_set_start(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.start_ = value;
+}
+inline void MessageRange::set_start(uint64_t value) {
+  _internal_set_start(value);
+  // @@protoc_insertion_point(field_set:wire.MessageRange.start)
+}
+
+// required uint64 count = 2;
+inline bool MessageRange::_internal_has_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool MessageRange::has_count() const {
+  return _internal_has_count();
+}
+inline void MessageRange::clear_count() {
+  _impl_.count_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t MessageRange::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint64_t MessageRange::count() const {
+  // @@protoc_insertion_point(field_get:wire.MessageRange.count)
+  return _internal_count();
+}
+inline void MessageRange::_internal_set_count(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.count_ = value;
+}
+inline void MessageRange::set_count(uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:wire.MessageRange.count)
+}
+
+// -------------------------------------------------------------------
+
+// Queue
+
+// required int32 size = 1;
+inline bool Queue::_internal_has_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Queue::has_size() const {
+  return _internal_has_size();
+}
+inline void Queue::clear_size() {
+  _impl_.size_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t Queue::_internal_size() const {
+  return _impl_.size_;
+}
+inline int32_t Queue::size() const {
+  // @@protoc_insertion_point(field_get:wire.Queue.size)
+  return _internal_size();
+}
+inline void Queue::_internal_set_size(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.size_ = value;
+}
+inline void Queue::set_size(int32_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:wire.Queue.size)
+}
+
+// repeated .wire.MessageRange ranges = 2;
+inline int Queue::_internal_ranges_size() const {
+  return _impl_.ranges_.size();
+}
+inline int Queue::ranges_size() const {
+  return _internal_ranges_size();
+}
+inline void Queue::clear_ranges() {
+  _impl_.ranges_.Clear();
+}
+inline ::wire::MessageRange* Queue::mutable_ranges(int index) {
+  // @@protoc_insertion_point(field_mutable:wire.Queue.ranges)
+  return _impl_.ranges_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::MessageRange >*
+Queue::mutable_ranges() {
+  // @@protoc_insertion_point(field_mutable_list:wire.Queue.ranges)
+  return &_impl_.ranges_;
+}
+inline const ::wire::MessageRange& Queue::_internal_ranges(int index) const {
+  return _impl_.ranges_.Get(index);
+}
+inline const ::wire::MessageRange& Queue::ranges(int index) const {
+  // @@protoc_insertion_point(field_get:wire.Queue.ranges)
+  return _internal_ranges(index);
+}
+inline ::wire::MessageRange* Queue::_internal_add_ranges() {
+  return _impl_.ranges_.Add();
+}
+inline ::wire::MessageRange* Queue::add_ranges() {
+  ::wire::MessageRange* _add = _internal_add_ranges();
+  // @@protoc_insertion_point(field_add:wire.Queue.ranges)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::MessageRange >&
+Queue::ranges() const {
+  // @@protoc_insertion_point(field_list:wire.Queue.ranges)
+  return _impl_.ranges_;
+}
+
+// optional uint64 next_index = 3;
+inline bool Queue::_internal_has_next_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Queue::has_next_index() const {
+  return _internal_has_next_index();
+}
+inline void Queue::clear_next_index() {
+  _impl_.next_index_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t Queue::_internal_next_index() const {
+  return _impl_.next_index_;
+}
+inline uint64_t Queue::next_index() const {
+  // @@protoc_insertion_point(field_get:wire.Queue.next_index)
+  return _internal_next_index();
+}
+inline void Queue::_internal_set_next_index(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.next_index_ = value;
+}
+inline void Queue::set_next_index(uint64_t value) {
+  _internal_set_next_index(value);
+  // @@protoc_insertion_point(field_set:wire.Queue.next_index)
+}
+
+// -------------------------------------------------------------------
+
+// Stat
+
+// required string name = 1;
+inline bool Stat::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Stat::has_name() const {
+  return _internal_has_name();
+}
+inline void Stat::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Stat::name() const {
+  // @@protoc_insertion_point(field_get:wire.Stat.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Stat::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:wire.Stat.name)
+}
+inline std::string* Stat::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:wire.Stat.name)
+  return _s;
+}
+inline const std::string& Stat::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Stat::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Stat::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Stat::release_name() {
+  // @@protoc_insertion_point(field_release:wire.Stat.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Stat::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:wire.Stat.name)
+}
+
+// required bool exists = 2;
+inline bool Stat::_internal_has_exists() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Stat::has_exists() const {
+  return _internal_has_exists();
+}
+inline void Stat::clear_exists() {
+  _impl_.exists_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool Stat::_internal_exists() const {
+  return _impl_.exists_;
+}
+inline bool Stat::exists() const {
+  // @@protoc_insertion_point(field_get:wire.Stat.exists)
+  return _internal_exists();
+}
+inline void Stat::_internal_set_exists(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.exists_ = value;
+}
+inline void Stat::set_exists(bool value) {
+  _internal_set_exists(value);
+  // @@protoc_insertion_point(field_set:wire.Stat.exists)
+}
+
+// optional uint32 transient_size = 3;
+inline bool Stat::_internal_has_transient_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Stat::has_transient_size() const {
+  return _internal_has_transient_size();
+}
+inline void Stat::clear_transient_size() {
+  _impl_.transient_size_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t Stat::_internal_transient_size() const {
+  return _impl_.transient_size_;
+}
+inline uint32_t Stat::transient_size() const {
+  // @@protoc_insertion_point(field_get:wire.Stat.transient_size)
+  return _internal_transient_size();
+}
+inline void Stat::_internal_set_transient_size(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.transient_size_ = value;
+}
+inline void Stat::set_transient_size(uint32_t value) {
+  _internal_set_transient_size(value);
+  // @@protoc_insertion_point(field_set:wire.Stat.transient_size)
+}
+
+// optional uint32 durable_size = 4;
+inline bool Stat::_internal_has_durable_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Stat::has_durable_size() const {
+  return _internal_has_durable_size();
+}
+inline void Stat::clear_durable_size() {
+  _impl_.durable_size_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint32_t Stat::_internal_durable_size() const {
+  return _impl_.durable_size_;
+}
+inline uint32_t Stat::durable_size() const {
+  // @@protoc_insertion_point(field_get:wire.Stat.durable_size)
+  return _internal_durable_size();
+}
+inline void Stat::_internal_set_durable_size(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.durable_size_ = value;
+}
+inline void Stat::set_durable_size(uint32_t value) {
+  _internal_set_durable_size(value);
+  // @@protoc_insertion_point(field_set:wire.Stat.durable_size)
+}
+
+// optional uint64 enqueued = 5;
+inline bool Stat::_internal_has_enqueued() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Stat::has_enqueued() const {
+  return _internal_has_enqueued();
+}
+inline void Stat::clear_enqueued() {
+  _impl_.enqueued_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t Stat::_internal_enqueued() const {
+  return _impl_.enqueued_;
+}
+inline uint64_t Stat::enqueued() const {
+  // @@protoc_insertion_point(field_get:wire.Stat.enqueued)
+  return _internal_enqueued();
+}
+inline void Stat::_internal_set_enqueued(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.enqueued_ = value;
+}
+inline void Stat::set_enqueued(uint64_t value) {
+  _internal_set_enqueued(value);
+  // @@protoc_insertion_point(field_set:wire.Stat.enqueued)
+}
+
+// optional uint64 dequeued = 6;
+inline bool Stat::_internal_has_dequeued() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Stat::has_dequeued() const {
+  return _internal_has_dequeued();
+}
+inline void Stat::clear_dequeued() {
+  _impl_.dequeued_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t Stat::_internal_dequeued() const {
+  return _impl_.dequeued_;
+}
+inline uint64_t Stat::dequeued() const {
+  // @@protoc_insertion_point(field_get:wire.Stat.dequeued)
+  return _internal_dequeued();
+}
+inline void Stat::_internal_set_dequeued(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.dequeued_ = value;
+}
+inline void Stat::set_dequeued(uint64_t value) {
+  _internal_set_dequeued(value);
+  // @@protoc_insertion_point(field_set:wire.Stat.dequeued)
+}
+
+// optional uint64 acked = 7;
+inline bool Stat::_internal_has_acked() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Stat::has_acked() const {
+  return _internal_has_acked();
+}
+inline void Stat::clear_acked() {
+  _impl_.acked_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint64_t Stat::_internal_acked() const {
+  return _impl_.acked_;
+}
+inline uint64_t Stat::acked() const {
+  // @@protoc_insertion_point(field_get:wire.Stat.acked)
+  return _internal_acked();
+}
+inline void Stat::_internal_set_acked(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.acked_ = value;
+}
+inline void Stat::set_acked(uint64_t value) {
+  _internal_set_acked(value);
+  // @@protoc_insertion_point(field_set:wire.Stat.acked)
+}
+
+// optional uint64 redelivered = 8;
+inline bool Stat::_internal_has_redelivered() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Stat::has_redelivered() const {
+  return _internal_has_redelivered();
+}
+inline void Stat::clear_redelivered() {
+  _impl_.redelivered_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint64_t Stat::_internal_redelivered() const {
+  return _impl_.redelivered_;
+}
+inline uint64_t Stat::redelivered() const {
+  // @@protoc_insertion_point(field_get:wire.Stat.redelivered)
+  return _internal_redelivered();
+}
+inline void Stat::_internal_set_redelivered(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.redelivered_ = value;
+}
+inline void Stat::set_redelivered(uint64_t value) {
+  _internal_set_redelivered(value);
+  // @@protoc_insertion_point(field_set:wire.Stat.redelivered)
+}
+
+// optional uint64 bytes_in = 9;
+inline bool Stat::_internal_has_bytes_in() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Stat::has_bytes_in() const {
+  return _internal_has_bytes_in();
+}
+inline void Stat::clear_bytes_in() {
+  _impl_.bytes_in_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint64_t Stat::_internal_bytes_in() const {
+  return _impl_.bytes_in_;
+}
+inline uint64_t Stat::bytes_in() const {
+  // @@protoc_insertion_point(field_get:wire.Stat.bytes_in)
+  return _internal_bytes_in();
+}
+inline void Stat::_internal_set_bytes_in(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.bytes_in_ = value;
+}
+inline void Stat::set_bytes_in(uint64_t value) {
+  _internal_set_bytes_in(value);
+  // @@protoc_insertion_point(field_set:wire.Stat.bytes_in)
+}
+
+// optional uint64 bytes_out = 10;
+inline bool Stat::_internal_has_bytes_out() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool Stat::has_bytes_out() const {
+  return _internal_has_bytes_out();
+}
+inline void Stat::clear_bytes_out() {
+  _impl_.bytes_out_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline uint64_t Stat::_internal_bytes_out() const {
+  return _impl_.bytes_out_;
+}
+inline uint64_t Stat::bytes_out() const {
+  // @@protoc_insertion_point(field_get:wire.Stat.bytes_out)
+  return _internal_bytes_out();
+}
+inline void Stat::_internal_set_bytes_out(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.bytes_out_ = value;
+}
+inline void Stat::set_bytes_out(uint64_t value) {
+  _internal_set_bytes_out(value);
+  // @@protoc_insertion_point(field_set:wire.Stat.bytes_out)
+}
+
+// optional double enqueue_rate = 11;
+inline bool Stat::_internal_has_enqueue_rate() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool Stat::has_enqueue_rate() const {
+  return _internal_has_enqueue_rate();
+}
+inline void Stat::clear_enqueue_rate() {
+  _impl_.enqueue_rate_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline double Stat::_internal_enqueue_rate() const {
+  return _impl_.enqueue_rate_;
+}
+inline double Stat::enqueue_rate() const {
+  // @@protoc_insertion_point(field_get:wire.Stat.enqueue_rate)
+  return _internal_enqueue_rate();
+}
+inline void Stat::_internal_set_enqueue_rate(double value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.enqueue_rate_ = value;
+}
+inline void Stat::set_enqueue_rate(double value) {
+  _internal_set_enqueue_rate(value);
+  // @@protoc_insertion_point(field_set:wire.Stat.enqueue_rate)
+}
+
+// optional double dequeue_rate = 12;
+inline bool Stat::_internal_has_dequeue_rate() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool Stat::has_dequeue_rate() const {
+  return _internal_has_dequeue_rate();
+}
+inline void Stat::clear_dequeue_rate() {
+  _impl_.dequeue_rate_ = 0;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline double Stat::_internal_dequeue_rate() const {
+  return _impl_.dequeue_rate_;
+}
+inline double Stat::dequeue_rate() const {
+  // @@protoc_insertion_point(field_get:wire.Stat.dequeue_rate)
+  return _internal_dequeue_rate();
+}
+inline void Stat::_internal_set_dequeue_rate(double value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.dequeue_rate_ = value;
+}
+inline void Stat::set_dequeue_rate(double value) {
+  _internal_set_dequeue_rate(value);
+  // @@protoc_insertion_point(field_set:wire.Stat.dequeue_rate)
+}
+
+// optional double ack_rate = 13;
+inline bool Stat::_internal_has_ack_rate() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool Stat::has_ack_rate() const {
+  return _internal_has_ack_rate();
+}
+inline void Stat::clear_ack_rate() {
+  _impl_.ack_rate_ = 0;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline double Stat::_internal_ack_rate() const {
+  return _impl_.ack_rate_;
+}
+inline double Stat::ack_rate() const {
+  // @@protoc_insertion_point(field_get:wire.Stat.ack_rate)
+  return _internal_ack_rate();
+}
+inline void Stat::_internal_set_ack_rate(double value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.ack_rate_ = value;
+}
+inline void Stat::set_ack_rate(double value) {
+  _internal_set_ack_rate(value);
+  // @@protoc_insertion_point(field_set:wire.Stat.ack_rate)
+}
+
+// optional double redelivery_rate = 14;
+inline bool Stat::_internal_has_redelivery_rate() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool Stat::has_redelivery_rate() const {
+  return _internal_has_redelivery_rate();
+}
+inline void Stat::clear_redelivery_rate() {
+  _impl_.redelivery_rate_ = 0;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline double Stat::_internal_redelivery_rate() const {
+  return _impl_.redelivery_rate_;
+}
+inline double Stat::redelivery_rate() const {
+  // @@protoc_insertion_point(field_get:wire.Stat.redelivery_rate)
+  return _internal_redelivery_rate();
+}
+inline void Stat::_internal_set_redelivery_rate(double value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.redelivery_rate_ = value;
+}
+inline void Stat::set_redelivery_rate(double value) {
+  _internal_set_redelivery_rate(value);
+  // @@protoc_insertion_point(field_set:wire.Stat.redelivery_rate)
+}
+
+// optional uint32 subscribers = 15;
+inline bool Stat::_internal_has_subscribers() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool Stat::has_subscribers() const {
+  return _internal_has_subscribers();
+}
+inline void Stat::clear_subscribers() {
+  _impl_.subscribers_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline uint32_t Stat::_internal_subscribers() const {
+  return _impl_.subscribers_;
+}
+inline uint32_t Stat::subscribers() const {
+  // @@protoc_insertion_point(field_get:wire.Stat.subscribers)
+  return _internal_subscribers();
+}
+inline void Stat::_internal_set_subscribers(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.subscribers_ = value;
+}
+inline void Stat::set_subscribers(uint32_t value) {
+  _internal_set_subscribers(value);
+  // @@protoc_insertion_point(field_set:wire.Stat.subscribers)
+}
+
+// optional uint32 inflight = 16;
+inline bool Stat::_internal_has_inflight() const {
+  bool value = (_impl_._has_bits_[0] & 0x00020000u) != 0;
+  return value;
+}
+inline bool Stat::has_inflight() const {
+  return _internal_has_inflight();
+}
+inline void Stat::clear_inflight() {
+  _impl_.inflight_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00020000u;
+}
+inline uint32_t Stat::_internal_inflight() const {
+  return _impl_.inflight_;
+}
+inline uint32_t Stat::inflight() const {
+  // @@protoc_insertion_point(field_get:wire.Stat.inflight)
+  return _internal_inflight();
+}
+inline void Stat::_internal_set_inflight(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00020000u;
+  _impl_.inflight_ = value;
+}
+inline void Stat::set_inflight(uint32_t value) {
+  _internal_set_inflight(value);
+  // @@protoc_insertion_point(field_set:wire.Stat.inflight)
+}
+
+// optional double oldest_age = 17;
+inline bool Stat::_internal_has_oldest_age() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
+inline bool Stat::has_oldest_age() const {
+  return _internal_has_oldest_age();
+}
+inline void Stat::clear_oldest_age() {
+  _impl_.oldest_age_ = 0;
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline double Stat::_internal_oldest_age() const {
+  return _impl_.oldest_age_;
+}
+inline double Stat::oldest_age() const {
+  // @@protoc_insertion_point(field_get:wire.Stat.oldest_age)
+  return _internal_oldest_age();
+}
+inline void Stat::_internal_set_oldest_age(double value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.oldest_age_ = value;
+}
+inline void Stat::set_oldest_age(double value) {
+  _internal_set_oldest_age(value);
+  // @@protoc_insertion_point(field_set:wire.Stat.oldest_age)
+}
 
-  QueueConfiguration(const QueueConfiguration& from);
+// optional uint64 write_backlog = 18;
+inline bool Stat::_internal_has_write_backlog() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  return value;
+}
+inline bool Stat::has_write_backlog() const {
+  return _internal_has_write_backlog();
+}
+inline void Stat::clear_write_backlog() {
+  _impl_.write_backlog_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00010000u;
+}
+inline uint64_t Stat::_internal_write_backlog() const {
+  return _impl_.write_backlog_;
+}
+inline uint64_t Stat::write_backlog() const {
+  // @@protoc_insertion_point(field_get:wire.Stat.write_backlog)
+  return _internal_write_backlog();
+}
+inline void Stat::_internal_set_write_backlog(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00010000u;
+  _impl_.write_backlog_ = value;
+}
+inline void Stat::set_write_backlog(uint64_t value) {
+  _internal_set_write_backlog(value);
+  // @@protoc_insertion_point(field_set:wire.Stat.write_backlog)
+}
 
-  inline QueueConfiguration& operator=(const QueueConfiguration& from) {
-    CopyFrom(from);
-    return *this;
-  }
+// optional uint64 memory_bytes = 19;
+inline bool Stat::_internal_has_memory_bytes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00080000u) != 0;
+  return value;
+}
+inline bool Stat::has_memory_bytes() const {
+  return _internal_has_memory_bytes();
+}
+inline void Stat::clear_memory_bytes() {
+  _impl_.memory_bytes_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00080000u;
+}
+inline uint64_t Stat::_internal_memory_bytes() const {
+  return _impl_.memory_bytes_;
+}
+inline uint64_t Stat::memory_bytes() const {
+  // @@protoc_insertion_point(field_get:wire.Stat.memory_bytes)
+  return _internal_memory_bytes();
+}
+inline void Stat::_internal_set_memory_bytes(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00080000u;
+  _impl_.memory_bytes_ = value;
+}
+inline void Stat::set_memory_bytes(uint64_t value) {
+  _internal_set_memory_bytes(value);
+  // @@protoc_insertion_point(field_set:wire.Stat.memory_bytes)
+}
 
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
+// optional uint32 spilled_size = 20;
+inline bool Stat::_internal_has_spilled_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00040000u) != 0;
+  return value;
+}
+inline bool Stat::has_spilled_size() const {
+  return _internal_has_spilled_size();
+}
+inline void Stat::clear_spilled_size() {
+  _impl_.spilled_size_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00040000u;
+}
+inline uint32_t Stat::_internal_spilled_size() const {
+  return _impl_.spilled_size_;
+}
+inline uint32_t Stat::spilled_size() const {
+  // @@protoc_insertion_point(field_get:wire.Stat.spilled_size)
+  return _internal_spilled_size();
+}
+inline void Stat::_internal_set_spilled_size(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00040000u;
+  _impl_.spilled_size_ = value;
+}
+inline void Stat::set_spilled_size(uint32_t value) {
+  _internal_set_spilled_size(value);
+  // @@protoc_insertion_point(field_set:wire.Stat.spilled_size)
+}
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
+// optional uint64 expired = 21;
+inline bool Stat::_internal_has_expired() const {
+  bool value = (_impl_._has_bits_[0] & 0x00100000u) != 0;
+  return value;
+}
+inline bool Stat::has_expired() const {
+  return _internal_has_expired();
+}
+inline void Stat::clear_expired() {
+  _impl_.expired_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00100000u;
+}
+inline uint64_t Stat::_internal_expired() const {
+  return _impl_.expired_;
+}
+inline uint64_t Stat::expired() const {
+  // @@protoc_insertion_point(field_get:wire.Stat.expired)
+  return _internal_expired();
+}
+inline void Stat::_internal_set_expired(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00100000u;
+  _impl_.expired_ = value;
+}
+inline void Stat::set_expired(uint64_t value) {
+  _internal_set_expired(value);
+  // @@protoc_insertion_point(field_set:wire.Stat.expired)
+}
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const QueueConfiguration& default_instance();
+// optional uint32 scheduled_size = 22;
+inline bool Stat::_internal_has_scheduled_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00200000u) != 0;
+  return value;
+}
+inline bool Stat::has_scheduled_size() const {
+  return _internal_has_scheduled_size();
+}
+inline void Stat::clear_scheduled_size() {
+  _impl_.scheduled_size_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00200000u;
+}
+inline uint32_t Stat::_internal_scheduled_size() const {
+  return _impl_.scheduled_size_;
+}
+inline uint32_t Stat::scheduled_size() const {
+  // @@protoc_insertion_point(field_get:wire.Stat.scheduled_size)
+  return _internal_scheduled_size();
+}
+inline void Stat::_internal_set_scheduled_size(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00200000u;
+  _impl_.scheduled_size_ = value;
+}
+inline void Stat::set_scheduled_size(uint32_t value) {
+  _internal_set_scheduled_size(value);
+  // @@protoc_insertion_point(field_set:wire.Stat.scheduled_size)
+}
 
-  void Swap(QueueConfiguration* other);
+// -------------------------------------------------------------------
 
-  // implements Message ----------------------------------------------
+// ConnectionStat
 
-  QueueConfiguration* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const QueueConfiguration& from);
-  void MergeFrom(const QueueConfiguration& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
+// required int32 fd = 1;
+inline bool ConnectionStat::_internal_has_fd() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ConnectionStat::has_fd() const {
+  return _internal_has_fd();
+}
+inline void ConnectionStat::clear_fd() {
+  _impl_.fd_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t ConnectionStat::_internal_fd() const {
+  return _impl_.fd_;
+}
+inline int32_t ConnectionStat::fd() const {
+  // @@protoc_insertion_point(field_get:wire.ConnectionStat.fd)
+  return _internal_fd();
+}
+inline void ConnectionStat::_internal_set_fd(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.fd_ = value;
+}
+inline void ConnectionStat::set_fd(int32_t value) {
+  _internal_set_fd(value);
+  // @@protoc_insertion_point(field_set:wire.ConnectionStat.fd)
+}
 
-  ::google::protobuf::Metadata GetMetadata() const;
+// optional uint32 subscriptions = 2;
+inline bool ConnectionStat::_internal_has_subscriptions() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ConnectionStat::has_subscriptions() const {
+  return _internal_has_subscriptions();
+}
+inline void ConnectionStat::clear_subscriptions() {
+  _impl_.subscriptions_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t ConnectionStat::_internal_subscriptions() const {
+  return _impl_.subscriptions_;
+}
+inline uint32_t ConnectionStat::subscriptions() const {
+  // @@protoc_insertion_point(field_get:wire.ConnectionStat.subscriptions)
+  return _internal_subscriptions();
+}
+inline void ConnectionStat::_internal_set_subscriptions(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.subscriptions_ = value;
+}
+inline void ConnectionStat::set_subscriptions(uint32_t value) {
+  _internal_set_subscriptions(value);
+  // @@protoc_insertion_point(field_set:wire.ConnectionStat.subscriptions)
+}
 
-  // nested types ----------------------------------------------------
+// optional uint32 inflight = 3;
+inline bool ConnectionStat::_internal_has_inflight() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ConnectionStat::has_inflight() const {
+  return _internal_has_inflight();
+}
+inline void ConnectionStat::clear_inflight() {
+  _impl_.inflight_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t ConnectionStat::_internal_inflight() const {
+  return _impl_.inflight_;
+}
+inline uint32_t ConnectionStat::inflight() const {
+  // @@protoc_insertion_point(field_get:wire.ConnectionStat.inflight)
+  return _internal_inflight();
+}
+inline void ConnectionStat::_internal_set_inflight(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.inflight_ = value;
+}
+inline void ConnectionStat::set_inflight(uint32_t value) {
+  _internal_set_inflight(value);
+  // @@protoc_insertion_point(field_set:wire.ConnectionStat.inflight)
+}
 
-  // accessors -------------------------------------------------------
+// optional uint32 inflight_max = 4;
+inline bool ConnectionStat::_internal_has_inflight_max() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ConnectionStat::has_inflight_max() const {
+  return _internal_has_inflight_max();
+}
+inline void ConnectionStat::clear_inflight_max() {
+  _impl_.inflight_max_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t ConnectionStat::_internal_inflight_max() const {
+  return _impl_.inflight_max_;
+}
+inline uint32_t ConnectionStat::inflight_max() const {
+  // @@protoc_insertion_point(field_get:wire.ConnectionStat.inflight_max)
+  return _internal_inflight_max();
+}
+inline void ConnectionStat::_internal_set_inflight_max(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.inflight_max_ = value;
+}
+inline void ConnectionStat::set_inflight_max(uint32_t value) {
+  _internal_set_inflight_max(value);
+  // @@protoc_insertion_point(field_set:wire.ConnectionStat.inflight_max)
+}
 
-  // repeated .wire.QueueDeclaration queues = 1;
-  inline int queues_size() const;
-  inline void clear_queues();
-  static const int kQueuesFieldNumber = 1;
-  inline const ::wire::QueueDeclaration& queues(int index) const;
-  inline ::wire::QueueDeclaration* mutable_queues(int index);
-  inline ::wire::QueueDeclaration* add_queues();
-  inline const ::google::protobuf::RepeatedPtrField< ::wire::QueueDeclaration >&
-      queues() const;
-  inline ::google::protobuf::RepeatedPtrField< ::wire::QueueDeclaration >*
-      mutable_queues();
+// optional uint64 write_backlog = 5;
+inline bool ConnectionStat::_internal_has_write_backlog() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool ConnectionStat::has_write_backlog() const {
+  return _internal_has_write_backlog();
+}
+inline void ConnectionStat::clear_write_backlog() {
+  _impl_.write_backlog_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t ConnectionStat::_internal_write_backlog() const {
+  return _impl_.write_backlog_;
+}
+inline uint64_t ConnectionStat::write_backlog() const {
+  // @@protoc_insertion_point(field_get:wire.ConnectionStat.write_backlog)
+  return _internal_write_backlog();
+}
+inline void ConnectionStat::_internal_set_write_backlog(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.write_backlog_ = value;
+}
+inline void ConnectionStat::set_write_backlog(uint64_t value) {
+  _internal_set_write_backlog(value);
+  // @@protoc_insertion_point(field_set:wire.ConnectionStat.write_backlog)
+}
 
-  // @@protoc_insertion_point(class_scope:wire.QueueConfiguration)
- private:
+// optional bool ack = 6;
+inline bool ConnectionStat::_internal_has_ack() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool ConnectionStat::has_ack() const {
+  return _internal_has_ack();
+}
+inline void ConnectionStat::clear_ack() {
+  _impl_.ack_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool ConnectionStat::_internal_ack() const {
+  return _impl_.ack_;
+}
+inline bool ConnectionStat::ack() const {
+  // @@protoc_insertion_point(field_get:wire.ConnectionStat.ack)
+  return _internal_ack();
+}
+inline void ConnectionStat::_internal_set_ack(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.ack_ = value;
+}
+inline void ConnectionStat::set_ack(bool value) {
+  _internal_set_ack(value);
+  // @@protoc_insertion_point(field_set:wire.ConnectionStat.ack)
+}
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+// optional bool tap = 7;
+inline bool ConnectionStat::_internal_has_tap() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool ConnectionStat::has_tap() const {
+  return _internal_has_tap();
+}
+inline void ConnectionStat::clear_tap() {
+  _impl_.tap_ = false;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline bool ConnectionStat::_internal_tap() const {
+  return _impl_.tap_;
+}
+inline bool ConnectionStat::tap() const {
+  // @@protoc_insertion_point(field_get:wire.ConnectionStat.tap)
+  return _internal_tap();
+}
+inline void ConnectionStat::_internal_set_tap(bool value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.tap_ = value;
+}
+inline void ConnectionStat::set_tap(bool value) {
+  _internal_set_tap(value);
+  // @@protoc_insertion_point(field_set:wire.ConnectionStat.tap)
+}
 
-  ::google::protobuf::RepeatedPtrField< ::wire::QueueDeclaration > queues_;
+// optional bool replica = 8;
+inline bool ConnectionStat::_internal_has_replica() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool ConnectionStat::has_replica() const {
+  return _internal_has_replica();
+}
+inline void ConnectionStat::clear_replica() {
+  _impl_.replica_ = false;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline bool ConnectionStat::_internal_replica() const {
+  return _impl_.replica_;
+}
+inline bool ConnectionStat::replica() const {
+  // @@protoc_insertion_point(field_get:wire.ConnectionStat.replica)
+  return _internal_replica();
+}
+inline void ConnectionStat::_internal_set_replica(bool value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.replica_ = value;
+}
+inline void ConnectionStat::set_replica(bool value) {
+  _internal_set_replica(value);
+  // @@protoc_insertion_point(field_set:wire.ConnectionStat.replica)
+}
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+// -------------------------------------------------------------------
 
-  friend void  protobuf_AddDesc_wire_2eproto();
-  friend void protobuf_AssignDesc_wire_2eproto();
-  friend void protobuf_ShutdownFile_wire_2eproto();
+// StatDump
 
-  void InitAsDefaultInstance();
-  static QueueConfiguration* default_instance_;
-};
-// ===================================================================
+// repeated .wire.Stat queues = 1;
+inline int StatDump::_internal_queues_size() const {
+  return _impl_.queues_.size();
+}
+inline int StatDump::queues_size() const {
+  return _internal_queues_size();
+}
+inline void StatDump::clear_queues() {
+  _impl_.queues_.Clear();
+}
+inline ::wire::Stat* StatDump::mutable_queues(int index) {
+  // @@protoc_insertion_point(field_mutable:wire.StatDump.queues)
+  return _impl_.queues_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::Stat >*
+StatDump::mutable_queues() {
+  // @@protoc_insertion_point(field_mutable_list:wire.StatDump.queues)
+  return &_impl_.queues_;
+}
+inline const ::wire::Stat& StatDump::_internal_queues(int index) const {
+  return _impl_.queues_.Get(index);
+}
+inline const ::wire::Stat& StatDump::queues(int index) const {
+  // @@protoc_insertion_point(field_get:wire.StatDump.queues)
+  return _internal_queues(index);
+}
+inline ::wire::Stat* StatDump::_internal_add_queues() {
+  return _impl_.queues_.Add();
+}
+inline ::wire::Stat* StatDump::add_queues() {
+  ::wire::Stat* _add = _internal_add_queues();
+  // @@protoc_insertion_point(field_add:wire.StatDump.queues)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::Stat >&
+StatDump::queues() const {
+  // @@protoc_insertion_point(field_list:wire.StatDump.queues)
+  return _impl_.queues_;
+}
 
+// repeated .wire.ConnectionStat connections = 2;
+inline int StatDump::_internal_connections_size() const {
+  return _impl_.connections_.size();
+}
+inline int StatDump::connections_size() const {
+  return _internal_connections_size();
+}
+inline void StatDump::clear_connections() {
+  _impl_.connections_.Clear();
+}
+inline ::wire::ConnectionStat* StatDump::mutable_connections(int index) {
+  // @@protoc_insertion_point(field_mutable:wire.StatDump.connections)
+  return _impl_.connections_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::ConnectionStat >*
+StatDump::mutable_connections() {
+  // @@protoc_insertion_point(field_mutable_list:wire.StatDump.connections)
+  return &_impl_.connections_;
+}
+inline const ::wire::ConnectionStat& StatDump::_internal_connections(int index) const {
+  return _impl_.connections_.Get(index);
+}
+inline const ::wire::ConnectionStat& StatDump::connections(int index) const {
+  // @@protoc_insertion_point(field_get:wire.StatDump.connections)
+  return _internal_connections(index);
+}
+inline ::wire::ConnectionStat* StatDump::_internal_add_connections() {
+  return _impl_.connections_.Add();
+}
+inline ::wire::ConnectionStat* StatDump::add_connections() {
+  ::wire::ConnectionStat* _add = _internal_add_connections();
+  // @@protoc_insertion_point(field_add:wire.StatDump.connections)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::ConnectionStat >&
+StatDump::connections() const {
+  // @@protoc_insertion_point(field_list:wire.StatDump.connections)
+  return _impl_.connections_;
+}
 
-// ===================================================================
+// -------------------------------------------------------------------
 
-// Message
+// ReplicaAction
 
-// required string destination = 1;
-inline bool Message::has_destination() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// required .wire.ReplicaAction.Type type = 1;
+inline bool ReplicaAction::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void Message::set_has_destination() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool ReplicaAction::has_type() const {
+  return _internal_has_type();
 }
-inline void Message::clear_has_destination() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void ReplicaAction::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void Message::clear_destination() {
-  if (destination_ != &::google::protobuf::internal::kEmptyString) {
-    destination_->clear();
-  }
-  clear_has_destination();
+inline ::wire::ReplicaAction_Type ReplicaAction::_internal_type() const {
+  return static_cast< ::wire::ReplicaAction_Type >(_impl_.type_);
 }
-inline const ::std::string& Message::destination() const {
-  return *destination_;
+inline ::wire::ReplicaAction_Type ReplicaAction::type() const {
+  // @@protoc_insertion_point(field_get:wire.ReplicaAction.type)
+  return _internal_type();
 }
-inline void Message::set_destination(const ::std::string& value) {
-  set_has_destination();
-  if (destination_ == &::google::protobuf::internal::kEmptyString) {
-    destination_ = new ::std::string;
-  }
-  destination_->assign(value);
+inline void ReplicaAction::_internal_set_type(::wire::ReplicaAction_Type value) {
+  assert(::wire::ReplicaAction_Type_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.type_ = value;
 }
-inline void Message::set_destination(const char* value) {
-  set_has_destination();
-  if (destination_ == &::google::protobuf::internal::kEmptyString) {
-    destination_ = new ::std::string;
-  }
-  destination_->assign(value);
+inline void ReplicaAction::set_type(::wire::ReplicaAction_Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:wire.ReplicaAction.type)
 }
-inline void Message::set_destination(const char* value, size_t size) {
-  set_has_destination();
-  if (destination_ == &::google::protobuf::internal::kEmptyString) {
-    destination_ = new ::std::string;
-  }
-  destination_->assign(reinterpret_cast<const char*>(value), size);
+
+// optional bytes payload = 2;
+inline bool ReplicaAction::_internal_has_payload() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline ::std::string* Message::mutable_destination() {
-  set_has_destination();
-  if (destination_ == &::google::protobuf::internal::kEmptyString) {
-    destination_ = new ::std::string;
-  }
-  return destination_;
+inline bool ReplicaAction::has_payload() const {
+  return _internal_has_payload();
 }
-inline ::std::string* Message::release_destination() {
-  clear_has_destination();
-  if (destination_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = destination_;
-    destination_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+inline void ReplicaAction::clear_payload() {
+  _impl_.payload_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ReplicaAction::payload() const {
+  // @@protoc_insertion_point(field_get:wire.ReplicaAction.payload)
+  return _internal_payload();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReplicaAction::set_payload(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.payload_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:wire.ReplicaAction.payload)
+}
+inline std::string* ReplicaAction::mutable_payload() {
+  std::string* _s = _internal_mutable_payload();
+  // @@protoc_insertion_point(field_mutable:wire.ReplicaAction.payload)
+  return _s;
+}
+inline const std::string& ReplicaAction::_internal_payload() const {
+  return _impl_.payload_.Get();
+}
+inline void ReplicaAction::_internal_set_payload(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.payload_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReplicaAction::_internal_mutable_payload() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.payload_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReplicaAction::release_payload() {
+  // @@protoc_insertion_point(field_release:wire.ReplicaAction.payload)
+  if (!_internal_has_payload()) {
+    return nullptr;
   }
-}
-inline void Message::set_allocated_destination(::std::string* destination) {
-  if (destination_ != &::google::protobuf::internal::kEmptyString) {
-    delete destination_;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.payload_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.payload_.IsDefault()) {
+    _impl_.payload_.Set("", GetArenaForAllocation());
   }
-  if (destination) {
-    set_has_destination();
-    destination_ = destination;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ReplicaAction::set_allocated_payload(std::string* payload) {
+  if (payload != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_destination();
-    destination_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.payload_.SetAllocated(payload, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.payload_.IsDefault()) {
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:wire.ReplicaAction.payload)
 }
 
-// required bytes payload = 2;
-inline bool Message::has_payload() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// optional bool compressed = 3;
+inline bool ReplicaAction::_internal_has_compressed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void Message::set_has_payload() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool ReplicaAction::has_compressed() const {
+  return _internal_has_compressed();
 }
-inline void Message::clear_has_payload() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void ReplicaAction::clear_compressed() {
+  _impl_.compressed_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void Message::clear_payload() {
-  if (payload_ != &::google::protobuf::internal::kEmptyString) {
-    payload_->clear();
-  }
-  clear_has_payload();
+inline bool ReplicaAction::_internal_compressed() const {
+  return _impl_.compressed_;
 }
-inline const ::std::string& Message::payload() const {
-  return *payload_;
+inline bool ReplicaAction::compressed() const {
+  // @@protoc_insertion_point(field_get:wire.ReplicaAction.compressed)
+  return _internal_compressed();
 }
-inline void Message::set_payload(const ::std::string& value) {
-  set_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    payload_ = new ::std::string;
-  }
-  payload_->assign(value);
+inline void ReplicaAction::_internal_set_compressed(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.compressed_ = value;
 }
-inline void Message::set_payload(const char* value) {
-  set_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    payload_ = new ::std::string;
-  }
-  payload_->assign(value);
+inline void ReplicaAction::set_compressed(bool value) {
+  _internal_set_compressed(value);
+  // @@protoc_insertion_point(field_set:wire.ReplicaAction.compressed)
 }
-inline void Message::set_payload(const void* value, size_t size) {
-  set_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    payload_ = new ::std::string;
-  }
-  payload_->assign(reinterpret_cast<const char*>(value), size);
+
+// optional uint64 lsn = 4;
+inline bool ReplicaAction::_internal_has_lsn() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline ::std::string* Message::mutable_payload() {
-  set_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    payload_ = new ::std::string;
-  }
-  return payload_;
+inline bool ReplicaAction::has_lsn() const {
+  return _internal_has_lsn();
 }
-inline ::std::string* Message::release_payload() {
-  clear_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = payload_;
-    payload_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline void ReplicaAction::clear_lsn() {
+  _impl_.lsn_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline void Message::set_allocated_payload(::std::string* payload) {
-  if (payload_ != &::google::protobuf::internal::kEmptyString) {
-    delete payload_;
-  }
-  if (payload) {
-    set_has_payload();
-    payload_ = payload;
-  } else {
-    clear_has_payload();
-    payload_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline uint64_t ReplicaAction::_internal_lsn() const {
+  return _impl_.lsn_;
+}
+inline uint64_t ReplicaAction::lsn() const {
+  // @@protoc_insertion_point(field_get:wire.ReplicaAction.lsn)
+  return _internal_lsn();
+}
+inline void ReplicaAction::_internal_set_lsn(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.lsn_ = value;
+}
+inline void ReplicaAction::set_lsn(uint64_t value) {
+  _internal_set_lsn(value);
+  // @@protoc_insertion_point(field_set:wire.ReplicaAction.lsn)
 }
 
-// optional uint64 id = 3;
-inline bool Message::has_id() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// -------------------------------------------------------------------
+
+// ReplicaBatch
+
+// repeated bytes entries = 1;
+inline int ReplicaBatch::_internal_entries_size() const {
+  return _impl_.entries_.size();
 }
-inline void Message::set_has_id() {
-  _has_bits_[0] |= 0x00000004u;
+inline int ReplicaBatch::entries_size() const {
+  return _internal_entries_size();
 }
-inline void Message::clear_has_id() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void ReplicaBatch::clear_entries() {
+  _impl_.entries_.Clear();
 }
-inline void Message::clear_id() {
-  id_ = GOOGLE_ULONGLONG(0);
-  clear_has_id();
+inline std::string* ReplicaBatch::add_entries() {
+  std::string* _s = _internal_add_entries();
+  // @@protoc_insertion_point(field_add_mutable:wire.ReplicaBatch.entries)
+  return _s;
 }
-inline ::google::protobuf::uint64 Message::id() const {
-  return id_;
+inline const std::string& ReplicaBatch::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
 }
-inline void Message::set_id(::google::protobuf::uint64 value) {
-  set_has_id();
-  id_ = value;
+inline const std::string& ReplicaBatch::entries(int index) const {
+  // @@protoc_insertion_point(field_get:wire.ReplicaBatch.entries)
+  return _internal_entries(index);
 }
-
-// optional uint32 flags = 4;
-inline bool Message::has_flags() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+inline std::string* ReplicaBatch::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:wire.ReplicaBatch.entries)
+  return _impl_.entries_.Mutable(index);
 }
-inline void Message::set_has_flags() {
-  _has_bits_[0] |= 0x00000008u;
+inline void ReplicaBatch::set_entries(int index, const std::string& value) {
+  _impl_.entries_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:wire.ReplicaBatch.entries)
 }
-inline void Message::clear_has_flags() {
-  _has_bits_[0] &= ~0x00000008u;
+inline void ReplicaBatch::set_entries(int index, std::string&& value) {
+  _impl_.entries_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:wire.ReplicaBatch.entries)
 }
-inline void Message::clear_flags() {
-  flags_ = 0u;
-  clear_has_flags();
+inline void ReplicaBatch::set_entries(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.entries_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:wire.ReplicaBatch.entries)
 }
-inline ::google::protobuf::uint32 Message::flags() const {
-  return flags_;
+inline void ReplicaBatch::set_entries(int index, const void* value, size_t size) {
+  _impl_.entries_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:wire.ReplicaBatch.entries)
 }
-inline void Message::set_flags(::google::protobuf::uint32 value) {
-  set_has_flags();
-  flags_ = value;
+inline std::string* ReplicaBatch::_internal_add_entries() {
+  return _impl_.entries_.Add();
 }
-
-// optional uint64 confirm_id = 5;
-inline bool Message::has_confirm_id() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+inline void ReplicaBatch::add_entries(const std::string& value) {
+  _impl_.entries_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:wire.ReplicaBatch.entries)
 }
-inline void Message::set_has_confirm_id() {
-  _has_bits_[0] |= 0x00000010u;
+inline void ReplicaBatch::add_entries(std::string&& value) {
+  _impl_.entries_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:wire.ReplicaBatch.entries)
 }
-inline void Message::clear_has_confirm_id() {
-  _has_bits_[0] &= ~0x00000010u;
+inline void ReplicaBatch::add_entries(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.entries_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:wire.ReplicaBatch.entries)
 }
-inline void Message::clear_confirm_id() {
-  confirm_id_ = GOOGLE_ULONGLONG(0);
-  clear_has_confirm_id();
+inline void ReplicaBatch::add_entries(const void* value, size_t size) {
+  _impl_.entries_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:wire.ReplicaBatch.entries)
 }
-inline ::google::protobuf::uint64 Message::confirm_id() const {
-  return confirm_id_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ReplicaBatch::entries() const {
+  // @@protoc_insertion_point(field_list:wire.ReplicaBatch.entries)
+  return _impl_.entries_;
 }
-inline void Message::set_confirm_id(::google::protobuf::uint64 value) {
-  set_has_confirm_id();
-  confirm_id_ = value;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ReplicaBatch::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:wire.ReplicaBatch.entries)
+  return &_impl_.entries_;
 }
 
 // -------------------------------------------------------------------
 
-// Action
+// ReplicaEntry
 
-// required int32 type = 1;
-inline bool Action::has_type() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// required .wire.ReplicaEntry.Type type = 1;
+inline bool ReplicaEntry::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline void Action::set_has_type() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool ReplicaEntry::has_type() const {
+  return _internal_has_type();
 }
-inline void Action::clear_has_type() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void ReplicaEntry::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline void Action::clear_type() {
-  type_ = 0;
-  clear_has_type();
+inline ::wire::ReplicaEntry_Type ReplicaEntry::_internal_type() const {
+  return static_cast< ::wire::ReplicaEntry_Type >(_impl_.type_);
 }
-inline ::google::protobuf::int32 Action::type() const {
-  return type_;
+inline ::wire::ReplicaEntry_Type ReplicaEntry::type() const {
+  // @@protoc_insertion_point(field_get:wire.ReplicaEntry.type)
+  return _internal_type();
 }
-inline void Action::set_type(::google::protobuf::int32 value) {
-  set_has_type();
-  type_ = value;
+inline void ReplicaEntry::_internal_set_type(::wire::ReplicaEntry_Type value) {
+  assert(::wire::ReplicaEntry_Type_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.type_ = value;
+}
+inline void ReplicaEntry::set_type(::wire::ReplicaEntry_Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:wire.ReplicaEntry.type)
 }
 
-// optional string payload = 2;
-inline bool Action::has_payload() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// optional string queue = 2;
+inline bool ReplicaEntry::_internal_has_queue() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void Action::set_has_payload() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool ReplicaEntry::has_queue() const {
+  return _internal_has_queue();
 }
-inline void Action::clear_has_payload() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void ReplicaEntry::clear_queue() {
+  _impl_.queue_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline void Action::clear_payload() {
-  if (payload_ != &::google::protobuf::internal::kEmptyString) {
-    payload_->clear();
-  }
-  clear_has_payload();
+inline const std::string& ReplicaEntry::queue() const {
+  // @@protoc_insertion_point(field_get:wire.ReplicaEntry.queue)
+  return _internal_queue();
 }
-inline const ::std::string& Action::payload() const {
-  return *payload_;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReplicaEntry::set_queue(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.queue_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:wire.ReplicaEntry.queue)
 }
-inline void Action::set_payload(const ::std::string& value) {
-  set_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    payload_ = new ::std::string;
-  }
-  payload_->assign(value);
+inline std::string* ReplicaEntry::mutable_queue() {
+  std::string* _s = _internal_mutable_queue();
+  // @@protoc_insertion_point(field_mutable:wire.ReplicaEntry.queue)
+  return _s;
 }
-inline void Action::set_payload(const char* value) {
-  set_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    payload_ = new ::std::string;
-  }
-  payload_->assign(value);
+inline const std::string& ReplicaEntry::_internal_queue() const {
+  return _impl_.queue_.Get();
 }
-inline void Action::set_payload(const char* value, size_t size) {
-  set_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    payload_ = new ::std::string;
-  }
-  payload_->assign(reinterpret_cast<const char*>(value), size);
+inline void ReplicaEntry::_internal_set_queue(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.queue_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Action::mutable_payload() {
-  set_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    payload_ = new ::std::string;
-  }
-  return payload_;
+inline std::string* ReplicaEntry::_internal_mutable_queue() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.queue_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Action::release_payload() {
-  clear_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = payload_;
-    payload_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+inline std::string* ReplicaEntry::release_queue() {
+  // @@protoc_insertion_point(field_release:wire.ReplicaEntry.queue)
+  if (!_internal_has_queue()) {
+    return nullptr;
   }
-}
-inline void Action::set_allocated_payload(::std::string* payload) {
-  if (payload_ != &::google::protobuf::internal::kEmptyString) {
-    delete payload_;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.queue_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.queue_.IsDefault()) {
+    _impl_.queue_.Set("", GetArenaForAllocation());
   }
-  if (payload) {
-    set_has_payload();
-    payload_ = payload;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ReplicaEntry::set_allocated_queue(std::string* queue) {
+  if (queue != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_payload();
-    payload_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.queue_.SetAllocated(queue, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.queue_.IsDefault()) {
+    _impl_.queue_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:wire.ReplicaEntry.queue)
 }
 
-// optional uint64 id = 3;
-inline bool Action::has_id() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// optional .wire.QueueDeclaration.Type kind = 3;
+inline bool ReplicaEntry::_internal_has_kind() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
 }
-inline void Action::set_has_id() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool ReplicaEntry::has_kind() const {
+  return _internal_has_kind();
 }
-inline void Action::clear_has_id() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void ReplicaEntry::clear_kind() {
+  _impl_.kind_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
-inline void Action::clear_id() {
-  id_ = GOOGLE_ULONGLONG(0);
-  clear_has_id();
+inline ::wire::QueueDeclaration_Type ReplicaEntry::_internal_kind() const {
+  return static_cast< ::wire::QueueDeclaration_Type >(_impl_.kind_);
 }
-inline ::google::protobuf::uint64 Action::id() const {
-  return id_;
+inline ::wire::QueueDeclaration_Type ReplicaEntry::kind() const {
+  // @@protoc_insertion_point(field_get:wire.ReplicaEntry.kind)
+  return _internal_kind();
 }
-inline void Action::set_id(::google::protobuf::uint64 value) {
-  set_has_id();
-  id_ = value;
+inline void ReplicaEntry::_internal_set_kind(::wire::QueueDeclaration_Type value) {
+  assert(::wire::QueueDeclaration_Type_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.kind_ = value;
+}
+inline void ReplicaEntry::set_kind(::wire::QueueDeclaration_Type value) {
+  _internal_set_kind(value);
+  // @@protoc_insertion_point(field_set:wire.ReplicaEntry.kind)
 }
 
-// -------------------------------------------------------------------
-
-// BondRequest
-
-// required string queue = 1;
-inline bool BondRequest::has_queue() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional string destination = 4;
+inline bool ReplicaEntry::_internal_has_destination() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void BondRequest::set_has_queue() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool ReplicaEntry::has_destination() const {
+  return _internal_has_destination();
 }
-inline void BondRequest::clear_has_queue() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void ReplicaEntry::clear_destination() {
+  _impl_.destination_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void BondRequest::clear_queue() {
-  if (queue_ != &::google::protobuf::internal::kEmptyString) {
-    queue_->clear();
-  }
-  clear_has_queue();
+inline const std::string& ReplicaEntry::destination() const {
+  // @@protoc_insertion_point(field_get:wire.ReplicaEntry.destination)
+  return _internal_destination();
 }
-inline const ::std::string& BondRequest::queue() const {
-  return *queue_;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReplicaEntry::set_destination(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.destination_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:wire.ReplicaEntry.destination)
 }
-inline void BondRequest::set_queue(const ::std::string& value) {
-  set_has_queue();
-  if (queue_ == &::google::protobuf::internal::kEmptyString) {
-    queue_ = new ::std::string;
-  }
-  queue_->assign(value);
+inline std::string* ReplicaEntry::mutable_destination() {
+  std::string* _s = _internal_mutable_destination();
+  // @@protoc_insertion_point(field_mutable:wire.ReplicaEntry.destination)
+  return _s;
 }
-inline void BondRequest::set_queue(const char* value) {
-  set_has_queue();
-  if (queue_ == &::google::protobuf::internal::kEmptyString) {
-    queue_ = new ::std::string;
-  }
-  queue_->assign(value);
+inline const std::string& ReplicaEntry::_internal_destination() const {
+  return _impl_.destination_.Get();
 }
-inline void BondRequest::set_queue(const char* value, size_t size) {
-  set_has_queue();
-  if (queue_ == &::google::protobuf::internal::kEmptyString) {
-    queue_ = new ::std::string;
-  }
-  queue_->assign(reinterpret_cast<const char*>(value), size);
+inline void ReplicaEntry::_internal_set_destination(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.destination_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* BondRequest::mutable_queue() {
-  set_has_queue();
-  if (queue_ == &::google::protobuf::internal::kEmptyString) {
-    queue_ = new ::std::string;
-  }
-  return queue_;
+inline std::string* ReplicaEntry::_internal_mutable_destination() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.destination_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* BondRequest::release_queue() {
-  clear_has_queue();
-  if (queue_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = queue_;
-    queue_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+inline std::string* ReplicaEntry::release_destination() {
+  // @@protoc_insertion_point(field_release:wire.ReplicaEntry.destination)
+  if (!_internal_has_destination()) {
+    return nullptr;
   }
-}
-inline void BondRequest::set_allocated_queue(::std::string* queue) {
-  if (queue_ != &::google::protobuf::internal::kEmptyString) {
-    delete queue_;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.destination_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.destination_.IsDefault()) {
+    _impl_.destination_.Set("", GetArenaForAllocation());
   }
-  if (queue) {
-    set_has_queue();
-    queue_ = queue;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ReplicaEntry::set_allocated_destination(std::string* destination) {
+  if (destination != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_queue();
-    queue_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.destination_.SetAllocated(destination, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.destination_.IsDefault()) {
+    _impl_.destination_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:wire.ReplicaEntry.destination)
 }
 
-// required string destination = 2;
-inline bool BondRequest::has_destination() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// optional uint64 index = 5;
+inline bool ReplicaEntry::_internal_has_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
 }
-inline void BondRequest::set_has_destination() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool ReplicaEntry::has_index() const {
+  return _internal_has_index();
 }
-inline void BondRequest::clear_has_destination() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void ReplicaEntry::clear_index() {
+  _impl_.index_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000040u;
 }
-inline void BondRequest::clear_destination() {
-  if (destination_ != &::google::protobuf::internal::kEmptyString) {
-    destination_->clear();
-  }
-  clear_has_destination();
+inline uint64_t ReplicaEntry::_internal_index() const {
+  return _impl_.index_;
+}
+inline uint64_t ReplicaEntry::index() const {
+  // @@protoc_insertion_point(field_get:wire.ReplicaEntry.index)
+  return _internal_index();
+}
+inline void ReplicaEntry::_internal_set_index(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.index_ = value;
+}
+inline void ReplicaEntry::set_index(uint64_t value) {
+  _internal_set_index(value);
+  // @@protoc_insertion_point(field_set:wire.ReplicaEntry.index)
+}
+
+// optional uint32 count = 6;
+inline bool ReplicaEntry::_internal_has_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool ReplicaEntry::has_count() const {
+  return _internal_has_count();
+}
+inline void ReplicaEntry::clear_count() {
+  _impl_.count_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline uint32_t ReplicaEntry::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint32_t ReplicaEntry::count() const {
+  // @@protoc_insertion_point(field_get:wire.ReplicaEntry.count)
+  return _internal_count();
+}
+inline void ReplicaEntry::_internal_set_count(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.count_ = value;
+}
+inline void ReplicaEntry::set_count(uint32_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:wire.ReplicaEntry.count)
+}
+
+// optional .wire.Message message = 7;
+inline bool ReplicaEntry::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.message_ != nullptr);
+  return value;
+}
+inline bool ReplicaEntry::has_message() const {
+  return _internal_has_message();
+}
+inline void ReplicaEntry::clear_message() {
+  if (_impl_.message_ != nullptr) _impl_.message_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::wire::Message& ReplicaEntry::_internal_message() const {
+  const ::wire::Message* p = _impl_.message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::wire::Message&>(
+      ::wire::_Message_default_instance_);
 }
-inline const ::std::string& BondRequest::destination() const {
-  return *destination_;
+inline const ::wire::Message& ReplicaEntry::message() const {
+  // @@protoc_insertion_point(field_get:wire.ReplicaEntry.message)
+  return _internal_message();
 }
-inline void BondRequest::set_destination(const ::std::string& value) {
-  set_has_destination();
-  if (destination_ == &::google::protobuf::internal::kEmptyString) {
-    destination_ = new ::std::string;
+inline void ReplicaEntry::unsafe_arena_set_allocated_message(
+    ::wire::Message* message) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.message_);
   }
-  destination_->assign(value);
-}
-inline void BondRequest::set_destination(const char* value) {
-  set_has_destination();
-  if (destination_ == &::google::protobuf::internal::kEmptyString) {
-    destination_ = new ::std::string;
+  _impl_.message_ = message;
+  if (message) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
-  destination_->assign(value);
-}
-inline void BondRequest::set_destination(const char* value, size_t size) {
-  set_has_destination();
-  if (destination_ == &::google::protobuf::internal::kEmptyString) {
-    destination_ = new ::std::string;
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:wire.ReplicaEntry.message)
+}
+inline ::wire::Message* ReplicaEntry::release_message() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::wire::Message* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
-  destination_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* BondRequest::mutable_destination() {
-  set_has_destination();
-  if (destination_ == &::google::protobuf::internal::kEmptyString) {
-    destination_ = new ::std::string;
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::wire::Message* ReplicaEntry::unsafe_arena_release_message() {
+  // @@protoc_insertion_point(field_release:wire.ReplicaEntry.message)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::wire::Message* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+  return temp;
+}
+inline ::wire::Message* ReplicaEntry::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::wire::Message>(GetArenaForAllocation());
+    _impl_.message_ = p;
   }
-  return destination_;
+  return _impl_.message_;
 }
-inline ::std::string* BondRequest::release_destination() {
-  clear_has_destination();
-  if (destination_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = destination_;
-    destination_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline ::wire::Message* ReplicaEntry::mutable_message() {
+  ::wire::Message* _msg = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:wire.ReplicaEntry.message)
+  return _msg;
 }
-inline void BondRequest::set_allocated_destination(::std::string* destination) {
-  if (destination_ != &::google::protobuf::internal::kEmptyString) {
-    delete destination_;
+inline void ReplicaEntry::set_allocated_message(::wire::Message* message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.message_;
   }
-  if (destination) {
-    set_has_destination();
-    destination_ = destination;
+  if (message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(message);
+    if (message_arena != submessage_arena) {
+      message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, message, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    clear_has_destination();
-    destination_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
+  _impl_.message_ = message;
+  // @@protoc_insertion_point(field_set_allocated:wire.ReplicaEntry.message)
 }
 
-// -------------------------------------------------------------------
-
-// ConnectionConfigure
-
-// optional bool tap = 1;
-inline bool ConnectionConfigure::has_tap() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional uint64 lsn = 8;
+inline bool ReplicaEntry::_internal_has_lsn() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
 }
-inline void ConnectionConfigure::set_has_tap() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool ReplicaEntry::has_lsn() const {
+  return _internal_has_lsn();
 }
-inline void ConnectionConfigure::clear_has_tap() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void ReplicaEntry::clear_lsn() {
+  _impl_.lsn_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000080u;
 }
-inline void ConnectionConfigure::clear_tap() {
-  tap_ = false;
-  clear_has_tap();
+inline uint64_t ReplicaEntry::_internal_lsn() const {
+  return _impl_.lsn_;
 }
-inline bool ConnectionConfigure::tap() const {
-  return tap_;
+inline uint64_t ReplicaEntry::lsn() const {
+  // @@protoc_insertion_point(field_get:wire.ReplicaEntry.lsn)
+  return _internal_lsn();
 }
-inline void ConnectionConfigure::set_tap(bool value) {
-  set_has_tap();
-  tap_ = value;
+inline void ReplicaEntry::_internal_set_lsn(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.lsn_ = value;
 }
-
-// optional bool ack = 2;
-inline bool ConnectionConfigure::has_ack() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline void ReplicaEntry::set_lsn(uint64_t value) {
+  _internal_set_lsn(value);
+  // @@protoc_insertion_point(field_set:wire.ReplicaEntry.lsn)
 }
-inline void ConnectionConfigure::set_has_ack() {
-  _has_bits_[0] |= 0x00000002u;
+
+// optional uint64 epoch = 9;
+inline bool ReplicaEntry::_internal_has_epoch() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
 }
-inline void ConnectionConfigure::clear_has_ack() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool ReplicaEntry::has_epoch() const {
+  return _internal_has_epoch();
 }
-inline void ConnectionConfigure::clear_ack() {
-  ack_ = false;
-  clear_has_ack();
+inline void ReplicaEntry::clear_epoch() {
+  _impl_.epoch_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000100u;
 }
-inline bool ConnectionConfigure::ack() const {
-  return ack_;
+inline uint64_t ReplicaEntry::_internal_epoch() const {
+  return _impl_.epoch_;
 }
-inline void ConnectionConfigure::set_ack(bool value) {
-  set_has_ack();
-  ack_ = value;
+inline uint64_t ReplicaEntry::epoch() const {
+  // @@protoc_insertion_point(field_get:wire.ReplicaEntry.epoch)
+  return _internal_epoch();
 }
-
-// optional bool confirm = 3;
-inline bool ConnectionConfigure::has_confirm() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline void ReplicaEntry::_internal_set_epoch(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.epoch_ = value;
 }
-inline void ConnectionConfigure::set_has_confirm() {
-  _has_bits_[0] |= 0x00000004u;
+inline void ReplicaEntry::set_epoch(uint64_t value) {
+  _internal_set_epoch(value);
+  // @@protoc_insertion_point(field_set:wire.ReplicaEntry.epoch)
 }
-inline void ConnectionConfigure::clear_has_confirm() {
-  _has_bits_[0] &= ~0x00000004u;
+
+// repeated .wire.Message messages = 10;
+inline int ReplicaEntry::_internal_messages_size() const {
+  return _impl_.messages_.size();
 }
-inline void ConnectionConfigure::clear_confirm() {
-  confirm_ = false;
-  clear_has_confirm();
+inline int ReplicaEntry::messages_size() const {
+  return _internal_messages_size();
 }
-inline bool ConnectionConfigure::confirm() const {
-  return confirm_;
+inline void ReplicaEntry::clear_messages() {
+  _impl_.messages_.Clear();
 }
-inline void ConnectionConfigure::set_confirm(bool value) {
-  set_has_confirm();
-  confirm_ = value;
+inline ::wire::Message* ReplicaEntry::mutable_messages(int index) {
+  // @@protoc_insertion_point(field_mutable:wire.ReplicaEntry.messages)
+  return _impl_.messages_.Mutable(index);
 }
-
-// optional uint32 inflight = 4;
-inline bool ConnectionConfigure::has_inflight() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::Message >*
+ReplicaEntry::mutable_messages() {
+  // @@protoc_insertion_point(field_mutable_list:wire.ReplicaEntry.messages)
+  return &_impl_.messages_;
 }
-inline void ConnectionConfigure::set_has_inflight() {
-  _has_bits_[0] |= 0x00000008u;
+inline const ::wire::Message& ReplicaEntry::_internal_messages(int index) const {
+  return _impl_.messages_.Get(index);
 }
-inline void ConnectionConfigure::clear_has_inflight() {
-  _has_bits_[0] &= ~0x00000008u;
+inline const ::wire::Message& ReplicaEntry::messages(int index) const {
+  // @@protoc_insertion_point(field_get:wire.ReplicaEntry.messages)
+  return _internal_messages(index);
 }
-inline void ConnectionConfigure::clear_inflight() {
-  inflight_ = 0u;
-  clear_has_inflight();
+inline ::wire::Message* ReplicaEntry::_internal_add_messages() {
+  return _impl_.messages_.Add();
 }
-inline ::google::protobuf::uint32 ConnectionConfigure::inflight() const {
-  return inflight_;
+inline ::wire::Message* ReplicaEntry::add_messages() {
+  ::wire::Message* _add = _internal_add_messages();
+  // @@protoc_insertion_point(field_add:wire.ReplicaEntry.messages)
+  return _add;
 }
-inline void ConnectionConfigure::set_inflight(::google::protobuf::uint32 value) {
-  set_has_inflight();
-  inflight_ = value;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::Message >&
+ReplicaEntry::messages() const {
+  // @@protoc_insertion_point(field_list:wire.ReplicaEntry.messages)
+  return _impl_.messages_;
 }
 
-// -------------------------------------------------------------------
-
-// MessageRange
-
-// required int32 start = 1;
-inline bool MessageRange::has_start() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional string key = 11;
+inline bool ReplicaEntry::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void MessageRange::set_has_start() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool ReplicaEntry::has_key() const {
+  return _internal_has_key();
 }
-inline void MessageRange::clear_has_start() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void MessageRange::clear_start() {
-  start_ = 0;
-  clear_has_start();
+inline void ReplicaEntry::clear_key() {
+  _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline ::google::protobuf::int32 MessageRange::start() const {
-  return start_;
+inline const std::string& ReplicaEntry::key() const {
+  // @@protoc_insertion_point(field_get:wire.ReplicaEntry.key)
+  return _internal_key();
 }
-inline void MessageRange::set_start(::google::protobuf::int32 value) {
-  set_has_start();
-  start_ = value;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReplicaEntry::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:wire.ReplicaEntry.key)
 }
-
-// required int32 count = 2;
-inline bool MessageRange::has_count() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline std::string* ReplicaEntry::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:wire.ReplicaEntry.key)
+  return _s;
 }
-inline void MessageRange::set_has_count() {
-  _has_bits_[0] |= 0x00000002u;
+inline const std::string& ReplicaEntry::_internal_key() const {
+  return _impl_.key_.Get();
 }
-inline void MessageRange::clear_has_count() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void ReplicaEntry::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
-inline void MessageRange::clear_count() {
-  count_ = 0;
-  clear_has_count();
+inline std::string* ReplicaEntry::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.key_.Mutable(GetArenaForAllocation());
 }
-inline ::google::protobuf::int32 MessageRange::count() const {
-  return count_;
+inline std::string* ReplicaEntry::release_key() {
+  // @@protoc_insertion_point(field_release:wire.ReplicaEntry.key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline void MessageRange::set_count(::google::protobuf::int32 value) {
-  set_has_count();
-  count_ = value;
+inline void ReplicaEntry::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:wire.ReplicaEntry.key)
 }
 
 // -------------------------------------------------------------------
 
-// Queue
+// ReplicaStart
 
-// required int32 size = 1;
-inline bool Queue::has_size() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional uint64 epoch = 1;
+inline bool ReplicaStart::_internal_has_epoch() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void Queue::set_has_size() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool ReplicaStart::has_epoch() const {
+  return _internal_has_epoch();
 }
-inline void Queue::clear_has_size() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void ReplicaStart::clear_epoch() {
+  _impl_.epoch_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline void Queue::clear_size() {
-  size_ = 0;
-  clear_has_size();
+inline uint64_t ReplicaStart::_internal_epoch() const {
+  return _impl_.epoch_;
 }
-inline ::google::protobuf::int32 Queue::size() const {
-  return size_;
+inline uint64_t ReplicaStart::epoch() const {
+  // @@protoc_insertion_point(field_get:wire.ReplicaStart.epoch)
+  return _internal_epoch();
 }
-inline void Queue::set_size(::google::protobuf::int32 value) {
-  set_has_size();
-  size_ = value;
+inline void ReplicaStart::_internal_set_epoch(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.epoch_ = value;
+}
+inline void ReplicaStart::set_epoch(uint64_t value) {
+  _internal_set_epoch(value);
+  // @@protoc_insertion_point(field_set:wire.ReplicaStart.epoch)
 }
 
-// repeated .wire.MessageRange ranges = 2;
-inline int Queue::ranges_size() const {
-  return ranges_.size();
+// optional uint64 lsn = 2;
+inline bool ReplicaStart::_internal_has_lsn() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void Queue::clear_ranges() {
-  ranges_.Clear();
+inline bool ReplicaStart::has_lsn() const {
+  return _internal_has_lsn();
 }
-inline const ::wire::MessageRange& Queue::ranges(int index) const {
-  return ranges_.Get(index);
+inline void ReplicaStart::clear_lsn() {
+  _impl_.lsn_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::wire::MessageRange* Queue::mutable_ranges(int index) {
-  return ranges_.Mutable(index);
+inline uint64_t ReplicaStart::_internal_lsn() const {
+  return _impl_.lsn_;
 }
-inline ::wire::MessageRange* Queue::add_ranges() {
-  return ranges_.Add();
+inline uint64_t ReplicaStart::lsn() const {
+  // @@protoc_insertion_point(field_get:wire.ReplicaStart.lsn)
+  return _internal_lsn();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::wire::MessageRange >&
-Queue::ranges() const {
-  return ranges_;
+inline void ReplicaStart::_internal_set_lsn(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.lsn_ = value;
 }
-inline ::google::protobuf::RepeatedPtrField< ::wire::MessageRange >*
-Queue::mutable_ranges() {
-  return &ranges_;
+inline void ReplicaStart::set_lsn(uint64_t value) {
+  _internal_set_lsn(value);
+  // @@protoc_insertion_point(field_set:wire.ReplicaStart.lsn)
 }
 
 // -------------------------------------------------------------------
 
-// Stat
+// QueueError
 
-// required string name = 1;
-inline bool Stat::has_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void Stat::set_has_name() {
-  _has_bits_[0] |= 0x00000001u;
+// required string queue = 1;
+inline bool QueueError::_internal_has_queue() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void Stat::clear_has_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool QueueError::has_queue() const {
+  return _internal_has_queue();
 }
-inline void Stat::clear_name() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    name_->clear();
+inline void QueueError::clear_queue() {
+  _impl_.queue_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& QueueError::queue() const {
+  // @@protoc_insertion_point(field_get:wire.QueueError.queue)
+  return _internal_queue();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void QueueError::set_queue(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.queue_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:wire.QueueError.queue)
+}
+inline std::string* QueueError::mutable_queue() {
+  std::string* _s = _internal_mutable_queue();
+  // @@protoc_insertion_point(field_mutable:wire.QueueError.queue)
+  return _s;
+}
+inline const std::string& QueueError::_internal_queue() const {
+  return _impl_.queue_.Get();
+}
+inline void QueueError::_internal_set_queue(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.queue_.Set(value, GetArenaForAllocation());
+}
+inline std::string* QueueError::_internal_mutable_queue() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.queue_.Mutable(GetArenaForAllocation());
+}
+inline std::string* QueueError::release_queue() {
+  // @@protoc_insertion_point(field_release:wire.QueueError.queue)
+  if (!_internal_has_queue()) {
+    return nullptr;
   }
-  clear_has_name();
-}
-inline const ::std::string& Stat::name() const {
-  return *name_;
-}
-inline void Stat::set_name(const ::std::string& value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.queue_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.queue_.IsDefault()) {
+    _impl_.queue_.Set("", GetArenaForAllocation());
   }
-  name_->assign(value);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline void Stat::set_name(const char* value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
+inline void QueueError::set_allocated_queue(std::string* queue) {
+  if (queue != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  name_->assign(value);
-}
-inline void Stat::set_name(const char* value, size_t size) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
+  _impl_.queue_.SetAllocated(queue, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.queue_.IsDefault()) {
+    _impl_.queue_.Set("", GetArenaForAllocation());
   }
-  name_->assign(reinterpret_cast<const char*>(value), size);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:wire.QueueError.queue)
+}
+
+// optional string error = 2;
+inline bool QueueError::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool QueueError::has_error() const {
+  return _internal_has_error();
 }
-inline ::std::string* Stat::mutable_name() {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
+inline void QueueError::clear_error() {
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& QueueError::error() const {
+  // @@protoc_insertion_point(field_get:wire.QueueError.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void QueueError::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:wire.QueueError.error)
+}
+inline std::string* QueueError::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:wire.QueueError.error)
+  return _s;
+}
+inline const std::string& QueueError::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void QueueError::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* QueueError::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* QueueError::release_error() {
+  // @@protoc_insertion_point(field_release:wire.QueueError.error)
+  if (!_internal_has_error()) {
+    return nullptr;
   }
-  return name_;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline ::std::string* Stat::release_name() {
-  clear_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void QueueError::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    ::std::string* temp = name_;
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:wire.QueueError.error)
+}
+
+// -------------------------------------------------------------------
+
+// QueueDeclaration
+
+// required string name = 1;
+inline bool QueueDeclaration::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool QueueDeclaration::has_name() const {
+  return _internal_has_name();
 }
-inline void Stat::set_allocated_name(::std::string* name) {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
+inline void QueueDeclaration::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& QueueDeclaration::name() const {
+  // @@protoc_insertion_point(field_get:wire.QueueDeclaration.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void QueueDeclaration::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:wire.QueueDeclaration.name)
+}
+inline std::string* QueueDeclaration::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:wire.QueueDeclaration.name)
+  return _s;
+}
+inline const std::string& QueueDeclaration::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void QueueDeclaration::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* QueueDeclaration::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* QueueDeclaration::release_name() {
+  // @@protoc_insertion_point(field_release:wire.QueueDeclaration.name)
+  if (!_internal_has_name()) {
+    return nullptr;
   }
-  if (name) {
-    set_has_name();
-    name_ = name;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void QueueDeclaration::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_name();
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:wire.QueueDeclaration.name)
 }
 
-// required bool exists = 2;
-inline bool Stat::has_exists() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// required .wire.QueueDeclaration.Type type = 2;
+inline bool QueueDeclaration::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void Stat::set_has_exists() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool QueueDeclaration::has_type() const {
+  return _internal_has_type();
 }
-inline void Stat::clear_has_exists() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void QueueDeclaration::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void Stat::clear_exists() {
-  exists_ = false;
-  clear_has_exists();
+inline ::wire::QueueDeclaration_Type QueueDeclaration::_internal_type() const {
+  return static_cast< ::wire::QueueDeclaration_Type >(_impl_.type_);
 }
-inline bool Stat::exists() const {
-  return exists_;
+inline ::wire::QueueDeclaration_Type QueueDeclaration::type() const {
+  // @@protoc_insertion_point(field_get:wire.QueueDeclaration.type)
+  return _internal_type();
 }
-inline void Stat::set_exists(bool value) {
-  set_has_exists();
-  exists_ = value;
+inline void QueueDeclaration::_internal_set_type(::wire::QueueDeclaration_Type value) {
+  assert(::wire::QueueDeclaration_Type_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.type_ = value;
+}
+inline void QueueDeclaration::set_type(::wire::QueueDeclaration_Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:wire.QueueDeclaration.type)
 }
 
-// optional uint32 transient_size = 3;
-inline bool Stat::has_transient_size() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// optional uint32 sync_replicas = 3;
+inline bool QueueDeclaration::_internal_has_sync_replicas() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void Stat::set_has_transient_size() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool QueueDeclaration::has_sync_replicas() const {
+  return _internal_has_sync_replicas();
 }
-inline void Stat::clear_has_transient_size() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void QueueDeclaration::clear_sync_replicas() {
+  _impl_.sync_replicas_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void Stat::clear_transient_size() {
-  transient_size_ = 0u;
-  clear_has_transient_size();
+inline uint32_t QueueDeclaration::_internal_sync_replicas() const {
+  return _impl_.sync_replicas_;
 }
-inline ::google::protobuf::uint32 Stat::transient_size() const {
-  return transient_size_;
+inline uint32_t QueueDeclaration::sync_replicas() const {
+  // @@protoc_insertion_point(field_get:wire.QueueDeclaration.sync_replicas)
+  return _internal_sync_replicas();
 }
-inline void Stat::set_transient_size(::google::protobuf::uint32 value) {
-  set_has_transient_size();
-  transient_size_ = value;
+inline void QueueDeclaration::_internal_set_sync_replicas(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.sync_replicas_ = value;
+}
+inline void QueueDeclaration::set_sync_replicas(uint32_t value) {
+  _internal_set_sync_replicas(value);
+  // @@protoc_insertion_point(field_set:wire.QueueDeclaration.sync_replicas)
 }
 
-// optional uint32 durable_size = 4;
-inline bool Stat::has_durable_size() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+// optional uint32 ttl = 4;
+inline bool QueueDeclaration::_internal_has_ttl() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void Stat::set_has_durable_size() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool QueueDeclaration::has_ttl() const {
+  return _internal_has_ttl();
 }
-inline void Stat::clear_has_durable_size() {
-  _has_bits_[0] &= ~0x00000008u;
+inline void QueueDeclaration::clear_ttl() {
+  _impl_.ttl_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline void Stat::clear_durable_size() {
-  durable_size_ = 0u;
-  clear_has_durable_size();
+inline uint32_t QueueDeclaration::_internal_ttl() const {
+  return _impl_.ttl_;
 }
-inline ::google::protobuf::uint32 Stat::durable_size() const {
-  return durable_size_;
+inline uint32_t QueueDeclaration::ttl() const {
+  // @@protoc_insertion_point(field_get:wire.QueueDeclaration.ttl)
+  return _internal_ttl();
 }
-inline void Stat::set_durable_size(::google::protobuf::uint32 value) {
-  set_has_durable_size();
-  durable_size_ = value;
+inline void QueueDeclaration::_internal_set_ttl(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.ttl_ = value;
+}
+inline void QueueDeclaration::set_ttl(uint32_t value) {
+  _internal_set_ttl(value);
+  // @@protoc_insertion_point(field_set:wire.QueueDeclaration.ttl)
 }
 
-// -------------------------------------------------------------------
-
-// ReplicaAction
-
-// required .wire.ReplicaAction.Type type = 1;
-inline bool ReplicaAction::has_type() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional uint32 ack_timeout = 5;
+inline bool QueueDeclaration::_internal_has_ack_timeout() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline void ReplicaAction::set_has_type() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool QueueDeclaration::has_ack_timeout() const {
+  return _internal_has_ack_timeout();
 }
-inline void ReplicaAction::clear_has_type() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void QueueDeclaration::clear_ack_timeout() {
+  _impl_.ack_timeout_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline void ReplicaAction::clear_type() {
-  type_ = 0;
-  clear_has_type();
+inline uint32_t QueueDeclaration::_internal_ack_timeout() const {
+  return _impl_.ack_timeout_;
 }
-inline ::wire::ReplicaAction_Type ReplicaAction::type() const {
-  return static_cast< ::wire::ReplicaAction_Type >(type_);
+inline uint32_t QueueDeclaration::ack_timeout() const {
+  // @@protoc_insertion_point(field_get:wire.QueueDeclaration.ack_timeout)
+  return _internal_ack_timeout();
 }
-inline void ReplicaAction::set_type(::wire::ReplicaAction_Type value) {
-  assert(::wire::ReplicaAction_Type_IsValid(value));
-  set_has_type();
-  type_ = value;
+inline void QueueDeclaration::_internal_set_ack_timeout(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.ack_timeout_ = value;
+}
+inline void QueueDeclaration::set_ack_timeout(uint32_t value) {
+  _internal_set_ack_timeout(value);
+  // @@protoc_insertion_point(field_set:wire.QueueDeclaration.ack_timeout)
 }
 
-// optional bytes payload = 2;
-inline bool ReplicaAction::has_payload() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// optional uint32 weight = 6;
+inline bool QueueDeclaration::_internal_has_weight() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
 }
-inline void ReplicaAction::set_has_payload() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool QueueDeclaration::has_weight() const {
+  return _internal_has_weight();
 }
-inline void ReplicaAction::clear_has_payload() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void QueueDeclaration::clear_weight() {
+  _impl_.weight_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
 }
-inline void ReplicaAction::clear_payload() {
-  if (payload_ != &::google::protobuf::internal::kEmptyString) {
-    payload_->clear();
-  }
-  clear_has_payload();
+inline uint32_t QueueDeclaration::_internal_weight() const {
+  return _impl_.weight_;
 }
-inline const ::std::string& ReplicaAction::payload() const {
-  return *payload_;
+inline uint32_t QueueDeclaration::weight() const {
+  // @@protoc_insertion_point(field_get:wire.QueueDeclaration.weight)
+  return _internal_weight();
 }
-inline void ReplicaAction::set_payload(const ::std::string& value) {
-  set_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    payload_ = new ::std::string;
-  }
-  payload_->assign(value);
+inline void QueueDeclaration::_internal_set_weight(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.weight_ = value;
 }
-inline void ReplicaAction::set_payload(const char* value) {
-  set_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    payload_ = new ::std::string;
-  }
-  payload_->assign(value);
+inline void QueueDeclaration::set_weight(uint32_t value) {
+  _internal_set_weight(value);
+  // @@protoc_insertion_point(field_set:wire.QueueDeclaration.weight)
 }
-inline void ReplicaAction::set_payload(const void* value, size_t size) {
-  set_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    payload_ = new ::std::string;
-  }
-  payload_->assign(reinterpret_cast<const char*>(value), size);
+
+// optional uint64 durable_size = 7;
+inline bool QueueDeclaration::_internal_has_durable_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
 }
-inline ::std::string* ReplicaAction::mutable_payload() {
-  set_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    payload_ = new ::std::string;
-  }
-  return payload_;
+inline bool QueueDeclaration::has_durable_size() const {
+  return _internal_has_durable_size();
 }
-inline ::std::string* ReplicaAction::release_payload() {
-  clear_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = payload_;
-    payload_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline void QueueDeclaration::clear_durable_size() {
+  _impl_.durable_size_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
-inline void ReplicaAction::set_allocated_payload(::std::string* payload) {
-  if (payload_ != &::google::protobuf::internal::kEmptyString) {
-    delete payload_;
-  }
-  if (payload) {
-    set_has_payload();
-    payload_ = payload;
-  } else {
-    clear_has_payload();
-    payload_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline uint64_t QueueDeclaration::_internal_durable_size() const {
+  return _impl_.durable_size_;
+}
+inline uint64_t QueueDeclaration::durable_size() const {
+  // @@protoc_insertion_point(field_get:wire.QueueDeclaration.durable_size)
+  return _internal_durable_size();
+}
+inline void QueueDeclaration::_internal_set_durable_size(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.durable_size_ = value;
+}
+inline void QueueDeclaration::set_durable_size(uint64_t value) {
+  _internal_set_durable_size(value);
+  // @@protoc_insertion_point(field_set:wire.QueueDeclaration.durable_size)
 }
 
-// -------------------------------------------------------------------
-
-// QueueError
-
-// required string queue = 1;
-inline bool QueueError::has_queue() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional bool expiries_indexed = 8;
+inline bool QueueDeclaration::_internal_has_expiries_indexed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
 }
-inline void QueueError::set_has_queue() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool QueueDeclaration::has_expiries_indexed() const {
+  return _internal_has_expiries_indexed();
 }
-inline void QueueError::clear_has_queue() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void QueueDeclaration::clear_expiries_indexed() {
+  _impl_.expiries_indexed_ = false;
+  _impl_._has_bits_[0] &= ~0x00000080u;
 }
-inline void QueueError::clear_queue() {
-  if (queue_ != &::google::protobuf::internal::kEmptyString) {
-    queue_->clear();
-  }
-  clear_has_queue();
+inline bool QueueDeclaration::_internal_expiries_indexed() const {
+  return _impl_.expiries_indexed_;
 }
-inline const ::std::string& QueueError::queue() const {
-  return *queue_;
+inline bool QueueDeclaration::expiries_indexed() const {
+  // @@protoc_insertion_point(field_get:wire.QueueDeclaration.expiries_indexed)
+  return _internal_expiries_indexed();
 }
-inline void QueueError::set_queue(const ::std::string& value) {
-  set_has_queue();
-  if (queue_ == &::google::protobuf::internal::kEmptyString) {
-    queue_ = new ::std::string;
-  }
-  queue_->assign(value);
+inline void QueueDeclaration::_internal_set_expiries_indexed(bool value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.expiries_indexed_ = value;
 }
-inline void QueueError::set_queue(const char* value) {
-  set_has_queue();
-  if (queue_ == &::google::protobuf::internal::kEmptyString) {
-    queue_ = new ::std::string;
-  }
-  queue_->assign(value);
+inline void QueueDeclaration::set_expiries_indexed(bool value) {
+  _internal_set_expiries_indexed(value);
+  // @@protoc_insertion_point(field_set:wire.QueueDeclaration.expiries_indexed)
 }
-inline void QueueError::set_queue(const char* value, size_t size) {
-  set_has_queue();
-  if (queue_ == &::google::protobuf::internal::kEmptyString) {
-    queue_ = new ::std::string;
+
+// -------------------------------------------------------------------
+
+// QueueReplication
+
+// required string queue = 1;
+inline bool QueueReplication::_internal_has_queue() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool QueueReplication::has_queue() const {
+  return _internal_has_queue();
+}
+inline void QueueReplication::clear_queue() {
+  _impl_.queue_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& QueueReplication::queue() const {
+  // @@protoc_insertion_point(field_get:wire.QueueReplication.queue)
+  return _internal_queue();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void QueueReplication::set_queue(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.queue_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:wire.QueueReplication.queue)
+}
+inline std::string* QueueReplication::mutable_queue() {
+  std::string* _s = _internal_mutable_queue();
+  // @@protoc_insertion_point(field_mutable:wire.QueueReplication.queue)
+  return _s;
+}
+inline const std::string& QueueReplication::_internal_queue() const {
+  return _impl_.queue_.Get();
+}
+inline void QueueReplication::_internal_set_queue(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.queue_.Set(value, GetArenaForAllocation());
+}
+inline std::string* QueueReplication::_internal_mutable_queue() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.queue_.Mutable(GetArenaForAllocation());
+}
+inline std::string* QueueReplication::release_queue() {
+  // @@protoc_insertion_point(field_release:wire.QueueReplication.queue)
+  if (!_internal_has_queue()) {
+    return nullptr;
   }
-  queue_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* QueueError::mutable_queue() {
-  set_has_queue();
-  if (queue_ == &::google::protobuf::internal::kEmptyString) {
-    queue_ = new ::std::string;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.queue_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.queue_.IsDefault()) {
+    _impl_.queue_.Set("", GetArenaForAllocation());
   }
-  return queue_;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline ::std::string* QueueError::release_queue() {
-  clear_has_queue();
-  if (queue_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void QueueReplication::set_allocated_queue(std::string* queue) {
+  if (queue != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = queue_;
-    queue_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void QueueError::set_allocated_queue(::std::string* queue) {
-  if (queue_ != &::google::protobuf::internal::kEmptyString) {
-    delete queue_;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  if (queue) {
-    set_has_queue();
-    queue_ = queue;
-  } else {
-    clear_has_queue();
-    queue_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.queue_.SetAllocated(queue, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.queue_.IsDefault()) {
+    _impl_.queue_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:wire.QueueReplication.queue)
 }
 
-// optional string error = 2;
-inline bool QueueError::has_error() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// required uint32 sync_replicas = 2;
+inline bool QueueReplication::_internal_has_sync_replicas() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void QueueError::set_has_error() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool QueueReplication::has_sync_replicas() const {
+  return _internal_has_sync_replicas();
 }
-inline void QueueError::clear_has_error() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void QueueReplication::clear_sync_replicas() {
+  _impl_.sync_replicas_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void QueueError::clear_error() {
-  if (error_ != &::google::protobuf::internal::kEmptyString) {
-    error_->clear();
-  }
-  clear_has_error();
+inline uint32_t QueueReplication::_internal_sync_replicas() const {
+  return _impl_.sync_replicas_;
 }
-inline const ::std::string& QueueError::error() const {
-  return *error_;
+inline uint32_t QueueReplication::sync_replicas() const {
+  // @@protoc_insertion_point(field_get:wire.QueueReplication.sync_replicas)
+  return _internal_sync_replicas();
 }
-inline void QueueError::set_error(const ::std::string& value) {
-  set_has_error();
-  if (error_ == &::google::protobuf::internal::kEmptyString) {
-    error_ = new ::std::string;
-  }
-  error_->assign(value);
+inline void QueueReplication::_internal_set_sync_replicas(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.sync_replicas_ = value;
 }
-inline void QueueError::set_error(const char* value) {
-  set_has_error();
-  if (error_ == &::google::protobuf::internal::kEmptyString) {
-    error_ = new ::std::string;
-  }
-  error_->assign(value);
+inline void QueueReplication::set_sync_replicas(uint32_t value) {
+  _internal_set_sync_replicas(value);
+  // @@protoc_insertion_point(field_set:wire.QueueReplication.sync_replicas)
 }
-inline void QueueError::set_error(const char* value, size_t size) {
-  set_has_error();
-  if (error_ == &::google::protobuf::internal::kEmptyString) {
-    error_ = new ::std::string;
+
+// -------------------------------------------------------------------
+
+// QueueOptions
+
+// required string queue = 1;
+inline bool QueueOptions::_internal_has_queue() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool QueueOptions::has_queue() const {
+  return _internal_has_queue();
+}
+inline void QueueOptions::clear_queue() {
+  _impl_.queue_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& QueueOptions::queue() const {
+  // @@protoc_insertion_point(field_get:wire.QueueOptions.queue)
+  return _internal_queue();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void QueueOptions::set_queue(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.queue_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:wire.QueueOptions.queue)
+}
+inline std::string* QueueOptions::mutable_queue() {
+  std::string* _s = _internal_mutable_queue();
+  // @@protoc_insertion_point(field_mutable:wire.QueueOptions.queue)
+  return _s;
+}
+inline const std::string& QueueOptions::_internal_queue() const {
+  return _impl_.queue_.Get();
+}
+inline void QueueOptions::_internal_set_queue(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.queue_.Set(value, GetArenaForAllocation());
+}
+inline std::string* QueueOptions::_internal_mutable_queue() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.queue_.Mutable(GetArenaForAllocation());
+}
+inline std::string* QueueOptions::release_queue() {
+  // @@protoc_insertion_point(field_release:wire.QueueOptions.queue)
+  if (!_internal_has_queue()) {
+    return nullptr;
   }
-  error_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* QueueError::mutable_error() {
-  set_has_error();
-  if (error_ == &::google::protobuf::internal::kEmptyString) {
-    error_ = new ::std::string;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.queue_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.queue_.IsDefault()) {
+    _impl_.queue_.Set("", GetArenaForAllocation());
   }
-  return error_;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline ::std::string* QueueError::release_error() {
-  clear_has_error();
-  if (error_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void QueueOptions::set_allocated_queue(std::string* queue) {
+  if (queue != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = error_;
-    error_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void QueueError::set_allocated_error(::std::string* error) {
-  if (error_ != &::google::protobuf::internal::kEmptyString) {
-    delete error_;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  if (error) {
-    set_has_error();
-    error_ = error;
-  } else {
-    clear_has_error();
-    error_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.queue_.SetAllocated(queue, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.queue_.IsDefault()) {
+    _impl_.queue_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:wire.QueueOptions.queue)
 }
 
-// -------------------------------------------------------------------
-
-// QueueDeclaration
-
-// required string name = 1;
-inline bool QueueDeclaration::has_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional uint32 ttl = 2;
+inline bool QueueOptions::_internal_has_ttl() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void QueueDeclaration::set_has_name() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool QueueOptions::has_ttl() const {
+  return _internal_has_ttl();
 }
-inline void QueueDeclaration::clear_has_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void QueueOptions::clear_ttl() {
+  _impl_.ttl_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void QueueDeclaration::clear_name() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    name_->clear();
-  }
-  clear_has_name();
+inline uint32_t QueueOptions::_internal_ttl() const {
+  return _impl_.ttl_;
 }
-inline const ::std::string& QueueDeclaration::name() const {
-  return *name_;
+inline uint32_t QueueOptions::ttl() const {
+  // @@protoc_insertion_point(field_get:wire.QueueOptions.ttl)
+  return _internal_ttl();
 }
-inline void QueueDeclaration::set_name(const ::std::string& value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
+inline void QueueOptions::_internal_set_ttl(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.ttl_ = value;
 }
-inline void QueueDeclaration::set_name(const char* value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
+inline void QueueOptions::set_ttl(uint32_t value) {
+  _internal_set_ttl(value);
+  // @@protoc_insertion_point(field_set:wire.QueueOptions.ttl)
 }
-inline void QueueDeclaration::set_name(const char* value, size_t size) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(reinterpret_cast<const char*>(value), size);
+
+// optional uint32 ack_timeout = 3;
+inline bool QueueOptions::_internal_has_ack_timeout() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline ::std::string* QueueDeclaration::mutable_name() {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  return name_;
+inline bool QueueOptions::has_ack_timeout() const {
+  return _internal_has_ack_timeout();
 }
-inline ::std::string* QueueDeclaration::release_name() {
-  clear_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = name_;
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline void QueueOptions::clear_ack_timeout() {
+  _impl_.ack_timeout_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void QueueDeclaration::set_allocated_name(::std::string* name) {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
-  }
-  if (name) {
-    set_has_name();
-    name_ = name;
-  } else {
-    clear_has_name();
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline uint32_t QueueOptions::_internal_ack_timeout() const {
+  return _impl_.ack_timeout_;
+}
+inline uint32_t QueueOptions::ack_timeout() const {
+  // @@protoc_insertion_point(field_get:wire.QueueOptions.ack_timeout)
+  return _internal_ack_timeout();
+}
+inline void QueueOptions::_internal_set_ack_timeout(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.ack_timeout_ = value;
+}
+inline void QueueOptions::set_ack_timeout(uint32_t value) {
+  _internal_set_ack_timeout(value);
+  // @@protoc_insertion_point(field_set:wire.QueueOptions.ack_timeout)
 }
 
-// required .wire.QueueDeclaration.Type type = 2;
-inline bool QueueDeclaration::has_type() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// optional uint32 weight = 4;
+inline bool QueueOptions::_internal_has_weight() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void QueueDeclaration::set_has_type() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool QueueOptions::has_weight() const {
+  return _internal_has_weight();
 }
-inline void QueueDeclaration::clear_has_type() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void QueueOptions::clear_weight() {
+  _impl_.weight_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline void QueueDeclaration::clear_type() {
-  type_ = 0;
-  clear_has_type();
+inline uint32_t QueueOptions::_internal_weight() const {
+  return _impl_.weight_;
 }
-inline ::wire::QueueDeclaration_Type QueueDeclaration::type() const {
-  return static_cast< ::wire::QueueDeclaration_Type >(type_);
+inline uint32_t QueueOptions::weight() const {
+  // @@protoc_insertion_point(field_get:wire.QueueOptions.weight)
+  return _internal_weight();
 }
-inline void QueueDeclaration::set_type(::wire::QueueDeclaration_Type value) {
-  assert(::wire::QueueDeclaration_Type_IsValid(value));
-  set_has_type();
-  type_ = value;
+inline void QueueOptions::_internal_set_weight(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.weight_ = value;
+}
+inline void QueueOptions::set_weight(uint32_t value) {
+  _internal_set_weight(value);
+  // @@protoc_insertion_point(field_set:wire.QueueOptions.weight)
 }
 
 // -------------------------------------------------------------------
@@ -2421,52 +8670,114 @@ inline void QueueDeclaration::set_type(::wire::QueueDeclaration_Type value) {
 // QueueConfiguration
 
 // repeated .wire.QueueDeclaration queues = 1;
+inline int QueueConfiguration::_internal_queues_size() const {
+  return _impl_.queues_.size();
+}
 inline int QueueConfiguration::queues_size() const {
-  return queues_.size();
+  return _internal_queues_size();
 }
 inline void QueueConfiguration::clear_queues() {
-  queues_.Clear();
+  _impl_.queues_.Clear();
+}
+inline ::wire::QueueDeclaration* QueueConfiguration::mutable_queues(int index) {
+  // @@protoc_insertion_point(field_mutable:wire.QueueConfiguration.queues)
+  return _impl_.queues_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::QueueDeclaration >*
+QueueConfiguration::mutable_queues() {
+  // @@protoc_insertion_point(field_mutable_list:wire.QueueConfiguration.queues)
+  return &_impl_.queues_;
+}
+inline const ::wire::QueueDeclaration& QueueConfiguration::_internal_queues(int index) const {
+  return _impl_.queues_.Get(index);
 }
 inline const ::wire::QueueDeclaration& QueueConfiguration::queues(int index) const {
-  return queues_.Get(index);
+  // @@protoc_insertion_point(field_get:wire.QueueConfiguration.queues)
+  return _internal_queues(index);
 }
-inline ::wire::QueueDeclaration* QueueConfiguration::mutable_queues(int index) {
-  return queues_.Mutable(index);
+inline ::wire::QueueDeclaration* QueueConfiguration::_internal_add_queues() {
+  return _impl_.queues_.Add();
 }
 inline ::wire::QueueDeclaration* QueueConfiguration::add_queues() {
-  return queues_.Add();
+  ::wire::QueueDeclaration* _add = _internal_add_queues();
+  // @@protoc_insertion_point(field_add:wire.QueueConfiguration.queues)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::wire::QueueDeclaration >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::QueueDeclaration >&
 QueueConfiguration::queues() const {
-  return queues_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::wire::QueueDeclaration >*
-QueueConfiguration::mutable_queues() {
-  return &queues_;
+  // @@protoc_insertion_point(field_list:wire.QueueConfiguration.queues)
+  return _impl_.queues_;
 }
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace wire
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
+template <> struct is_proto_enum< ::wire::ReplicaAction_Type> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::wire::ReplicaAction_Type>() {
   return ::wire::ReplicaAction_Type_descriptor();
 }
+template <> struct is_proto_enum< ::wire::ReplicaEntry_Type> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::wire::ReplicaEntry_Type>() {
+  return ::wire::ReplicaEntry_Type_descriptor();
+}
+template <> struct is_proto_enum< ::wire::QueueDeclaration_Type> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::wire::QueueDeclaration_Type>() {
   return ::wire::QueueDeclaration_Type_descriptor();
 }
 
-}  // namespace google
-}  // namespace protobuf
-#endif  // SWIG
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_wire_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_wire_2eproto
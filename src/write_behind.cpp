@@ -0,0 +1,122 @@
+#include "write_behind.hpp"
+#include "server.hpp"
+#include "replication.hpp"
+#include "debugs.hpp"
+
+#include <iostream>
+
+WriteBehindStore::~WriteBehindStore() {
+  commit();
+  if(queued_) server_.forget_commit(this);
+
+  delete store_;
+}
+
+uint64_t WriteBehindStore::next_index() {
+  uint64_t idx = store_->next_index();
+  return idx > next_index_ ? idx : next_index_;
+}
+
+bool WriteBehindStore::append_at(uint64_t idx, Message& msg) {
+  if(idx < next_index()) {
+    std::cerr << "Attempted to append " << idx
+              << " behind the end of a write-behind store\n";
+    return false;
+  }
+
+  msg.make_durable(idx);
+  pending_[idx] = msg;
+  next_index_ = idx + 1;
+
+  server_.wrote(this);
+
+  if(!queued_) {
+    queued_ = true;
+    server_.schedule_commit(this);
+  }
+
+  return true;
+}
+
+bool WriteBehindStore::has(uint64_t idx) {
+  if(pending_.count(idx) > 0) return true;
+  return store_->has(idx);
+}
+
+bool WriteBehindStore::erase(uint64_t idx) {
+  Pending::iterator i = pending_.find(idx);
+
+  if(i == pending_.end()) return store_->erase(idx);
+
+  pending_.erase(i);
+  server_.elided_write();
+
+  debugs << "Elided durable write of " << idx << "\n";
+  return true;
+}
+
+bool WriteBehindStore::erase_all(const std::vector<uint64_t>& idxs) {
+  std::vector<uint64_t> committed;
+
+  for(std::vector<uint64_t>::const_iterator i = idxs.begin();
+      i != idxs.end();
+      ++i) {
+    Pending::iterator p = pending_.find(*i);
+
+    if(p == pending_.end()) {
+      committed.push_back(*i);
+    } else {
+      pending_.erase(p);
+      server_.elided_write();
+    }
+  }
+
+  if(committed.empty()) return true;
+  return store_->erase_all(committed);
+}
+
+unsigned WriteBehindStore::size() {
+  return store_->size() + pending_.size();
+}
+
+bool WriteBehindStore::clear() {
+  pending_.clear();
+  next_index_ = 0;
+
+  return store_->clear();
+}
+
+bool WriteBehindStore::next(uint64_t from, Message& msg) {
+  if(store_->next(from, msg)) return true;
+
+  Pending::iterator i = pending_.lower_bound(from);
+  if(i == pending_.end()) return false;
+
+  msg = i->second;
+  return true;
+}
+
+// Everything pending goes to the store underneath as one batch.
+bool WriteBehindStore::commit() {
+  if(pending_.empty()) return true;
+
+  Pending unwritten = pending_;
+  bool ok = store_->append_all(unwritten);
+
+  for(Pending::iterator i = pending_.begin(); i != pending_.end();) {
+    if(unwritten.count(i->first) > 0) {
+      ++i;
+      continue;
+    }
+
+    server_.replication().appended(name_, i->second);
+    pending_.erase(i++);
+  }
+
+  if(!ok) {
+    std::cerr << "Unable to commit " << unwritten.size()
+              << " durable messages for " << name_ << "\n";
+  }
+
+  return ok;
+}
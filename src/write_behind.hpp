@@ -0,0 +1,88 @@
+#ifndef WRITE_BEHIND_HPP
+#define WRITE_BEHIND_HPP
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+#include "durable_store.hpp"
+#include "message.hpp"
+
+class Server;
+
+// Holds appends to another store in memory for a short window before
+// writing them all out together. A message erased before then, which
+// is what happens when a consumer is keeping up and acks quickly,
+// never touches the disk at all.
+//
+// The server commits every store with pending appends when the window
+// is up, and the ones a read's publishes went to before that publisher
+// is sent its confirms.
+//
+// Everything pending comes after everything already committed, so
+// indexes still only ever increase. Elided messages leave gaps in the
+// indexes of the store underneath.
+//
+// Messages are only replicated once they're committed, so replicas
+// never hear about elided ones at all.
+class WriteBehindStore : public DurableStore {
+  Server& server_;
+  std::string name_;
+  DurableStore* store_;
+
+  typedef Appends Pending;
+  Pending pending_;
+
+  uint64_t next_index_;
+
+  // Whether the server knows we have something to commit.
+  bool queued_;
+
+  // Not copyable.
+  WriteBehindStore(const WriteBehindStore&);
+  WriteBehindStore& operator=(const WriteBehindStore&);
+
+public:
+  WriteBehindStore(Server& s, std::string name, DurableStore* store)
+    : server_(s)
+    , name_(name)
+    , store_(store)
+    , pending_()
+    , next_index_(0)
+    , queued_(false)
+  {}
+
+  ~WriteBehindStore();
+
+  uint64_t next_index();
+  bool append_at(uint64_t idx, Message& msg);
+  bool has(uint64_t idx);
+
+  bool pending_p(uint64_t idx) {
+    return pending_.count(idx) > 0;
+  }
+  bool erase(uint64_t idx);
+  bool erase_all(const std::vector<uint64_t>& idxs);
+  unsigned size();
+  bool clear();
+  bool next(uint64_t from, Message& msg);
+
+  bool compact() {
+    return store_->compact();
+  }
+
+  bool warm() {
+    return store_->warm();
+  }
+
+  // Write out everything pending. Called by the server.
+  bool commit();
+
+  void dequeued() {
+    queued_ = false;
+  }
+};
+
+#endif
@@ -29,6 +29,7 @@ WriteStatus WriteSet::flush(int fd) {
 
       sl->start += r;
       left -= r;
+      bytes_ -= r;
 
 #ifdef SIMULATE_BAD_NETWORK
       return eWouldBlock;
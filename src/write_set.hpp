@@ -25,10 +25,21 @@ class WriteSet {
 
   Slices slices_;
 
+  // Bytes added but not yet written to the fd.
+  size_t bytes_;
+
 public:
+  WriteSet()
+    : bytes_(0)
+  {}
 
   void add(std::string val, int s=0) {
     slices_.push_back(new Slice(val, 0));
+    bytes_ += val.size();
+  }
+
+  size_t bytes() {
+    return bytes_;
   }
 
   WriteStatus flush(int fd);